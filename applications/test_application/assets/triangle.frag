@@ -11,6 +11,8 @@ layout(set = 1, binding = 1) uniform sampler2D textures[];
 layout (push_constant) uniform Constants {
     float frame;
     int material_index;
+    vec2 uv_offset;
+    vec2 uv_scale;
 } constants;
 
 void main() {
@@ -19,5 +21,11 @@ void main() {
     outColor = vec4(vec3(pow(gl_FragCoord.z, 128)), 1);
     outColor.r *= multiplier;
 
-    outColor = texture(textures[constants.material_index], textureCoords);
+    // Atlas textures are wrapped by hand, the gradients of the unwrapped coordinates keep the mip level stable
+    // across the wrap seam.
+    outColor = textureGrad(
+        textures[constants.material_index],
+        constants.uv_offset + fract(textureCoords) * constants.uv_scale,
+        dFdx(textureCoords) * constants.uv_scale,
+        dFdy(textureCoords) * constants.uv_scale);
 }
\ No newline at end of file
@@ -1,15 +1,27 @@
+#include <array>
+#include <optional>
+#include <thread>
+
 #include <xar_engine/logging/logger.hpp>
 
+#include <xar_engine/asset/image_loader.hpp>
 #include <xar_engine/asset/model_loader.hpp>
 
 #include <xar_engine/graphics/api/graphics_backend_factory.hpp>
 
+#include <xar_engine/math/transform.hpp>
+
 #include <xar_engine/meta/overloaded.hpp>
 
 #include <xar_engine/os/application.hpp>
 
 #include <xar_engine/renderer/renderer.hpp>
 
+#include <xar_engine/scene/transform_table.hpp>
+
+#include <xar_engine/thread/task.hpp>
+#include <xar_engine/thread/thread_pool.hpp>
+
 
 int main()
 {
@@ -20,23 +32,94 @@ int main()
         graphics_backend,
         window->get_surface());
 
-    std::vector<xar_engine::renderer::gpu_asset::GpuMaterialReference> gpu_material_list;
-    std::vector<xar_engine::renderer::gpu_asset::GpuModel> gpu_model_list;
+    const auto model_loader = xar_engine::asset::ModelLoaderFactory().make();
+    const auto image_loader = xar_engine::asset::ImageLoaderFactory().make();
+
+    auto main_thread_executor = xar_engine::thread::QueueExecutor{};
+    auto worker_thread_pool = xar_engine::thread::ThreadPool{xar_engine::thread::ThreadPool::get_default_worker_count()};
+    // Loads resume on the main thread, so the count is only touched there.
+    auto pending_load_count = std::size_t{0};
+
+    std::array<std::optional<xar_engine::renderer::gpu_asset::GpuMaterialReference>, 2> gpu_material_list;
+    std::array<std::optional<xar_engine::renderer::gpu_asset::GpuModel>, 2> gpu_model_list;
+    std::array<xar_engine::asset::ModelNodeList, 2> model_node_list;
+    std::array<xar_engine::scene::TransformTable, 2> transform_table_list;
     window->set_on_run(
         [&]()
         {
-            gpu_model_list = renderer->gpu_model_unit().make_gpu_model({
-                std::vector<xar_engine::asset::Model>{
-                    xar_engine::asset::ModelLoaderFactory().make()->load_model_from_file("assets/viking_room.obj"),
-                    xar_engine::asset::ModelLoaderFactory().make()->load_model_from_file("assets/house.obj"),
-                }});
-            gpu_material_list.push_back(renderer->gpu_material_unit().make_gpu_material({{"assets/viking_room.png"}}));
-            gpu_material_list.push_back(renderer->gpu_material_unit().make_gpu_material({{"assets/house.png"}}));
+            const auto load_gpu_model = [&](
+                const char* path,
+                std::size_t index)
+            {
+                ++pending_load_count;
+                xar_engine::thread::start_task(
+                    model_loader->load_model_async(
+                        path,
+                        worker_thread_pool,
+                        main_thread_executor),
+                    [&, path, index](std::expected<xar_engine::asset::Model, std::exception_ptr> model)
+                    {
+                        --pending_load_count;
+                        if (!model)
+                        {
+                            XAR_LOG(
+                                xar_engine::logging::LogLevel::ERROR,
+                                "TestApp",
+                                "Failed to load model {}",
+                                path);
+                            return;
+                        }
+
+                        model_node_list[index] = model->node_list;
+                        transform_table_list[index] = xar_engine::scene::make_transform_table(model->node_list);
+                        gpu_model_list[index] = renderer->gpu_model_unit().make_gpu_model({{std::move(*model)}})[0];
+                    });
+            };
+            const auto load_gpu_material = [&](
+                const char* path,
+                std::size_t index)
+            {
+                ++pending_load_count;
+                xar_engine::thread::start_task(
+                    image_loader->load_image_async(
+                        path,
+                        worker_thread_pool,
+                        main_thread_executor),
+                    [&, path, index](std::expected<xar_engine::asset::Image, std::exception_ptr> image)
+                    {
+                        --pending_load_count;
+                        if (!image)
+                        {
+                            XAR_LOG(
+                                xar_engine::logging::LogLevel::ERROR,
+                                "TestApp",
+                                "Failed to load image {}",
+                                path);
+                            return;
+                        }
+
+                        gpu_material_list[index] = renderer->gpu_material_unit().make_gpu_material_from_image({*image});
+                    });
+            };
+
+            load_gpu_model(
+                "assets/viking_room.obj",
+                0);
+            load_gpu_model(
+                "assets/house.obj",
+                1);
+            load_gpu_material(
+                "assets/viking_room.png",
+                0);
+            load_gpu_material(
+                "assets/house.png",
+                1);
         });
 
     window->set_on_update(
         [&]()
         {
+            main_thread_executor.run_pending();
             renderer->update();
         });
 
@@ -47,6 +130,31 @@ int main()
         {
         });
 
+    const auto add_model_to_render = [&](
+        std::size_t index,
+        const xar_engine::math::Affine3x4f& root_matrix)
+    {
+        auto& transform_table = transform_table_list[index];
+        xar_engine::scene::update_world_matrices(
+            transform_table,
+            root_matrix);
+
+        const auto& node_list = model_node_list[index];
+        for (auto node_index = std::size_t{0}; node_index < node_list.parent_index_list.size(); ++node_index)
+        {
+            const auto mesh_index_offset = node_list.mesh_index_offset_list[node_index];
+            for (auto i = std::uint32_t{0}; i < node_list.mesh_index_count_list[node_index]; ++i)
+            {
+                renderer->add_gpu_mesh_instance_to_render(
+                    {
+                        gpu_model_list[index]->gpu_mesh[node_list.mesh_index_list[mesh_index_offset + i]],
+                        transform_table.world_matrix_list[node_index],
+                    },
+                    *gpu_material_list[index]);
+            }
+        }
+    };
+
     window->set_on_keyboard_event(
         [&](const xar_engine::input::KeyboardEvent& event)
         {
@@ -78,40 +186,37 @@ int main()
                             }
                             case xar_engine::input::ButtonCode::_1:
                             {
-                                renderer->add_gpu_mesh_instance_to_render(
-                                    {
-                                        gpu_model_list[0].gpu_mesh[0],
-                                        xar_engine::math::make_identity_matrix(),
-                                    },
-                                    gpu_material_list[0]);
+                                if (!gpu_model_list[0] || !gpu_material_list[0])
+                                {
+                                    break;
+                                }
+
+                                add_model_to_render(
+                                    0,
+                                    xar_engine::math::make_identity_affine());
                                 break;
                             }
                             case xar_engine::input::ButtonCode::_2:
                             {
-                                auto model_matrix = xar_engine::math::make_identity_matrix();
-
-                                model_matrix = xar_engine::math::scale_matrix(
-                                    model_matrix,
-                                    {0.0015f, 0.0015f, 0.0015f});
-
-                                model_matrix = xar_engine::math::rotate_matrix(
-                                    model_matrix,
-                                    90.0f,
-                                    {1.0f, 0.0f, 0.0f});
-                                model_matrix = xar_engine::math::rotate_matrix(
-                                    model_matrix,
-                                    45.0f,
-                                    {0.0f, 1.0f, 0.0f});
-
-                                for (auto i = 0; i < 7; ++i)
+                                if (!gpu_model_list[1] || !gpu_material_list[1])
                                 {
-                                    renderer->add_gpu_mesh_instance_to_render(
-                                        {
-                                            gpu_model_list[1].gpu_mesh[i],
-                                            model_matrix,
-                                        },
-                                        gpu_material_list[1]);
+                                    break;
                                 }
+
+                                const auto root_transform = xar_engine::math::Transform{
+                                    {0.0f, 0.0f, 0.0f},
+                                    xar_engine::math::make_quaternion(
+                                        {1.0f, 0.0f, 0.0f},
+                                        90.0f) *
+                                    xar_engine::math::make_quaternion(
+                                        {0.0f, 1.0f, 0.0f},
+                                        45.0f),
+                                    {0.0015f, 0.0015f, 0.0015f},
+                                };
+
+                                add_model_to_render(
+                                    1,
+                                    xar_engine::math::make_affine_from_transform(root_transform));
                                 break;
                             }
                         }
@@ -164,5 +269,15 @@ int main()
 
     application->run();
 
+    // Loads still running own coroutine frames that only resume from the main thread queue, finish them
+    // before the queue and everything their callbacks use are destroyed.
+    while (pending_load_count > 0)
+    {
+        if (main_thread_executor.run_pending() == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,428 @@
+#include "asset_cooker.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <xar_engine/asset/assimp_model_loader.hpp>
+#include <xar_engine/asset/extension_model_loader.hpp>
+#include <xar_engine/asset/image_loader.hpp>
+#include <xar_engine/asset/mesh_processing_model_loader.hpp>
+#include <xar_engine/asset/obj_model_loader.hpp>
+#include <xar_engine/asset/xmesh_model_file.hpp>
+#include <xar_engine/asset/xtex_image_file.hpp>
+
+#include <xar_engine/file/memory_mapped_file.hpp>
+#include <xar_engine/file/pak_archive.hpp>
+
+#include <xar_engine/logging/logger.hpp>
+
+#include "cook_database.hpp"
+
+
+namespace xar_asset_cooker
+{
+    namespace
+    {
+        constexpr auto tag = "AssetCooker";
+
+        constexpr auto COOK_DATABASE_FILENAME = "xar_asset_cooker.db";
+
+        enum class EAssetType
+        {
+            MODEL,
+            IMAGE,
+        };
+
+        struct SourceAsset
+        {
+            std::filesystem::path relative_path;
+            EAssetType asset_type;
+        };
+
+        struct CookResult
+        {
+            std::optional<CookRecord> cook_record;
+            bool is_up_to_date;
+            std::string error_message;
+        };
+
+        std::optional<EAssetType> get_asset_type(const std::filesystem::path& path)
+        {
+            static const auto asset_type_map = std::unordered_map<std::string, EAssetType>{
+                {".obj", EAssetType::MODEL},
+                {".fbx", EAssetType::MODEL},
+                {".gltf", EAssetType::MODEL},
+                {".glb", EAssetType::MODEL},
+                {".png", EAssetType::IMAGE},
+                {".jpg", EAssetType::IMAGE},
+                {".jpeg", EAssetType::IMAGE},
+                {".hdr", EAssetType::IMAGE},
+                {".tga", EAssetType::IMAGE},
+                {".bmp", EAssetType::IMAGE},
+            };
+
+            auto extension = path.extension().string();
+            std::ranges::transform(
+                extension,
+                extension.begin(),
+                [](unsigned char character)
+                {
+                    return static_cast<char>(std::tolower(character));
+                });
+
+            const auto asset_type_it = asset_type_map.find(extension);
+            if (asset_type_it == asset_type_map.end())
+            {
+                return std::nullopt;
+            }
+
+            return asset_type_it->second;
+        }
+
+        // Material libraries are not cooked themselves, but an OBJ file is cooked again when one changes.
+        std::vector<std::filesystem::path> find_obj_material_libraries(const std::filesystem::path& path)
+        {
+            auto material_library_list = std::vector<std::filesystem::path>{};
+
+            auto file = std::ifstream{path};
+            for (auto line = std::string{}; std::getline(file, line);)
+            {
+                if (!line.starts_with("mtllib "))
+                {
+                    continue;
+                }
+
+                auto material_library = line.substr(7);
+                std::erase(material_library, '\r');
+
+                const auto material_library_path = path.parent_path() / material_library;
+                if (std::filesystem::exists(material_library_path))
+                {
+                    material_library_list.push_back(material_library_path);
+                }
+            }
+
+            return material_library_list;
+        }
+
+        // Renumbers vertices in the order the index list first references them, so the GPU fetches
+        // vertex data front to back.
+        void optimize_vertex_fetch(xar_engine::asset::Mesh& mesh)
+        {
+            constexpr auto UNASSIGNED = std::numeric_limits<std::uint32_t>::max();
+
+            auto vertex_remap = std::vector<std::uint32_t>(mesh.position_list.size(), UNASSIGNED);
+            auto next_vertex = std::uint32_t{0};
+            for (auto& index: mesh.index_list)
+            {
+                if (vertex_remap[index] == UNASSIGNED)
+                {
+                    vertex_remap[index] = next_vertex++;
+                }
+                index = vertex_remap[index];
+            }
+
+            const auto remap_attribute = [&vertex_remap, next_vertex](auto& attribute_list)
+            {
+                if (attribute_list.empty())
+                {
+                    return;
+                }
+
+                auto remapped_attribute_list = std::remove_reference_t<decltype(attribute_list)>(next_vertex);
+                for (auto vertex = std::size_t{0}; vertex < vertex_remap.size(); ++vertex)
+                {
+                    if (vertex_remap[vertex] != UNASSIGNED)
+                    {
+                        remapped_attribute_list[vertex_remap[vertex]] = attribute_list[vertex];
+                    }
+                }
+                attribute_list = std::move(remapped_attribute_list);
+            };
+
+            remap_attribute(mesh.position_list);
+            remap_attribute(mesh.normal_list);
+            remap_attribute(mesh.tangent_list);
+            remap_attribute(mesh.texture_coord_list);
+        }
+
+        class SourceAssetCooker
+        {
+        public:
+            SourceAssetCooker(
+                const std::filesystem::path& source_directory,
+                const std::filesystem::path& output_directory,
+                const xar_engine::asset::IModelLoader& model_loader,
+                const xar_engine::asset::IImageLoader& image_loader)
+                : _source_directory(source_directory)
+                , _output_directory(output_directory)
+                , _model_loader(model_loader)
+                , _image_loader(image_loader)
+            {
+            }
+
+            [[nodiscard]]
+            CookResult cook(
+                const SourceAsset& source_asset,
+                const CookDatabase& cook_database) const
+            {
+                try
+                {
+                    const auto source_path = _source_directory / source_asset.relative_path;
+
+                    auto cook_record = CookRecord{
+                        get_output_relative_path(source_asset),
+                        hash_dependencies(source_asset)
+                    };
+
+                    const auto output_path = _output_directory / cook_record.output_path;
+                    if (std::filesystem::exists(output_path) &&
+                        cook_database.is_up_to_date(
+                            source_asset.relative_path,
+                            cook_record.dependency_hash_list))
+                    {
+                        return {
+                            std::move(cook_record),
+                            true,
+                            {}
+                        };
+                    }
+
+                    std::filesystem::create_directories(output_path.parent_path());
+                    switch (source_asset.asset_type)
+                    {
+                        case EAssetType::MODEL:
+                        {
+                            auto model = _model_loader.load_model_from_file(source_path);
+                            for (auto& mesh: model.mesh_list)
+                            {
+                                optimize_vertex_fetch(mesh);
+                            }
+
+                            xar_engine::asset::xmesh::write_model_to_file(
+                                model,
+                                output_path);
+                            break;
+                        }
+                        case EAssetType::IMAGE:
+                        {
+                            xar_engine::asset::xtex::write_image_to_file(
+                                _image_loader.load_image_from_file(source_path),
+                                output_path);
+                            break;
+                        }
+                    }
+
+                    return {
+                        std::move(cook_record),
+                        false,
+                        {}
+                    };
+                }
+                catch (const std::exception& exception)
+                {
+                    return {
+                        std::nullopt,
+                        false,
+                        exception.what()
+                    };
+                }
+            }
+
+        private:
+            [[nodiscard]]
+            static std::filesystem::path get_output_relative_path(const SourceAsset& source_asset)
+            {
+                auto output_path = source_asset.relative_path;
+                output_path += source_asset.asset_type == EAssetType::MODEL
+                               ? xar_engine::asset::xmesh::FILE_EXTENSION
+                               : xar_engine::asset::xtex::FILE_EXTENSION;
+
+                return output_path;
+            }
+
+            [[nodiscard]]
+            std::vector<DependencyHash> hash_dependencies(const SourceAsset& source_asset) const
+            {
+                const auto source_path = _source_directory / source_asset.relative_path;
+
+                auto dependency_path_list = std::vector<std::filesystem::path>{source_path};
+                if (source_asset.relative_path.extension() == ".obj")
+                {
+                    std::ranges::copy(
+                        find_obj_material_libraries(source_path),
+                        std::back_inserter(dependency_path_list));
+                }
+
+                auto dependency_hash_list = std::vector<DependencyHash>{};
+                for (const auto& dependency_path: dependency_path_list)
+                {
+                    dependency_hash_list.push_back(
+                        {
+                            std::filesystem::relative(
+                                dependency_path,
+                                _source_directory),
+                            hash_file_content(dependency_path)
+                        });
+                }
+
+                return dependency_hash_list;
+            }
+
+        private:
+            const std::filesystem::path& _source_directory;
+            const std::filesystem::path& _output_directory;
+            const xar_engine::asset::IModelLoader& _model_loader;
+            const xar_engine::asset::IImageLoader& _image_loader;
+        };
+    }
+
+    AssetCooker::AssetCooker(const Parameters& parameters)
+        : _source_directory(parameters.source_directory)
+        , _output_directory(parameters.output_directory)
+        , _thread_pool(parameters.thread_pool)
+    {
+    }
+
+    CookSummary AssetCooker::cook()
+    {
+        auto source_asset_list = std::vector<SourceAsset>{};
+        for (const auto& directory_entry: std::filesystem::recursive_directory_iterator{_source_directory})
+        {
+            if (!directory_entry.is_regular_file())
+            {
+                continue;
+            }
+
+            const auto asset_type = get_asset_type(directory_entry.path());
+            if (asset_type)
+            {
+                source_asset_list.push_back(
+                    {
+                        std::filesystem::relative(
+                            directory_entry.path(),
+                            _source_directory),
+                        *asset_type
+                    });
+            }
+        }
+
+        std::filesystem::create_directories(_output_directory);
+        const auto cook_database_path = _output_directory / COOK_DATABASE_FILENAME;
+        auto cook_database = CookDatabase::load_from_file(cook_database_path);
+
+        // Loaders parallelize internally on their own pool, the cooker's pool runs one asset per task.
+        auto loader_thread_pool = std::make_shared<xar_engine::thread::ThreadPool>(xar_engine::thread::ThreadPool::get_default_worker_count());
+        auto extension_model_loader = std::make_unique<xar_engine::asset::ExtensionModelLoader>(std::make_unique<xar_engine::asset::AssimpModelLoader>(loader_thread_pool));
+        extension_model_loader->add_model_loader(
+            ".obj",
+            std::make_unique<xar_engine::asset::ObjModelLoader>(loader_thread_pool));
+        const auto model_loader = xar_engine::asset::MeshProcessingModelLoader{
+            std::move(extension_model_loader),
+            loader_thread_pool
+        };
+        const auto image_loader = xar_engine::asset::ImageLoaderFactory().make();
+
+        const auto source_asset_cooker = SourceAssetCooker{
+            _source_directory,
+            _output_directory,
+            model_loader,
+            *image_loader
+        };
+
+        auto cook_result_list = std::vector<CookResult>(source_asset_list.size());
+        _thread_pool.parallel_for(
+            source_asset_list.size(),
+            [&](std::size_t source_asset_index)
+            {
+                cook_result_list[source_asset_index] = source_asset_cooker.cook(
+                    source_asset_list[source_asset_index],
+                    cook_database);
+            });
+
+        auto cook_summary = CookSummary{0, 0, 0};
+        auto cooked_source_path_list = std::vector<std::filesystem::path>{};
+        for (auto source_asset_index = std::size_t{0}; source_asset_index < source_asset_list.size(); ++source_asset_index)
+        {
+            const auto& source_asset = source_asset_list[source_asset_index];
+            auto& cook_result = cook_result_list[source_asset_index];
+
+            if (!cook_result.cook_record)
+            {
+                ++cook_summary.failed_count;
+                XAR_LOG(
+                    xar_engine::logging::LogLevel::ERROR,
+                    tag,
+                    "Failed to cook '{}': {}",
+                    source_asset.relative_path.string(),
+                    cook_result.error_message);
+                continue;
+            }
+
+            if (cook_result.is_up_to_date)
+            {
+                ++cook_summary.up_to_date_count;
+            }
+            else
+            {
+                ++cook_summary.cooked_count;
+                XAR_LOG(
+                    xar_engine::logging::LogLevel::INFO,
+                    tag,
+                    "Cooked '{}' into '{}'",
+                    source_asset.relative_path.string(),
+                    cook_result.cook_record->output_path.string());
+            }
+
+            cooked_source_path_list.push_back(source_asset.relative_path);
+            cook_database.set_record(
+                source_asset.relative_path,
+                std::move(*cook_result.cook_record));
+        }
+
+        cook_database.remove_records_except(cooked_source_path_list);
+        cook_database.save_to_file(cook_database_path);
+
+        return cook_summary;
+    }
+
+    void AssetCooker::pack(const std::filesystem::path& pak_path)
+    {
+        const auto compression = xar_engine::file::pak::is_compression_supported(xar_engine::file::EPakCompression::LZ4)
+                                 ? xar_engine::file::EPakCompression::LZ4
+                                 : xar_engine::file::EPakCompression::NONE;
+
+        auto pak_archive_writer = xar_engine::file::PakArchiveWriter{};
+        for (const auto& directory_entry: std::filesystem::recursive_directory_iterator{_output_directory})
+        {
+            const auto extension = directory_entry.path().extension();
+            if (!directory_entry.is_regular_file() ||
+                (extension != xar_engine::asset::xmesh::FILE_EXTENSION && extension != xar_engine::asset::xtex::FILE_EXTENSION))
+            {
+                continue;
+            }
+
+            const auto memory_mapped_file = xar_engine::file::MemoryMappedFile{directory_entry.path()};
+            const auto bytes = memory_mapped_file.get_bytes();
+
+            pak_archive_writer.add_file(
+                std::filesystem::relative(
+                    directory_entry.path(),
+                    _output_directory).generic_string(),
+                {
+                    bytes.begin(),
+                    bytes.end()
+                },
+                compression);
+        }
+
+        pak_archive_writer.write_to_file(
+            pak_path,
+            _thread_pool);
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_asset_cooker
+{
+    struct CookSummary
+    {
+        std::uint32_t cooked_count;
+        std::uint32_t up_to_date_count;
+        std::uint32_t failed_count;
+    };
+
+    // Converts every model and image below the source directory into the engine's runtime formats
+    // (.xmesh and .xtex) in the same relative location below the output directory.
+    class AssetCooker
+    {
+    public:
+        struct Parameters;
+
+    public:
+        explicit AssetCooker(const Parameters& parameters);
+
+
+        CookSummary cook();
+
+        // Packs every cooked asset into one pak archive, keyed by its path relative to the output directory.
+        void pack(const std::filesystem::path& pak_path);
+
+    private:
+        std::filesystem::path _source_directory;
+        std::filesystem::path _output_directory;
+        xar_engine::thread::ThreadPool& _thread_pool;
+    };
+
+    struct AssetCooker::Parameters
+    {
+        std::filesystem::path source_directory;
+        std::filesystem::path output_directory;
+        xar_engine::thread::ThreadPool& thread_pool;
+    };
+}
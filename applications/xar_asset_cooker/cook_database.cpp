@@ -0,0 +1,142 @@
+#include "cook_database.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/file/memory_mapped_file.hpp>
+
+
+namespace xar_asset_cooker
+{
+    namespace
+    {
+        // Bump when the cooked formats or the cooking steps change, so every asset is cooked again.
+        constexpr auto COOKER_VERSION = std::uint64_t{4};
+
+        constexpr auto FNV_OFFSET_BASIS = std::uint64_t{0xCBF29CE484222325};
+        constexpr auto FNV_PRIME = std::uint64_t{0x100000001B3};
+
+        constexpr auto ASSET_KEYWORD = "asset";
+        constexpr auto DEPENDENCY_KEYWORD = "dependency";
+    }
+
+    CookDatabase CookDatabase::load_from_file(const std::filesystem::path& path)
+    {
+        auto cook_database = CookDatabase{};
+
+        auto file = std::ifstream{path};
+        if (!file.is_open())
+        {
+            return cook_database;
+        }
+
+        auto* cook_record = static_cast<CookRecord*>(nullptr);
+        for (auto line = std::string{}; std::getline(file, line);)
+        {
+            auto line_stream = std::istringstream{line};
+
+            auto keyword = std::string{};
+            std::getline(line_stream, keyword, '\t');
+            if (keyword == ASSET_KEYWORD)
+            {
+                auto source_path = std::string{};
+                auto output_path = std::string{};
+                std::getline(line_stream, source_path, '\t');
+                std::getline(line_stream, output_path, '\t');
+
+                cook_record = &cook_database._cook_record_map[source_path];
+                cook_record->output_path = std::filesystem::path{output_path};
+            }
+            else if (keyword == DEPENDENCY_KEYWORD && cook_record != nullptr)
+            {
+                auto dependency_path = std::string{};
+                auto content_hash = std::string{};
+                std::getline(line_stream, dependency_path, '\t');
+                std::getline(line_stream, content_hash, '\t');
+
+                cook_record->dependency_hash_list.push_back(
+                    {
+                        std::filesystem::path{dependency_path},
+                        std::stoull(content_hash, nullptr, 16)
+                    });
+            }
+        }
+
+        return cook_database;
+    }
+
+    void CookDatabase::save_to_file(const std::filesystem::path& path) const
+    {
+        auto file = std::ofstream{
+            path,
+            std::ios::trunc
+        };
+        XAR_THROW_IF(
+            !file.is_open(),
+            xar_engine::error::XarException,
+            "Failed to open cook database '{}' for writing",
+            path.string());
+
+        for (const auto& [source_path, cook_record]: _cook_record_map)
+        {
+            file << ASSET_KEYWORD << '\t' << source_path << '\t' << cook_record.output_path.generic_string() << '\n';
+            for (const auto& dependency_hash: cook_record.dependency_hash_list)
+            {
+                file << DEPENDENCY_KEYWORD << '\t' << dependency_hash.path.generic_string() << '\t' << std::hex << dependency_hash.content_hash << std::dec << '\n';
+            }
+        }
+    }
+
+    bool CookDatabase::is_up_to_date(
+        const std::filesystem::path& source_path,
+        const std::vector<DependencyHash>& dependency_hash_list) const
+    {
+        const auto cook_record_it = _cook_record_map.find(source_path.generic_string());
+        if (cook_record_it == _cook_record_map.end())
+        {
+            return false;
+        }
+
+        return cook_record_it->second.dependency_hash_list == dependency_hash_list;
+    }
+
+    void CookDatabase::set_record(
+        const std::filesystem::path& source_path,
+        CookRecord cook_record)
+    {
+        _cook_record_map[source_path.generic_string()] = std::move(cook_record);
+    }
+
+    void CookDatabase::remove_records_except(const std::vector<std::filesystem::path>& source_path_list)
+    {
+        auto source_path_set = std::unordered_set<std::string>{};
+        for (const auto& source_path: source_path_list)
+        {
+            source_path_set.insert(source_path.generic_string());
+        }
+
+        std::erase_if(
+            _cook_record_map,
+            [&source_path_set](const auto& cook_record_entry)
+            {
+                return !source_path_set.contains(cook_record_entry.first);
+            });
+    }
+
+
+    std::uint64_t hash_file_content(const std::filesystem::path& path)
+    {
+        const auto memory_mapped_file = xar_engine::file::MemoryMappedFile{path};
+
+        auto content_hash = FNV_OFFSET_BASIS ^ COOKER_VERSION;
+        for (const auto byte: memory_mapped_file.get_bytes())
+        {
+            content_hash = (content_hash ^ byte) * FNV_PRIME;
+        }
+
+        return content_hash;
+    }
+}
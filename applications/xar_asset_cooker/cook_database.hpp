@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace xar_asset_cooker
+{
+    struct DependencyHash
+    {
+        std::filesystem::path path;
+        std::uint64_t content_hash;
+
+        bool operator==(const DependencyHash& other) const = default;
+    };
+
+    struct CookRecord
+    {
+        std::filesystem::path output_path;
+        std::vector<DependencyHash> dependency_hash_list;
+    };
+
+    // Remembers, for every cooked source, which output it produced and the content hashes of all files
+    // it was cooked from. Stored as a line based text file next to the cooked assets.
+    class CookDatabase
+    {
+    public:
+        [[nodiscard]]
+        static CookDatabase load_from_file(const std::filesystem::path& path);
+
+        void save_to_file(const std::filesystem::path& path) const;
+
+
+        [[nodiscard]]
+        bool is_up_to_date(
+            const std::filesystem::path& source_path,
+            const std::vector<DependencyHash>& dependency_hash_list) const;
+
+        void set_record(
+            const std::filesystem::path& source_path,
+            CookRecord cook_record);
+
+        void remove_records_except(const std::vector<std::filesystem::path>& source_path_list);
+
+    private:
+        std::unordered_map<std::string, CookRecord> _cook_record_map;
+    };
+
+
+    [[nodiscard]]
+    std::uint64_t hash_file_content(const std::filesystem::path& path);
+}
@@ -0,0 +1,59 @@
+#include <cstdlib>
+#include <exception>
+
+#include <xar_engine/logging/logger.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+#include "asset_cooker.hpp"
+
+
+int main(
+    int argc,
+    char** argv)
+{
+    if (argc != 3 && argc != 4)
+    {
+        XAR_LOG(
+            xar_engine::logging::LogLevel::ERROR,
+            "AssetCooker",
+            "Usage: xar_asset_cooker <source directory> <output directory> [pak archive]");
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{xar_engine::thread::ThreadPool::get_default_worker_count()};
+        auto asset_cooker = xar_asset_cooker::AssetCooker{
+            {
+                argv[1],
+                argv[2],
+                thread_pool
+            }};
+
+        const auto cook_summary = asset_cooker.cook();
+        XAR_LOG(
+            xar_engine::logging::LogLevel::INFO,
+            "AssetCooker",
+            "Cooked {}, up to date {}, failed {}",
+            cook_summary.cooked_count,
+            cook_summary.up_to_date_count,
+            cook_summary.failed_count);
+
+        if (argc == 4)
+        {
+            asset_cooker.pack(argv[3]);
+        }
+
+        return cook_summary.failed_count == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const std::exception& exception)
+    {
+        XAR_LOG(
+            xar_engine::logging::LogLevel::CRITICAL,
+            "AssetCooker",
+            "{}",
+            exception.what());
+        return EXIT_FAILURE;
+    }
+}
@@ -1,5 +1,5 @@
 from conan import ConanFile
-from conan.tools.cmake import CMake, cmake_layout
+from conan.tools.cmake import CMake, CMakeDeps, CMakeToolchain, cmake_layout
 from conan.tools.build import cross_building
 
 
@@ -9,12 +9,15 @@ class XarEngine(ConanFile):
     author = "michal.wendel@gmail.com"
 
     settings = "os", "compiler", "build_type", "arch"
-    generators = "CMakeDeps", "CMakeToolchain"
     options = {
         "shared": [True, False],
+        "with_lz4": [True, False],
+        "with_zstd": [True, False],
     }
     default_options = {
         "shared": False,
+        "with_lz4": False,
+        "with_zstd": False,
     }
 
     def configure(self):
@@ -99,11 +102,23 @@ class XarEngine(ConanFile):
         self.requires("fmt/11.0.0")
         # self.requires("gperftools/2.16")  # https://github.com/gperftools/gperftools
         self.requires("glfw/3.4")
-        self.requires("glm/1.0.1")
         self.requires("gtest/1.15.0")
         self.requires("stb/cci.20240531")
         self.requires("volk/1.3.296.0")
 
+        if self.options.with_lz4:
+            self.requires("lz4/1.10.0")
+        if self.options.with_zstd:
+            self.requires("zstd/1.5.6")
+
+    def generate(self):
+        CMakeDeps(self).generate()
+
+        toolchain = CMakeToolchain(self)
+        toolchain.cache_variables["XAR_ENGINE_WITH_LZ4"] = bool(self.options.with_lz4)
+        toolchain.cache_variables["XAR_ENGINE_WITH_ZSTD"] = bool(self.options.with_zstd)
+        toolchain.generate()
+
     def layout(self):
         cmake_layout(self)
 
@@ -1,14 +1,27 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <vector>
 
+#include <xar_engine/meta/enum.hpp>
+
 
 namespace xar_engine::asset
 {
+    enum class EPixelFormat
+    {
+        R8,
+        R8G8,
+        R8G8B8A8,
+        R16_FLOAT,
+        R16G16B16A16_FLOAT,
+    };
+
     struct Image
     {
         std::vector<std::uint8_t> bytes;
+        EPixelFormat pixel_format;
         std::uint32_t channel_count;
         std::uint32_t pixel_width;
         std::uint32_t pixel_height;
@@ -18,5 +31,36 @@ namespace xar_engine::asset
 
 namespace xar_engine::asset::image
 {
+    std::uint32_t get_channel_count(EPixelFormat pixel_format);
+    std::uint32_t get_pixel_byte_size(EPixelFormat pixel_format);
+
     std::uint32_t get_byte_size(const Image& image);
+    std::uint32_t get_mip_level_count(
+        std::uint32_t pixel_width,
+        std::uint32_t pixel_height);
+
+    // Four-channel format of the same bit depth.
+    EPixelFormat get_four_channel_pixel_format(EPixelFormat pixel_format);
+
+    // Expands grey pixels to RGBA by replicating grey into RGB, alpha is taken from the second channel or set to
+    // one. target_bytes must hold the same number of pixels in get_four_channel_pixel_format(pixel_format).
+    void expand_to_four_channels(
+        EPixelFormat pixel_format,
+        std::span<const std::uint8_t> source_bytes,
+        std::span<std::uint8_t> target_bytes);
+
+    // Copies the source pixels to target_offset of a larger target image and fills the remaining target pixels
+    // with the nearest source edge pixel, so filtering across the source border never reads unrelated pixels.
+    void copy_with_edge_border(
+        EPixelFormat pixel_format,
+        std::uint32_t source_width,
+        std::uint32_t source_height,
+        std::span<const std::uint8_t> source_bytes,
+        std::uint32_t target_width,
+        std::uint32_t target_height,
+        std::uint32_t target_offset_x,
+        std::uint32_t target_offset_y,
+        std::span<std::uint8_t> target_bytes);
 }
+
+ENUM_TO_STRING(xar_engine::asset::EPixelFormat);
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
+#include <vector>
 
 #include <xar_engine/asset/image.hpp>
 
+#include <xar_engine/thread/executor.hpp>
+#include <xar_engine/thread/task.hpp>
+
 
 namespace xar_engine::asset
 {
@@ -14,6 +19,18 @@ namespace xar_engine::asset
 
         [[nodiscard]]
         virtual Image load_image_from_file(const std::filesystem::path& path) const = 0;
+
+        // Loaders that can batch file reads override this, the default loads the files one by one.
+        [[nodiscard]]
+        virtual std::vector<Image> load_image_list_from_file(const std::vector<std::filesystem::path>& path_list) const;
+
+        // Loads the image on worker_executor and resumes on resume_executor, also when the load throws. The loader
+        // has to outlive the task.
+        [[nodiscard]]
+        thread::TTask<Image> load_image_async(
+            std::filesystem::path path,
+            thread::IExecutor& worker_executor,
+            thread::IExecutor& resume_executor) const;
     };
 
     class IImageLoaderFactory
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <xar_engine/asset/model.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_engine::asset::mesh
+{
+    [[nodiscard]]
+    BoundingVolume compute_bounding_volume(std::span<const math::Vector3f> position_list);
+    [[nodiscard]]
+    BoundingVolume merge_bounding_volumes(std::span<const BoundingVolume> bounding_volume_list);
+
+    // Area weighted average of the adjacent face normals.
+    [[nodiscard]]
+    std::vector<math::Vector3f> compute_smooth_normals(
+        std::span<const math::Vector3f> position_list,
+        std::span<const std::uint32_t> index_list);
+
+    // Follows the MikkTSpace conventions: face tangents are projected onto the vertex normal plane and
+    // weighted by the corner angle, w holds the bitangent sign. Vertices are not split on mirrored UVs.
+    [[nodiscard]]
+    std::vector<math::Vector4f> compute_tangents(
+        std::span<const math::Vector3f> position_list,
+        std::span<const math::Vector3f> normal_list,
+        std::span<const math::Vector2f> texture_coord_list,
+        std::span<const std::uint32_t> index_list);
+
+    // Adds a single identity root node owning every mesh when the loader produced no hierarchy,
+    // otherwise checks that parents precede children and that mesh references are in range.
+    void process_node_list(Model& model);
+
+    // Import stage: fills missing normals, tangents when texture coordinates exist and the bounding volume.
+    void process_mesh(Mesh& mesh);
+    void process_model(Model& model);
+    // Processes the meshes in parallel, must not be called from a task running on the same pool.
+    void process_model(
+        Model& model,
+        thread::ThreadPool& thread_pool);
+}
@@ -9,13 +9,45 @@
 
 namespace xar_engine::asset
 {
+    struct BoundingVolume
+    {
+        math::Vector3f box_min;
+        math::Vector3f box_max;
+
+        math::Vector3f sphere_center;
+        float sphere_radius;
+    };
+
     struct Mesh
     {
         std::vector<math::Vector3f> position_list;
         std::vector<math::Vector3f> normal_list;
+        // Unit tangent in xyz, w is the bitangent sign: bitangent = w * cross(normal, tangent).
+        std::vector<math::Vector4f> tangent_list;
         std::vector<math::Vector2f> texture_coord_list;
 
         std::vector<std::uint32_t> index_list;
+
+        BoundingVolume bounding_volume;
+    };
+
+    inline constexpr auto NO_PARENT_NODE_INDEX = std::int32_t{-1};
+
+    // Node hierarchy flattened into parallel lists indexed by node. Parents always precede their
+    // children, so world transforms resolve in a single forward pass over the lists.
+    struct ModelNodeList
+    {
+        std::vector<std::int32_t> parent_index_list;
+
+        std::vector<math::Vector3f> translation_list;
+        // Unit quaternion (x, y, z, w).
+        std::vector<math::Vector4f> rotation_list;
+        std::vector<math::Vector3f> scale_list;
+
+        // Meshes of node i are mesh_index_list[mesh_index_offset_list[i], mesh_index_offset_list[i] + mesh_index_count_list[i]).
+        std::vector<std::uint32_t> mesh_index_offset_list;
+        std::vector<std::uint32_t> mesh_index_count_list;
+        std::vector<std::uint32_t> mesh_index_list;
     };
 
     struct ModelMetadata
@@ -27,5 +59,9 @@ namespace xar_engine::asset
     {
         ModelMetadata metadata;
         std::vector<Mesh> mesh_list;
+        ModelNodeList node_list;
+
+        // Union of the mesh bounding volumes in mesh space, node transforms are not applied.
+        BoundingVolume bounding_volume;
     };
 }
\ No newline at end of file
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 
 #include <xar_engine/asset/model.hpp>
 
+#include <xar_engine/thread/executor.hpp>
+#include <xar_engine/thread/task.hpp>
+
 
 namespace xar_engine::asset
 {
@@ -14,6 +18,14 @@ namespace xar_engine::asset
 
         [[nodiscard]]
         virtual Model load_model_from_file(const std::filesystem::path& path) const = 0;
+
+        // Loads the model on worker_executor and resumes on resume_executor, also when the load throws. The loader
+        // has to outlive the task.
+        [[nodiscard]]
+        thread::TTask<Model> load_model_async(
+            std::filesystem::path path,
+            thread::IExecutor& worker_executor,
+            thread::IExecutor& resume_executor) const;
     };
 
     class IModelLoaderFactory
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <array>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/math/epsilon.hpp>
+#include <xar_engine/math/matrix.hpp>
+#include <xar_engine/math/simd.hpp>
+#include <xar_engine/math/vector.hpp>
+
+
+namespace xar_engine::math
+{
+    // Affine transform stored as the top three rows of a 4x4 matrix, the last row is implied (0, 0, 0, 1).
+    // Row-major, so it takes 48 bytes instead of 64 and maps onto a GLSL mat3x4 or HLSL float3x4 directly.
+    struct alignas(16) Affine3x4f
+    {
+        std::array<Vector4f, 3> as_row_list;
+    };
+
+    static_assert(sizeof(Affine3x4f) == sizeof(float) * 12);
+
+
+    constexpr bool operator==(
+        const Affine3x4f& left,
+        const Affine3x4f& right)
+    {
+        return left.as_row_list == right.as_row_list;
+    }
+
+    constexpr bool operator!=(
+        const Affine3x4f& left,
+        const Affine3x4f& right)
+    {
+        return !(left == right);
+    }
+
+
+    // Plain C++ reference implementations, used in constant evaluation and where no simd kernel exists.
+    namespace kernel::scalar
+    {
+        constexpr Affine3x4f multiply_affine(
+            const Affine3x4f& left,
+            const Affine3x4f& right)
+        {
+            auto result = Affine3x4f{};
+            for (auto row = 0; row < 3; ++row)
+            {
+                const auto& left_row = left.as_row_list[row];
+                result.as_row_list[row] = scalar::add_vector(
+                    scalar::add_vector(
+                        scalar::scale_vector(
+                            right.as_row_list[0],
+                            left_row.x),
+                        scalar::scale_vector(
+                            right.as_row_list[1],
+                            left_row.y)),
+                    scalar::scale_vector(
+                        right.as_row_list[2],
+                        left_row.z));
+                result.as_row_list[row].w += left_row.w;
+            }
+
+            return result;
+        }
+
+        // The inverse of the 3x3 block has the cross products of its rows as columns, scaled by 1 / determinant.
+        constexpr bool inverse_affine(
+            const Affine3x4f& affine,
+            Affine3x4f& result)
+        {
+            const auto& row_list = affine.as_row_list;
+            const auto column_0 = scalar::cross_product(
+                row_list[1],
+                row_list[2]);
+            const auto column_1 = scalar::cross_product(
+                row_list[2],
+                row_list[0]);
+            const auto column_2 = scalar::cross_product(
+                row_list[0],
+                row_list[1]);
+
+            const auto determinant =
+                row_list[0].x * column_0.x + row_list[0].y * column_0.y + row_list[0].z * column_0.z;
+            if (determinant == 0.0f)
+            {
+                return false;
+            }
+
+            const auto inverse_determinant = 1.0f / determinant;
+            const auto translation = Vector4f{row_list[0].w, row_list[1].w, row_list[2].w, 0.0f};
+            result.as_row_list = {{
+                {column_0.x, column_1.x, column_2.x, 0.0f},
+                {column_0.y, column_1.y, column_2.y, 0.0f},
+                {column_0.z, column_1.z, column_2.z, 0.0f},
+            }};
+            for (auto& row: result.as_row_list)
+            {
+                row = scalar::scale_vector(
+                    row,
+                    inverse_determinant);
+                row.w = -scalar::dot_product(
+                    row,
+                    translation);
+            }
+
+            return true;
+        }
+    }
+
+    namespace kernel::simd
+    {
+    #if defined(XAR_ENGINE_MATH_SSE)
+        inline Affine3x4f multiply_affine(
+            const Affine3x4f& left,
+            const Affine3x4f& right)
+        {
+            const __m128 right_row_list[4] = {
+                detail::load(right.as_row_list[0]),
+                detail::load(right.as_row_list[1]),
+                detail::load(right.as_row_list[2]),
+                _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f),
+            };
+
+            auto result = Affine3x4f{};
+            for (auto row = 0; row < 3; ++row)
+            {
+                result.as_row_list[row] = detail::store(
+                    detail::transform(
+                        right_row_list,
+                        detail::load(left.as_row_list[row])));
+            }
+
+            return result;
+        }
+
+        inline bool inverse_affine(
+            const Affine3x4f& affine,
+            Affine3x4f& result)
+        {
+            const auto column_0 = simd::cross_product(
+                affine.as_row_list[1],
+                affine.as_row_list[2]);
+            const auto column_1 = simd::cross_product(
+                affine.as_row_list[2],
+                affine.as_row_list[0]);
+            const auto column_2 = simd::cross_product(
+                affine.as_row_list[0],
+                affine.as_row_list[1]);
+
+            // The cross products have w = 0, so the w of the first row drops out of the dot product.
+            const auto determinant = simd::dot_product(
+                affine.as_row_list[0],
+                column_0);
+            if (determinant == 0.0f)
+            {
+                return false;
+            }
+
+            auto row_0 = detail::load(column_0);
+            auto row_1 = detail::load(column_1);
+            auto row_2 = detail::load(column_2);
+            auto row_3 = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(row_0, row_1, row_2, row_3);
+
+            const auto inverse_determinant = _mm_set1_ps(1.0f / determinant);
+            const auto translation = _mm_setr_ps(
+                affine.as_row_list[0].w,
+                affine.as_row_list[1].w,
+                affine.as_row_list[2].w,
+                0.0f);
+
+            const __m128 row_list[3] = {row_0, row_1, row_2};
+            for (auto row = 0; row < 3; ++row)
+            {
+                const auto inverse_row = _mm_mul_ps(
+                    row_list[row],
+                    inverse_determinant);
+                result.as_row_list[row] = detail::store(inverse_row);
+                result.as_row_list[row].w = -_mm_cvtss_f32(
+                    detail::dot_product(
+                        inverse_row,
+                        translation));
+            }
+
+            return true;
+        }
+    #else
+        inline Affine3x4f multiply_affine(
+            const Affine3x4f& left,
+            const Affine3x4f& right)
+        {
+            return scalar::multiply_affine(
+                left,
+                right);
+        }
+
+        inline bool inverse_affine(
+            const Affine3x4f& affine,
+            Affine3x4f& result)
+        {
+            return scalar::inverse_affine(
+                affine,
+                result);
+        }
+    #endif
+    }
+
+
+    constexpr Affine3x4f make_identity_affine()
+    {
+        auto affine = Affine3x4f{};
+        affine.as_row_list = {{
+            {1.0f, 0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f, 0.0f},
+        }};
+
+        return affine;
+    }
+
+    // Drops the last row, which must be (0, 0, 0, 1).
+    constexpr Affine3x4f make_affine_from_matrix(const Matrix4x4f& matrix)
+    {
+        const auto& column_list = matrix.as_column_list;
+
+        auto affine = Affine3x4f{};
+        affine.as_row_list = {{
+            {column_list[0].x, column_list[1].x, column_list[2].x, column_list[3].x},
+            {column_list[0].y, column_list[1].y, column_list[2].y, column_list[3].y},
+            {column_list[0].z, column_list[1].z, column_list[2].z, column_list[3].z},
+        }};
+
+        return affine;
+    }
+
+    constexpr Matrix4x4f make_matrix_from_affine(const Affine3x4f& affine)
+    {
+        const auto& row_list = affine.as_row_list;
+
+        auto matrix = Matrix4x4f{};
+        matrix.as_column_list = {{
+            {row_list[0].x, row_list[1].x, row_list[2].x, 0.0f},
+            {row_list[0].y, row_list[1].y, row_list[2].y, 0.0f},
+            {row_list[0].z, row_list[1].z, row_list[2].z, 0.0f},
+            {row_list[0].w, row_list[1].w, row_list[2].w, 1.0f},
+        }};
+
+        return matrix;
+    }
+
+    constexpr Affine3x4f operator*(
+        const Affine3x4f& left,
+        const Affine3x4f& right)
+    {
+        if consteval
+        {
+            return kernel::scalar::multiply_affine(
+                left,
+                right);
+        }
+        else
+        {
+            return kernel::simd::multiply_affine(
+                left,
+                right);
+        }
+    }
+
+    constexpr Vector3f transform_point(
+        const Affine3x4f& affine,
+        const Vector3f& point)
+    {
+        const auto point4 = Vector4f{point.x, point.y, point.z, 1.0f};
+
+        return {
+            dot_product(
+                affine.as_row_list[0],
+                point4),
+            dot_product(
+                affine.as_row_list[1],
+                point4),
+            dot_product(
+                affine.as_row_list[2],
+                point4),
+        };
+    }
+
+    // Translation is ignored.
+    constexpr Vector3f transform_vector(
+        const Affine3x4f& affine,
+        const Vector3f& vector)
+    {
+        const auto vector4 = Vector4f{vector.x, vector.y, vector.z, 0.0f};
+
+        return {
+            dot_product(
+                affine.as_row_list[0],
+                vector4),
+            dot_product(
+                affine.as_row_list[1],
+                vector4),
+            dot_product(
+                affine.as_row_list[2],
+                vector4),
+        };
+    }
+
+    // Throws when the 3x3 block is singular.
+    constexpr Affine3x4f inverse_affine(const Affine3x4f& affine)
+    {
+        auto result = Affine3x4f{};
+
+        auto is_invertible = false;
+        if consteval
+        {
+            is_invertible = kernel::scalar::inverse_affine(
+                affine,
+                result);
+        }
+        else
+        {
+            is_invertible = kernel::simd::inverse_affine(
+                affine,
+                result);
+        }
+
+        if (!is_invertible)
+        {
+            throw error::XarException{"Affine matrix is not invertible"};
+        }
+
+        return result;
+    }
+}
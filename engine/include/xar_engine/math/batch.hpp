@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <xar_engine/math/geometry.hpp>
+#include <xar_engine/math/matrix.hpp>
+#include <xar_engine/math/simd.hpp>
+#include <xar_engine/math/vector.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_engine::math
+{
+    // Structure-of-arrays view of a Vector3f list, the three spans have the same size.
+    struct Vector3fSoaSpan
+    {
+        std::span<float> x;
+        std::span<float> y;
+        std::span<float> z;
+    };
+
+    struct ConstVector3fSoaSpan
+    {
+        std::span<const float> x;
+        std::span<const float> y;
+        std::span<const float> z;
+    };
+
+
+    struct AabbSoaSpan
+    {
+        std::span<const float> min_x;
+        std::span<const float> min_y;
+        std::span<const float> min_z;
+        std::span<const float> max_x;
+        std::span<const float> max_y;
+        std::span<const float> max_z;
+    };
+
+    struct BoundingSphereSoaSpan
+    {
+        std::span<const float> center_x;
+        std::span<const float> center_y;
+        std::span<const float> center_z;
+        std::span<const float> radius;
+    };
+
+    struct TriangleSoaSpan
+    {
+        std::span<const float> vertex_0_x;
+        std::span<const float> vertex_0_y;
+        std::span<const float> vertex_0_z;
+        std::span<const float> vertex_1_x;
+        std::span<const float> vertex_1_y;
+        std::span<const float> vertex_1_z;
+        std::span<const float> vertex_2_x;
+        std::span<const float> vertex_2_y;
+        std::span<const float> vertex_2_z;
+    };
+
+
+    // Instruction set the structure-of-arrays and point list kernels run with. Picked on first use as the
+    // widest one the processor supports, 16 elements per instruction with AVX512, 8 with AVX2 and 4 with
+    // SSE4_2 or NEON, so one binary uses the wide registers wherever they exist. Results may differ in the
+    // last bits between instruction sets. XAR_ENGINE_MATH_FORCE_SCALAR pins it to SCALAR.
+    [[nodiscard]]
+    kernel::EInstructionSet get_batch_instruction_set();
+
+    [[nodiscard]]
+    bool is_batch_instruction_set_supported(kernel::EInstructionSet instruction_set);
+
+    // Replaces the pick, e.g. to compare the paths in tests and benchmarks. Throws when the build or the
+    // processor does not support the instruction set.
+    void set_batch_instruction_set(kernel::EInstructionSet instruction_set);
+
+
+    // Batch kernels process whole lists per call. The structure-of-arrays overloads run at the width of the
+    // batch instruction set, the Vector3f overloads transform one element per instruction.
+    // The ThreadPool overloads split large inputs into chunks, they must not be called from a task running
+    // on the same pool. Input and result lists must have the same size and may be the same memory.
+
+    void transform_points(
+        std::span<const Vector3f> point_list,
+        const Matrix4x4f& matrix,
+        std::span<Vector3f> result_list);
+    void transform_points(
+        const ConstVector3fSoaSpan& point_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list);
+    void transform_points(
+        const ConstVector3fSoaSpan& point_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list,
+        thread::ThreadPool& thread_pool);
+
+    void transform_vectors(
+        std::span<const Vector3f> vector_list,
+        const Matrix4x4f& matrix,
+        std::span<Vector3f> result_list);
+    void transform_vectors(
+        const ConstVector3fSoaSpan& vector_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list);
+    void transform_vectors(
+        const ConstVector3fSoaSpan& vector_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list,
+        thread::ThreadPool& thread_pool);
+
+    // result_list[i] = left_list[i] * right_list[i]
+    void multiply_matrices(
+        std::span<const Matrix4x4f> left_list,
+        std::span<const Matrix4x4f> right_list,
+        std::span<Matrix4x4f> result_list);
+    // result_list[i] = left * right_list[i]
+    void multiply_matrices(
+        const Matrix4x4f& left,
+        std::span<const Matrix4x4f> right_list,
+        std::span<Matrix4x4f> result_list);
+    void multiply_matrices(
+        const Matrix4x4f& left,
+        std::span<const Matrix4x4f> right_list,
+        std::span<Matrix4x4f> result_list,
+        thread::ThreadPool& thread_pool);
+
+    // Smallest boxes enclosing the transformed boxes, the matrix must be affine.
+    void transform_aabbs(
+        std::span<const Aabb> aabb_list,
+        const Matrix4x4f& matrix,
+        std::span<Aabb> result_list);
+    void transform_aabbs(
+        std::span<const Aabb> aabb_list,
+        const Matrix4x4f& matrix,
+        std::span<Aabb> result_list,
+        thread::ThreadPool& thread_pool);
+
+    // Smallest box enclosing the points, throws for an empty list.
+    [[nodiscard]]
+    Aabb compute_aabb(std::span<const Vector3f> point_list);
+
+    // Largest squared distance from point to any point of the list, 0 for an empty list.
+    [[nodiscard]]
+    float compute_max_distance_squared(
+        std::span<const Vector3f> point_list,
+        const Vector3f& point);
+
+
+    // Batch versions of the intersection tests in geometry.hpp with the same results. Masks hold 1 for
+    // intersecting primitives and 0 otherwise, distance lists hold the hit distance or infinity on a miss.
+
+    void cull_aabbs(
+        const Frustum& frustum,
+        const AabbSoaSpan& aabb_list,
+        std::span<std::uint8_t> visible_list);
+    void cull_aabbs(
+        const Frustum& frustum,
+        const AabbSoaSpan& aabb_list,
+        std::span<std::uint8_t> visible_list,
+        thread::ThreadPool& thread_pool);
+
+    void cull_spheres(
+        const Frustum& frustum,
+        const BoundingSphereSoaSpan& sphere_list,
+        std::span<std::uint8_t> visible_list);
+    void cull_spheres(
+        const Frustum& frustum,
+        const BoundingSphereSoaSpan& sphere_list,
+        std::span<std::uint8_t> visible_list,
+        thread::ThreadPool& thread_pool);
+
+    void intersect_aabbs(
+        const Aabb& aabb,
+        const AabbSoaSpan& aabb_list,
+        std::span<std::uint8_t> overlap_list);
+
+    void intersect_ray(
+        const Ray& ray,
+        const AabbSoaSpan& aabb_list,
+        std::span<float> distance_list);
+    void intersect_ray(
+        const Ray& ray,
+        const TriangleSoaSpan& triangle_list,
+        std::span<float> distance_list);
+}
@@ -1,46 +1,188 @@
 #pragma once
 
+#include <cmath>
+#include <limits>
+
 
 namespace xar_engine::math::epsilon
 {
-    float get_epsilon(float);
-    double get_epsilon(double);
-
-    bool equal(
-        float left,
-        float right);
-    bool not_equal(
-        float left,
-        float right);
-    bool less(
-        float left,
-        float right);
-    bool less_or_equal(
-        float left,
-        float right);
-    bool greater(
-        float left,
-        float right);
-    bool greater_or_equal(
-        float left,
-        float right);
-
-    bool equal(
-        double left,
-        double right);
-    bool not_equal(
-        double left,
-        double right);
-    bool less(
-        double left,
-        double right);
-    bool less_or_equal(
-        double left,
-        double right);
-    bool greater(
-        double left,
-        double right);
-    bool greater_or_equal(
-        double left,
-        double right);
-}
\ No newline at end of file
+    namespace detail
+    {
+        template <typename T>
+        constexpr bool equal_impl(
+            const T left,
+            const T right)
+        {
+            return std::fabs(left - right) <= std::numeric_limits<T>::epsilon();
+        }
+
+        template <typename T>
+        constexpr bool not_equal_impl(
+            const T left,
+            const T right)
+        {
+            return !equal_impl(
+                left,
+                right);
+        }
+
+        template <typename T>
+        constexpr bool less_impl(
+            const T left,
+            const T right)
+        {
+            return not_equal_impl(
+                left,
+                right) && left < right;
+        }
+
+        template <typename T>
+        constexpr bool less_or_equal_impl(
+            const T left,
+            const T right)
+        {
+            return equal_impl(
+                left,
+                right) || left < right;
+        }
+
+        template <typename T>
+        constexpr bool greater_impl(
+            const T left,
+            const T right)
+        {
+            return not_equal_impl(
+                left,
+                right) && left > right;
+        }
+
+        template <typename T>
+        constexpr bool greater_or_equal_impl(
+            const T left,
+            const T right)
+        {
+            return equal_impl(
+                left,
+                right) || left > right;
+        }
+    }
+
+    constexpr float get_epsilon(float)
+    {
+        return std::numeric_limits<float>::epsilon();
+    }
+
+    constexpr bool equal(
+        const float left,
+        const float right)
+    {
+        return detail::equal_impl(
+            left,
+            right);
+    }
+
+    constexpr bool not_equal(
+        const float left,
+        const float right)
+    {
+        return detail::not_equal_impl(
+            left,
+            right);
+    }
+
+    constexpr bool less(
+        const float left,
+        const float right)
+    {
+        return detail::less_impl(
+            left,
+            right);
+    }
+
+    constexpr bool less_or_equal(
+        const float left,
+        const float right)
+    {
+        return detail::less_or_equal_impl(
+            left,
+            right);
+    }
+
+    constexpr bool greater(
+        const float left,
+        const float right)
+    {
+        return detail::greater_impl(
+            left,
+            right);
+    }
+
+    constexpr bool greater_or_equal(
+        const float left,
+        const float right)
+    {
+        return detail::greater_or_equal_impl(
+            left,
+            right);
+    }
+
+
+    constexpr double get_epsilon(double)
+    {
+        return std::numeric_limits<double>::epsilon();
+    }
+
+    constexpr bool equal(
+        const double left,
+        const double right)
+    {
+        return detail::equal_impl(
+            left,
+            right);
+    }
+
+    constexpr bool not_equal(
+        const double left,
+        const double right)
+    {
+        return detail::not_equal_impl(
+            left,
+            right);
+    }
+
+    constexpr bool less(
+        const double left,
+        const double right)
+    {
+        return detail::less_impl(
+            left,
+            right);
+    }
+
+    constexpr bool less_or_equal(
+        const double left,
+        const double right)
+    {
+        return detail::less_or_equal_impl(
+            left,
+            right);
+    }
+
+    constexpr bool greater(
+        const double left,
+        const double right)
+    {
+        return detail::greater_impl(
+            left,
+            right);
+    }
+
+    constexpr bool greater_or_equal(
+        const double left,
+        const double right)
+    {
+        return detail::greater_or_equal_impl(
+            left,
+            right);
+    }
+}
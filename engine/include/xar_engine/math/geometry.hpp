@@ -0,0 +1,433 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+
+#include <xar_engine/math/matrix.hpp>
+#include <xar_engine/math/quaternion.hpp>
+#include <xar_engine/math/vector.hpp>
+
+
+namespace xar_engine::math
+{
+    // Axis aligned bounding box, empty when any component of min is greater than max.
+    struct Aabb
+    {
+        Vector3f min;
+        Vector3f max;
+    };
+
+    struct BoundingSphere
+    {
+        Vector3f center;
+        float radius;
+    };
+
+    // Box with half_extent along the local axes, rotated into place around its center.
+    struct Obb
+    {
+        Vector3f center;
+        Vector3f half_extent;
+        Quaternionf rotation;
+    };
+
+    // Points p with dot(normal, p) + distance >= 0 are in front of the plane, normal is unit length.
+    struct Plane
+    {
+        Vector3f normal;
+        float distance;
+    };
+
+    // Planes face inwards, in left, right, bottom, top, near, far order.
+    struct Frustum
+    {
+        std::array<Plane, 6> plane_list;
+    };
+
+    // Direction does not need to be normalized, hit distances are measured in multiples of it.
+    struct Ray
+    {
+        Vector3f origin;
+        Vector3f direction;
+    };
+
+
+    constexpr float signed_distance(
+        const Plane& plane,
+        const Vector3f& point)
+    {
+        return dot_product(
+            plane.normal,
+            point) + plane.distance;
+    }
+
+    // The normal does not need to be normalized.
+    inline Plane make_plane(
+        const Vector3f& normal,
+        const Vector3f& point)
+    {
+        const auto unit_normal = normalize_vector(normal);
+
+        return {
+            unit_normal,
+            -dot_product(
+                unit_normal,
+                point),
+        };
+    }
+
+    // Gribb-Hartmann extraction for the [0, 1] depth range of make_projection_matrix. A view-projection
+    // matrix gives world space planes, a projection matrix alone gives view space planes.
+    inline Frustum make_frustum(const Matrix4x4f& view_projection)
+    {
+        const auto& column_list = view_projection.as_column_list;
+        const auto get_row = [&](const std::uint32_t index)
+        {
+            return Vector4f{column_list[0][index], column_list[1][index], column_list[2][index], column_list[3][index]};
+        };
+
+        const auto row_0 = get_row(0);
+        const auto row_1 = get_row(1);
+        const auto row_2 = get_row(2);
+        const auto row_3 = get_row(3);
+
+        const Vector4f plane_equation_list[6] = {
+            row_3 + row_0,
+            row_3 - row_0,
+            row_3 + row_1,
+            row_3 - row_1,
+            row_2,
+            row_3 - row_2,
+        };
+
+        auto frustum = Frustum{};
+        for (auto index = 0; index < 6; ++index)
+        {
+            const auto& equation = plane_equation_list[index];
+            const auto inverse_length = 1.0f / vector_length(Vector3f{equation.x, equation.y, equation.z});
+
+            frustum.plane_list[index] = {
+                {equation.x * inverse_length, equation.y * inverse_length, equation.z * inverse_length},
+                equation.w * inverse_length,
+            };
+        }
+
+        return frustum;
+    }
+
+    constexpr Aabb make_aabb_from_sphere(const BoundingSphere& sphere)
+    {
+        const auto radius = Vector3f{sphere.radius, sphere.radius, sphere.radius};
+
+        return {
+            sphere.center - radius,
+            sphere.center + radius,
+        };
+    }
+
+    constexpr Aabb make_aabb_from_obb(const Obb& obb)
+    {
+        const auto rotation_matrix = make_rotation_matrix(obb.rotation);
+        const auto& column_list = rotation_matrix.as_column_list;
+
+        // Every world axis gets the absolute projections of the three scaled local axes.
+        auto extent = Vector3f{};
+        for (auto axis = 0u; axis < 3u; ++axis)
+        {
+            const auto half_extent = axis == 0u ? obb.half_extent.x : axis == 1u ? obb.half_extent.y : obb.half_extent.z;
+            extent.x += (column_list[axis].x < 0.0f ? -column_list[axis].x : column_list[axis].x) * half_extent;
+            extent.y += (column_list[axis].y < 0.0f ? -column_list[axis].y : column_list[axis].y) * half_extent;
+            extent.z += (column_list[axis].z < 0.0f ? -column_list[axis].z : column_list[axis].z) * half_extent;
+        }
+
+        return {
+            obb.center - extent,
+            obb.center + extent,
+        };
+    }
+
+
+    constexpr bool intersects(
+        const Aabb& left,
+        const Aabb& right)
+    {
+        return
+            left.min.x <= right.max.x && left.max.x >= right.min.x &&
+            left.min.y <= right.max.y && left.max.y >= right.min.y &&
+            left.min.z <= right.max.z && left.max.z >= right.min.z;
+    }
+
+    constexpr bool intersects(
+        const BoundingSphere& left,
+        const BoundingSphere& right)
+    {
+        const auto offset = left.center - right.center;
+        const auto radius = left.radius + right.radius;
+
+        return dot_product(
+            offset,
+            offset) <= radius * radius;
+    }
+
+    constexpr bool intersects(
+        const Aabb& aabb,
+        const BoundingSphere& sphere)
+    {
+        const auto closest_point = Vector3f{
+            std::clamp(sphere.center.x, aabb.min.x, aabb.max.x),
+            std::clamp(sphere.center.y, aabb.min.y, aabb.max.y),
+            std::clamp(sphere.center.z, aabb.min.z, aabb.max.z),
+        };
+        const auto offset = sphere.center - closest_point;
+
+        return dot_product(
+            offset,
+            offset) <= sphere.radius * sphere.radius;
+    }
+
+    // Separating axis test over the 3 + 3 face normals and the 9 edge cross products.
+    inline bool intersects(
+        const Obb& left,
+        const Obb& right)
+    {
+        const auto left_matrix = make_rotation_matrix(left.rotation);
+        const auto right_matrix = make_rotation_matrix(right.rotation);
+        const float left_extent[3] = {left.half_extent.x, left.half_extent.y, left.half_extent.z};
+        const float right_extent[3] = {right.half_extent.x, right.half_extent.y, right.half_extent.z};
+
+        const auto get_axis = [](const Matrix4x4f& matrix, const std::uint32_t index)
+        {
+            const auto& column = matrix.as_column_list[index];
+            return Vector3f{column.x, column.y, column.z};
+        };
+
+        // Rotation of right expressed in the frame of left, padded against parallel edge pairs.
+        constexpr auto PARALLEL_EPSILON = 1e-6f;
+        float rotation[3][3];
+        float absolute_rotation[3][3];
+        for (auto i = 0u; i < 3u; ++i)
+        {
+            for (auto j = 0u; j < 3u; ++j)
+            {
+                rotation[i][j] = dot_product(
+                    get_axis(left_matrix, i),
+                    get_axis(right_matrix, j));
+                absolute_rotation[i][j] = std::abs(rotation[i][j]) + PARALLEL_EPSILON;
+            }
+        }
+
+        const auto world_offset = right.center - left.center;
+        const float offset[3] = {
+            dot_product(world_offset, get_axis(left_matrix, 0)),
+            dot_product(world_offset, get_axis(left_matrix, 1)),
+            dot_product(world_offset, get_axis(left_matrix, 2)),
+        };
+
+        for (auto i = 0u; i < 3u; ++i)
+        {
+            const auto right_radius =
+                right_extent[0] * absolute_rotation[i][0] +
+                right_extent[1] * absolute_rotation[i][1] +
+                right_extent[2] * absolute_rotation[i][2];
+            if (std::abs(offset[i]) > left_extent[i] + right_radius)
+            {
+                return false;
+            }
+        }
+
+        for (auto j = 0u; j < 3u; ++j)
+        {
+            const auto left_radius =
+                left_extent[0] * absolute_rotation[0][j] +
+                left_extent[1] * absolute_rotation[1][j] +
+                left_extent[2] * absolute_rotation[2][j];
+            const auto distance = offset[0] * rotation[0][j] + offset[1] * rotation[1][j] + offset[2] * rotation[2][j];
+            if (std::abs(distance) > left_radius + right_extent[j])
+            {
+                return false;
+            }
+        }
+
+        for (auto i = 0u; i < 3u; ++i)
+        {
+            const auto i1 = (i + 1) % 3;
+            const auto i2 = (i + 2) % 3;
+            for (auto j = 0u; j < 3u; ++j)
+            {
+                const auto j1 = (j + 1) % 3;
+                const auto j2 = (j + 2) % 3;
+
+                const auto left_radius = left_extent[i1] * absolute_rotation[i2][j] + left_extent[i2] * absolute_rotation[i1][j];
+                const auto right_radius = right_extent[j1] * absolute_rotation[i][j2] + right_extent[j2] * absolute_rotation[i][j1];
+                const auto distance = offset[i2] * rotation[i1][j] - offset[i1] * rotation[i2][j];
+                if (std::abs(distance) > left_radius + right_radius)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // Conservative: boxes near a frustum corner may be reported as intersecting.
+    constexpr bool intersects(
+        const Frustum& frustum,
+        const Aabb& aabb)
+    {
+        for (const auto& plane: frustum.plane_list)
+        {
+            // The corner furthest along the normal decides whether the whole box is behind the plane.
+            const auto corner = Vector3f{
+                plane.normal.x >= 0.0f ? aabb.max.x : aabb.min.x,
+                plane.normal.y >= 0.0f ? aabb.max.y : aabb.min.y,
+                plane.normal.z >= 0.0f ? aabb.max.z : aabb.min.z,
+            };
+            if (signed_distance(plane, corner) < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool intersects(
+        const Frustum& frustum,
+        const BoundingSphere& sphere)
+    {
+        for (const auto& plane: frustum.plane_list)
+        {
+            if (signed_distance(plane, sphere.center) < -sphere.radius)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool intersects(
+        const Frustum& frustum,
+        const Obb& obb)
+    {
+        const auto rotation_matrix = make_rotation_matrix(obb.rotation);
+        const auto& column_list = rotation_matrix.as_column_list;
+
+        for (const auto& plane: frustum.plane_list)
+        {
+            auto radius = 0.0f;
+            for (auto axis = 0u; axis < 3u; ++axis)
+            {
+                const auto half_extent = axis == 0u ? obb.half_extent.x : axis == 1u ? obb.half_extent.y : obb.half_extent.z;
+                const auto projection = dot_product(
+                    plane.normal,
+                    Vector3f{column_list[axis].x, column_list[axis].y, column_list[axis].z});
+                radius += (projection < 0.0f ? -projection : projection) * half_extent;
+            }
+
+            if (signed_distance(plane, obb.center) < -radius)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    // Slab test, returns the entry distance, or 0 when the origin is inside the box.
+    inline std::optional<float> intersect_ray(
+        const Ray& ray,
+        const Aabb& aabb)
+    {
+        const float origin[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+        const float direction[3] = {ray.direction.x, ray.direction.y, ray.direction.z};
+        const float min[3] = {aabb.min.x, aabb.min.y, aabb.min.z};
+        const float max[3] = {aabb.max.x, aabb.max.y, aabb.max.z};
+
+        auto near_distance = 0.0f;
+        auto far_distance = std::numeric_limits<float>::infinity();
+        for (auto axis = 0; axis < 3; ++axis)
+        {
+            const auto inverse_direction = 1.0f / direction[axis];
+            const auto first_distance = (min[axis] - origin[axis]) * inverse_direction;
+            const auto second_distance = (max[axis] - origin[axis]) * inverse_direction;
+
+            near_distance = std::max(
+                near_distance,
+                std::min(
+                    first_distance,
+                    second_distance));
+            far_distance = std::min(
+                far_distance,
+                std::max(
+                    first_distance,
+                    second_distance));
+        }
+
+        if (near_distance > far_distance)
+        {
+            return std::nullopt;
+        }
+
+        return near_distance;
+    }
+
+    // Moller-Trumbore, both faces are hit.
+    inline std::optional<float> intersect_ray(
+        const Ray& ray,
+        const Vector3f& vertex_0,
+        const Vector3f& vertex_1,
+        const Vector3f& vertex_2)
+    {
+        constexpr auto DETERMINANT_EPSILON = 1e-8f;
+
+        const auto edge_1 = vertex_1 - vertex_0;
+        const auto edge_2 = vertex_2 - vertex_0;
+        const auto p = cross_product(
+            ray.direction,
+            edge_2);
+        const auto determinant = dot_product(
+            edge_1,
+            p);
+        if (std::abs(determinant) < DETERMINANT_EPSILON)
+        {
+            return std::nullopt;
+        }
+
+        const auto inverse_determinant = 1.0f / determinant;
+        const auto s = ray.origin - vertex_0;
+        const auto u = dot_product(
+            s,
+            p) * inverse_determinant;
+        if (u < 0.0f || u > 1.0f)
+        {
+            return std::nullopt;
+        }
+
+        const auto q = cross_product(
+            s,
+            edge_1);
+        const auto v = dot_product(
+            ray.direction,
+            q) * inverse_determinant;
+        if (v < 0.0f || u + v > 1.0f)
+        {
+            return std::nullopt;
+        }
+
+        const auto distance = dot_product(
+            edge_2,
+            q) * inverse_determinant;
+        if (distance < 0.0f)
+        {
+            return std::nullopt;
+        }
+
+        return distance;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+
+namespace xar_engine::math
+{
+    // IEEE 754 binary16 bits of value, rounded to nearest even. Values out of range become infinity, NaN stays a
+    // quiet NaN and values below the smallest normal half are stored as subnormals.
+    constexpr std::uint16_t to_half_float(const float value)
+    {
+        const auto bits = std::bit_cast<std::uint32_t>(value);
+        const auto sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+        const auto magnitude = bits & 0x7fffffffu;
+
+        const auto round_shift_right = [](
+            const std::uint32_t mantissa,
+            const std::uint32_t shift)
+        {
+            const auto result = mantissa >> shift;
+            const auto remainder = mantissa & ((1u << shift) - 1u);
+            const auto halfway = 1u << (shift - 1u);
+
+            return (remainder > halfway || (remainder == halfway && (result & 1u) != 0))
+                   ? result + 1u
+                   : result;
+        };
+
+        if (magnitude >= 0x7f800000u)
+        {
+            return sign | (magnitude > 0x7f800000u ? 0x7e00u : 0x7c00u);
+        }
+
+        // 65520 is the first value that rounds past the largest half, 65504.
+        if (magnitude >= 0x477ff000u)
+        {
+            return sign | 0x7c00u;
+        }
+
+        // Below 2^-14 the result is a subnormal half, below 2^-25 it rounds to zero.
+        if (magnitude < 0x38800000u)
+        {
+            const auto exponent = magnitude >> 23;
+            if (exponent < 102u)
+            {
+                return sign;
+            }
+
+            const auto mantissa = (magnitude & 0x7fffffu) | 0x800000u;
+            return sign | static_cast<std::uint16_t>(round_shift_right(mantissa, 126u - exponent));
+        }
+
+        // Rebias the exponent from 127 to 15, a carry out of the mantissa correctly bumps the exponent.
+        return sign | static_cast<std::uint16_t>(round_shift_right(magnitude - 0x38000000u, 13u));
+    }
+}
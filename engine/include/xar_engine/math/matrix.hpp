@@ -1,14 +1,22 @@
 #pragma once
 
 #include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
 
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/math/simd.hpp>
 #include <xar_engine/math/vector.hpp>
 
 
 namespace xar_engine::math
 {
+    // Column-major, columns are aligned so each one loads as one SIMD register.
+    // Constant evaluated code only touches as_column_list, the active member after value initialization.
     template <typename T>
-    struct TMatrix
+    struct alignas(sizeof(T) * 4) TMatrix
     {
         using Type = T;
 
@@ -24,30 +32,657 @@ namespace xar_engine::math
     static_assert(sizeof(Matrix4x4f) == sizeof(Matrix4x4f::Type) * 16);
 
 
-    Matrix4x4f make_identity_matrix();
+    // Plain C++ reference implementations, used in constant evaluation and where no simd kernel exists.
+    namespace kernel::scalar
+    {
+        constexpr Vector4f transform_vector(
+            const Matrix4x4f& matrix,
+            const Vector4f& vector)
+        {
+            const auto& column_list = matrix.as_column_list;
+            return {
+                column_list[0].x * vector.x + column_list[1].x * vector.y + column_list[2].x * vector.z + column_list[3].x * vector.w,
+                column_list[0].y * vector.x + column_list[1].y * vector.y + column_list[2].y * vector.z + column_list[3].y * vector.w,
+                column_list[0].z * vector.x + column_list[1].z * vector.y + column_list[2].z * vector.z + column_list[3].z * vector.w,
+                column_list[0].w * vector.x + column_list[1].w * vector.y + column_list[2].w * vector.z + column_list[3].w * vector.w,
+            };
+        }
+
+        constexpr Matrix4x4f multiply_matrix(
+            const Matrix4x4f& left,
+            const Matrix4x4f& right)
+        {
+            auto result = Matrix4x4f{};
+            for (auto column = 0; column < 4; ++column)
+            {
+                result.as_column_list[column] = scalar::transform_vector(
+                    left,
+                    right.as_column_list[column]);
+            }
+
+            return result;
+        }
+
+        constexpr Matrix4x4f transpose_matrix(const Matrix4x4f& matrix)
+        {
+            auto result = Matrix4x4f{};
+            for (auto column = 0u; column < 4; ++column)
+            {
+                for (auto row = 0u; row < 4; ++row)
+                {
+                    result.as_column_list[row][column] = matrix.as_column_list[column][row];
+                }
+            }
+
+            return result;
+        }
+
+        // Returns false and leaves result untouched when the matrix is singular.
+        constexpr bool inverse_matrix(
+            const Matrix4x4f& matrix,
+            Matrix4x4f& result)
+        {
+            // Laplace expansion over the 2x2 minors of the first two and last two columns, written with
+            // a(i, j) = as_column_list[i][j]. The inverse of the transpose is the transpose of the inverse,
+            // so treating columns as rows here does not change the result.
+            const auto a = [&matrix](
+                std::uint32_t i,
+                std::uint32_t j)
+            {
+                return matrix.as_column_list[i][j];
+            };
+
+            const auto s0 = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+            const auto s1 = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+            const auto s2 = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+            const auto s3 = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+            const auto s4 = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+            const auto s5 = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+
+            const auto c5 = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+            const auto c4 = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+            const auto c3 = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+            const auto c2 = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+            const auto c1 = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+            const auto c0 = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+
+            const auto determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            if (determinant == 0.0f || !(std::fabs(determinant) <= std::numeric_limits<float>::max()))
+            {
+                return false;
+            }
+
+            const auto inverse_determinant = 1.0f / determinant;
+            result.as_column_list = {{
+                {
+                    (a(1, 1) * c5 - a(1, 2) * c4 + a(1, 3) * c3) * inverse_determinant,
+                    (-a(0, 1) * c5 + a(0, 2) * c4 - a(0, 3) * c3) * inverse_determinant,
+                    (a(3, 1) * s5 - a(3, 2) * s4 + a(3, 3) * s3) * inverse_determinant,
+                    (-a(2, 1) * s5 + a(2, 2) * s4 - a(2, 3) * s3) * inverse_determinant,
+                },
+                {
+                    (-a(1, 0) * c5 + a(1, 2) * c2 - a(1, 3) * c1) * inverse_determinant,
+                    (a(0, 0) * c5 - a(0, 2) * c2 + a(0, 3) * c1) * inverse_determinant,
+                    (-a(3, 0) * s5 + a(3, 2) * s2 - a(3, 3) * s1) * inverse_determinant,
+                    (a(2, 0) * s5 - a(2, 2) * s2 + a(2, 3) * s1) * inverse_determinant,
+                },
+                {
+                    (a(1, 0) * c4 - a(1, 1) * c2 + a(1, 3) * c0) * inverse_determinant,
+                    (-a(0, 0) * c4 + a(0, 1) * c2 - a(0, 3) * c0) * inverse_determinant,
+                    (a(3, 0) * s4 - a(3, 1) * s2 + a(3, 3) * s0) * inverse_determinant,
+                    (-a(2, 0) * s4 + a(2, 1) * s2 - a(2, 3) * s0) * inverse_determinant,
+                },
+                {
+                    (-a(1, 0) * c3 + a(1, 1) * c1 - a(1, 2) * c0) * inverse_determinant,
+                    (a(0, 0) * c3 - a(0, 1) * c1 + a(0, 2) * c0) * inverse_determinant,
+                    (-a(3, 0) * s3 + a(3, 1) * s1 - a(3, 2) * s0) * inverse_determinant,
+                    (a(2, 0) * s3 - a(2, 1) * s1 + a(2, 2) * s0) * inverse_determinant,
+                },
+            }};
+
+            return true;
+        }
+    }
+
+    namespace kernel::simd
+    {
+    #if defined(XAR_ENGINE_MATH_SSE)
+        namespace detail
+        {
+            inline __m128 transform(
+                const __m128 (&column_list)[4],
+                __m128 vector)
+            {
+                auto result = _mm_mul_ps(
+                    column_list[0],
+                    swizzle<0, 0, 0, 0>(vector));
+                result = _mm_add_ps(
+                    result,
+                    _mm_mul_ps(
+                        column_list[1],
+                        swizzle<1, 1, 1, 1>(vector)));
+                result = _mm_add_ps(
+                    result,
+                    _mm_mul_ps(
+                        column_list[2],
+                        swizzle<2, 2, 2, 2>(vector)));
+                return _mm_add_ps(
+                    result,
+                    _mm_mul_ps(
+                        column_list[3],
+                        swizzle<3, 3, 3, 3>(vector)));
+            }
+
+            // Helpers for the block inverse, a 2x2 matrix is stored as (m00, m01, m10, m11) in one register.
+            inline __m128 multiply_2x2(
+                __m128 left,
+                __m128 right)
+            {
+                return _mm_add_ps(
+                    _mm_mul_ps(
+                        left,
+                        swizzle<0, 3, 0, 3>(right)),
+                    _mm_mul_ps(
+                        swizzle<1, 0, 3, 2>(left),
+                        swizzle<2, 1, 2, 1>(right)));
+            }
+
+            // adjugate(left) * right
+            inline __m128 adjugate_multiply_2x2(
+                __m128 left,
+                __m128 right)
+            {
+                return _mm_sub_ps(
+                    _mm_mul_ps(
+                        swizzle<3, 3, 0, 0>(left),
+                        right),
+                    _mm_mul_ps(
+                        swizzle<1, 1, 2, 2>(left),
+                        swizzle<2, 3, 0, 1>(right)));
+            }
+
+            // left * adjugate(right)
+            inline __m128 multiply_adjugate_2x2(
+                __m128 left,
+                __m128 right)
+            {
+                return _mm_sub_ps(
+                    _mm_mul_ps(
+                        left,
+                        swizzle<3, 0, 3, 0>(right)),
+                    _mm_mul_ps(
+                        swizzle<1, 0, 3, 2>(left),
+                        swizzle<2, 1, 2, 1>(right)));
+            }
+        }
+
+        inline Matrix4x4f multiply_matrix(
+            const Matrix4x4f& left,
+            const Matrix4x4f& right)
+        {
+            auto result = Matrix4x4f{};
+
+            const __m128 left_column_list[4] = {
+                detail::load(left.as_column_list[0]),
+                detail::load(left.as_column_list[1]),
+                detail::load(left.as_column_list[2]),
+                detail::load(left.as_column_list[3]),
+            };
+
+            for (auto column = 0; column < 4; ++column)
+            {
+                result.as_column_list[column] = detail::store(
+                    detail::transform(
+                        left_column_list,
+                        detail::load(right.as_column_list[column])));
+            }
+
+            return result;
+        }
+
+        inline Matrix4x4f transpose_matrix(const Matrix4x4f& matrix)
+        {
+            auto column_0 = detail::load(matrix.as_column_list[0]);
+            auto column_1 = detail::load(matrix.as_column_list[1]);
+            auto column_2 = detail::load(matrix.as_column_list[2]);
+            auto column_3 = detail::load(matrix.as_column_list[3]);
+            _MM_TRANSPOSE4_PS(column_0, column_1, column_2, column_3);
+
+            auto result = Matrix4x4f{};
+            result.as_column_list = {
+                detail::store(column_0),
+                detail::store(column_1),
+                detail::store(column_2),
+                detail::store(column_3),
+            };
+
+            return result;
+        }
+
+        inline bool inverse_matrix(
+            const Matrix4x4f& matrix,
+            Matrix4x4f& result)
+        {
+            // Block inverse over the four 2x2 sub-matrices. As in the scalar kernel the columns are
+            // treated as rows, which yields the same result.
+            const auto row_0 = detail::load(matrix.as_column_list[0]);
+            const auto row_1 = detail::load(matrix.as_column_list[1]);
+            const auto row_2 = detail::load(matrix.as_column_list[2]);
+            const auto row_3 = detail::load(matrix.as_column_list[3]);
+
+            const auto a = _mm_movelh_ps(row_0, row_1);
+            const auto b = _mm_movehl_ps(row_1, row_0);
+            const auto c = _mm_movelh_ps(row_2, row_3);
+            const auto d = _mm_movehl_ps(row_3, row_2);
+
+            // (|A|, |B|, |C|, |D|)
+            const auto sub_determinant = _mm_sub_ps(
+                _mm_mul_ps(
+                    _mm_shuffle_ps(row_0, row_2, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm_shuffle_ps(row_1, row_3, _MM_SHUFFLE(3, 1, 3, 1))),
+                _mm_mul_ps(
+                    _mm_shuffle_ps(row_0, row_2, _MM_SHUFFLE(3, 1, 3, 1)),
+                    _mm_shuffle_ps(row_1, row_3, _MM_SHUFFLE(2, 0, 2, 0))));
+            const auto determinant_a = detail::swizzle<0, 0, 0, 0>(sub_determinant);
+            const auto determinant_b = detail::swizzle<1, 1, 1, 1>(sub_determinant);
+            const auto determinant_c = detail::swizzle<2, 2, 2, 2>(sub_determinant);
+            const auto determinant_d = detail::swizzle<3, 3, 3, 3>(sub_determinant);
+
+            const auto d_c = detail::adjugate_multiply_2x2(d, c);
+            const auto a_b = detail::adjugate_multiply_2x2(a, b);
+
+            auto x = _mm_sub_ps(
+                _mm_mul_ps(determinant_d, a),
+                detail::multiply_2x2(b, d_c));
+            auto w = _mm_sub_ps(
+                _mm_mul_ps(determinant_a, d),
+                detail::multiply_2x2(c, a_b));
+            auto y = _mm_sub_ps(
+                _mm_mul_ps(determinant_b, c),
+                detail::multiply_adjugate_2x2(d, a_b));
+            auto z = _mm_sub_ps(
+                _mm_mul_ps(determinant_c, b),
+                detail::multiply_adjugate_2x2(a, d_c));
+
+            // |M| = |A| |D| + |B| |C| - tr(adj(A) B adj(D) C)
+            const auto trace = detail::horizontal_sum(
+                _mm_mul_ps(
+                    a_b,
+                    detail::swizzle<0, 2, 1, 3>(d_c)));
+            const auto determinant = _mm_sub_ps(
+                _mm_add_ps(
+                    _mm_mul_ps(determinant_a, determinant_d),
+                    _mm_mul_ps(determinant_b, determinant_c)),
+                trace);
+
+            const auto determinant_scalar = _mm_cvtss_f32(determinant);
+            if (determinant_scalar == 0.0f || !std::isfinite(determinant_scalar))
+            {
+                return false;
+            }
+
+            const auto signed_inverse_determinant = _mm_div_ps(
+                _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f),
+                determinant);
+            x = _mm_mul_ps(x, signed_inverse_determinant);
+            y = _mm_mul_ps(y, signed_inverse_determinant);
+            z = _mm_mul_ps(z, signed_inverse_determinant);
+            w = _mm_mul_ps(w, signed_inverse_determinant);
+
+            // Applies the adjugate swizzle and reassembles the rows in one shuffle each.
+            result.as_column_list = {
+                detail::store(_mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3))),
+                detail::store(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2))),
+                detail::store(_mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3))),
+                detail::store(_mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2))),
+            };
+
+            return true;
+        }
+
+        inline Vector4f transform_vector(
+            const Matrix4x4f& matrix,
+            const Vector4f& vector)
+        {
+            const __m128 column_list[4] = {
+                detail::load(matrix.as_column_list[0]),
+                detail::load(matrix.as_column_list[1]),
+                detail::load(matrix.as_column_list[2]),
+                detail::load(matrix.as_column_list[3]),
+            };
+
+            return detail::store(
+                detail::transform(
+                    column_list,
+                    detail::load(vector)));
+        }
+    #elif defined(XAR_ENGINE_MATH_NEON)
+        namespace detail
+        {
+            inline float32x4_t transform(
+                const float32x4_t (&column_list)[4],
+                float32x4_t vector)
+            {
+                auto result = vmulq_laneq_f32(column_list[0], vector, 0);
+                result = vfmaq_laneq_f32(result, column_list[1], vector, 1);
+                result = vfmaq_laneq_f32(result, column_list[2], vector, 2);
+                return vfmaq_laneq_f32(result, column_list[3], vector, 3);
+            }
+        }
+
+        inline Matrix4x4f multiply_matrix(
+            const Matrix4x4f& left,
+            const Matrix4x4f& right)
+        {
+            const float32x4_t left_column_list[4] = {
+                detail::load(left.as_column_list[0]),
+                detail::load(left.as_column_list[1]),
+                detail::load(left.as_column_list[2]),
+                detail::load(left.as_column_list[3]),
+            };
+
+            auto result = Matrix4x4f{};
+            for (auto column = 0; column < 4; ++column)
+            {
+                result.as_column_list[column] = detail::store(
+                    detail::transform(
+                        left_column_list,
+                        detail::load(right.as_column_list[column])));
+            }
+
+            return result;
+        }
+
+        inline Matrix4x4f transpose_matrix(const Matrix4x4f& matrix)
+        {
+            // De-interleaving load, lane i of every column lands in row i.
+            const auto row_list = vld4q_f32(&matrix.as_column_list[0].x);
+
+            auto result = Matrix4x4f{};
+            result.as_column_list = {
+                detail::store(row_list.val[0]),
+                detail::store(row_list.val[1]),
+                detail::store(row_list.val[2]),
+                detail::store(row_list.val[3]),
+            };
+
+            return result;
+        }
+
+        inline bool inverse_matrix(
+            const Matrix4x4f& matrix,
+            Matrix4x4f& result)
+        {
+            return scalar::inverse_matrix(
+                matrix,
+                result);
+        }
+
+        inline Vector4f transform_vector(
+            const Matrix4x4f& matrix,
+            const Vector4f& vector)
+        {
+            const float32x4_t column_list[4] = {
+                detail::load(matrix.as_column_list[0]),
+                detail::load(matrix.as_column_list[1]),
+                detail::load(matrix.as_column_list[2]),
+                detail::load(matrix.as_column_list[3]),
+            };
 
-    Matrix4x4f make_view_matrix(
+            return detail::store(
+                detail::transform(
+                    column_list,
+                    detail::load(vector)));
+        }
+    #else
+        inline Matrix4x4f multiply_matrix(
+            const Matrix4x4f& left,
+            const Matrix4x4f& right)
+        {
+            return scalar::multiply_matrix(
+                left,
+                right);
+        }
+
+        inline Matrix4x4f transpose_matrix(const Matrix4x4f& matrix)
+        {
+            return scalar::transpose_matrix(matrix);
+        }
+
+        inline bool inverse_matrix(
+            const Matrix4x4f& matrix,
+            Matrix4x4f& result)
+        {
+            return scalar::inverse_matrix(
+                matrix,
+                result);
+        }
+
+        inline Vector4f transform_vector(
+            const Matrix4x4f& matrix,
+            const Vector4f& vector)
+        {
+            return scalar::transform_vector(
+                matrix,
+                vector);
+        }
+    #endif
+    }
+
+
+    namespace detail
+    {
+        constexpr float to_radians(const float degrees)
+        {
+            return degrees * (std::numbers::pi_v<float> / 180.0f);
+        }
+    }
+
+    constexpr Matrix4x4f make_identity_matrix()
+    {
+        auto matrix = Matrix4x4f{};
+        matrix.as_column_list = {{
+            {1.0f, 0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, 0.0f, 1.0f},
+        }};
+
+        return matrix;
+    }
+
+    // Right-handed, matches glm::lookAt.
+    inline Matrix4x4f make_view_matrix(
         const math::Vector3f& eye_position,
         const math::Vector3f& look_at_position,
-        const math::Vector3f& up_vector);
+        const math::Vector3f& up_vector)
+    {
+        const auto forward = normalize_vector(look_at_position - eye_position);
+        const auto side = normalize_vector(
+            cross_product(
+                forward,
+                up_vector));
+        const auto up = cross_product(
+            side,
+            forward);
+
+        auto matrix = Matrix4x4f{};
+        matrix.as_column_list = {{
+            {side.x, up.x, -forward.x, 0.0f},
+            {side.y, up.y, -forward.y, 0.0f},
+            {side.z, up.z, -forward.z, 0.0f},
+            {
+                -dot_product(side, eye_position),
+                -dot_product(up, eye_position),
+                dot_product(forward, eye_position),
+                1.0f
+            },
+        }};
+
+        return matrix;
+    }
+
+    // Right-handed with a [0, 1] depth range, matches glm::perspective with GLM_FORCE_DEPTH_ZERO_TO_ONE.
+    inline Matrix4x4f make_projection_matrix(
+        const float field_of_view,
+        const float aspect,
+        const float near_z_plane,
+        const float far_z_plane)
+    {
+        const auto tan_half_field_of_view = std::tan(detail::to_radians(field_of_view) / 2.0f);
+
+        auto matrix = Matrix4x4f{};
+        matrix.as_column_list[0].x = 1.0f / (aspect * tan_half_field_of_view);
+        matrix.as_column_list[1].y = 1.0f / tan_half_field_of_view;
+        matrix.as_column_list[2].z = far_z_plane / (near_z_plane - far_z_plane);
+        matrix.as_column_list[2].w = -1.0f;
+        matrix.as_column_list[3].z = -(far_z_plane * near_z_plane) / (far_z_plane - near_z_plane);
+
+        return matrix;
+    }
 
-    Matrix4x4f make_projection_matrix(
-        float field_of_view,
-        float aspect,
-        float near_z_plane,
-        float far_z_plane);
 
+    constexpr Matrix4x4f operator*(
+        const Matrix4x4f& left,
+        const Matrix4x4f& right)
+    {
+        if consteval
+        {
+            return kernel::scalar::multiply_matrix(
+                left,
+                right);
+        }
+        else
+        {
+            return kernel::simd::multiply_matrix(
+                left,
+                right);
+        }
+    }
 
-    Matrix4x4f rotate_matrix(
+    constexpr Vector4f operator*(
         const Matrix4x4f& matrix,
-        float angle,
-        const math::Vector3f& axis);
+        const Vector4f& vector)
+    {
+        if consteval
+        {
+            return kernel::scalar::transform_vector(
+                matrix,
+                vector);
+        }
+        else
+        {
+            return kernel::simd::transform_vector(
+                matrix,
+                vector);
+        }
+    }
 
-    Matrix4x4f scale_matrix(
+    // Transforms with w = 1, no perspective divide is applied.
+    constexpr Vector3f transform_point(
         const Matrix4x4f& matrix,
-        const math::Vector3f& scale);
+        const Vector3f& point)
+    {
+        const auto result = matrix * Vector4f{point.x, point.y, point.z, 1.0f};
 
-    Matrix4x4f operator*(
-        const Matrix4x4f& left,
-        const Matrix4x4f& right);
-}
\ No newline at end of file
+        return {result.x, result.y, result.z};
+    }
+
+    // Transforms with w = 0, so translation is ignored.
+    constexpr Vector3f transform_vector(
+        const Matrix4x4f& matrix,
+        const Vector3f& vector)
+    {
+        const auto result = matrix * Vector4f{vector.x, vector.y, vector.z, 0.0f};
+
+        return {result.x, result.y, result.z};
+    }
+
+
+    inline Matrix4x4f rotate_matrix(
+        const Matrix4x4f& matrix,
+        const float angle,
+        const math::Vector3f& axis)
+    {
+        const auto cos_angle = std::cos(detail::to_radians(angle));
+        const auto sin_angle = std::sin(detail::to_radians(angle));
+        const auto unit_axis = normalize_vector(axis);
+        const auto temp = unit_axis * (1.0f - cos_angle);
+
+        auto rotation_matrix = Matrix4x4f{};
+        rotation_matrix.as_column_list = {{
+            {
+                cos_angle + temp.x * unit_axis.x,
+                temp.x * unit_axis.y + sin_angle * unit_axis.z,
+                temp.x * unit_axis.z - sin_angle * unit_axis.y,
+                0.0f
+            },
+            {
+                temp.y * unit_axis.x - sin_angle * unit_axis.z,
+                cos_angle + temp.y * unit_axis.y,
+                temp.y * unit_axis.z + sin_angle * unit_axis.x,
+                0.0f
+            },
+            {
+                temp.z * unit_axis.x + sin_angle * unit_axis.y,
+                temp.z * unit_axis.y - sin_angle * unit_axis.x,
+                cos_angle + temp.z * unit_axis.z,
+                0.0f
+            },
+            {0.0f, 0.0f, 0.0f, 1.0f},
+        }};
+
+        return matrix * rotation_matrix;
+    }
+
+    constexpr Matrix4x4f scale_matrix(
+        const Matrix4x4f& matrix,
+        const math::Vector3f& scale)
+    {
+        auto result = matrix;
+        result.as_column_list[0] = matrix.as_column_list[0] * scale.x;
+        result.as_column_list[1] = matrix.as_column_list[1] * scale.y;
+        result.as_column_list[2] = matrix.as_column_list[2] * scale.z;
+
+        return result;
+    }
+
+    constexpr Matrix4x4f transpose_matrix(const Matrix4x4f& matrix)
+    {
+        if consteval
+        {
+            return kernel::scalar::transpose_matrix(matrix);
+        }
+        else
+        {
+            return kernel::simd::transpose_matrix(matrix);
+        }
+    }
+
+    // Throws when the matrix is singular.
+    constexpr Matrix4x4f inverse_matrix(const Matrix4x4f& matrix)
+    {
+        auto result = Matrix4x4f{};
+
+        auto is_invertible = false;
+        if consteval
+        {
+            is_invertible = kernel::scalar::inverse_matrix(
+                matrix,
+                result);
+        }
+        else
+        {
+            is_invertible = kernel::simd::inverse_matrix(
+                matrix,
+                result);
+        }
+
+        if (!is_invertible)
+        {
+            throw error::XarException{"Matrix is not invertible"};
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,395 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include <xar_engine/math/epsilon.hpp>
+#include <xar_engine/math/matrix.hpp>
+#include <xar_engine/math/simd.hpp>
+#include <xar_engine/math/vector.hpp>
+
+
+namespace xar_engine::math
+{
+    // Rotation quaternion (x, y, z, w) with w as the real part, aligned so it loads as one SIMD register.
+    // Rotations compose like matrices: (left * right) applies right first.
+    struct alignas(16) Quaternionf
+    {
+        float x;
+        float y;
+        float z;
+        float w;
+    };
+
+    static_assert(sizeof(Quaternionf) == sizeof(float) * 4);
+
+
+    constexpr bool operator==(
+        const Quaternionf& left,
+        const Quaternionf& right)
+    {
+        return
+            epsilon::equal(
+                left.x,
+                right.x) &&
+            epsilon::equal(
+                left.y,
+                right.y) &&
+            epsilon::equal(
+                left.z,
+                right.z) &&
+            epsilon::equal(
+                left.w,
+                right.w);
+    }
+
+    constexpr bool operator!=(
+        const Quaternionf& left,
+        const Quaternionf& right)
+    {
+        return !(left == right);
+    }
+
+
+    // Plain C++ reference implementations, used in constant evaluation and where no simd kernel exists.
+    namespace kernel::scalar
+    {
+        constexpr Quaternionf multiply_quaternion(
+            const Quaternionf& left,
+            const Quaternionf& right)
+        {
+            return {
+                left.w * right.x + left.x * right.w + left.y * right.z - left.z * right.y,
+                left.w * right.y - left.x * right.z + left.y * right.w + left.z * right.x,
+                left.w * right.z + left.x * right.y - left.y * right.x + left.z * right.w,
+                left.w * right.w - left.x * right.x - left.y * right.y - left.z * right.z,
+            };
+        }
+
+        // v' = v + w * t + q.xyz x t, with t = 2 * (q.xyz x v).
+        constexpr Vector3f rotate_vector(
+            const Quaternionf& quaternion,
+            const Vector3f& vector)
+        {
+            const auto axis = Vector3f{quaternion.x, quaternion.y, quaternion.z};
+            const auto temp = cross_product(
+                axis,
+                vector) * 2.0f;
+
+            return vector + temp * quaternion.w + cross_product(
+                axis,
+                temp);
+        }
+    }
+
+    namespace kernel::simd
+    {
+    #if defined(XAR_ENGINE_MATH_SSE)
+        namespace detail
+        {
+            inline __m128 load(const Quaternionf& quaternion)
+            {
+                return _mm_load_ps(&quaternion.x);
+            }
+
+            inline Quaternionf store_quaternion(__m128 value)
+            {
+                auto quaternion = Quaternionf{};
+                _mm_store_ps(
+                    &quaternion.x,
+                    value);
+
+                return quaternion;
+            }
+
+            // Flips the sign of every lane whose mask bit is set.
+            template <int x, int y, int z, int w>
+            __m128 negate(__m128 value)
+            {
+                return _mm_xor_ps(
+                    value,
+                    _mm_setr_ps(
+                        x ? -0.0f : 0.0f,
+                        y ? -0.0f : 0.0f,
+                        z ? -0.0f : 0.0f,
+                        w ? -0.0f : 0.0f));
+            }
+        }
+
+        // Sum of right scaled by each component of left, with the signs of the Hamilton product.
+        inline Quaternionf multiply_quaternion(
+            const Quaternionf& left,
+            const Quaternionf& right)
+        {
+            const auto left_value = detail::load(left);
+            const auto right_value = detail::load(right);
+
+            auto result = _mm_mul_ps(
+                detail::swizzle<3, 3, 3, 3>(left_value),
+                right_value);
+            result = _mm_add_ps(
+                result,
+                _mm_mul_ps(
+                    detail::swizzle<0, 0, 0, 0>(left_value),
+                    detail::negate<0, 1, 0, 1>(detail::swizzle<3, 2, 1, 0>(right_value))));
+            result = _mm_add_ps(
+                result,
+                _mm_mul_ps(
+                    detail::swizzle<1, 1, 1, 1>(left_value),
+                    detail::negate<0, 0, 1, 1>(detail::swizzle<2, 3, 0, 1>(right_value))));
+            result = _mm_add_ps(
+                result,
+                _mm_mul_ps(
+                    detail::swizzle<2, 2, 2, 2>(left_value),
+                    detail::negate<1, 0, 0, 1>(detail::swizzle<1, 0, 3, 2>(right_value))));
+
+            return detail::store_quaternion(result);
+        }
+
+        inline Vector3f rotate_vector(
+            const Quaternionf& quaternion,
+            const Vector3f& vector)
+        {
+            const auto axis = Vector4f{quaternion.x, quaternion.y, quaternion.z, 0.0f};
+            const auto vector4 = Vector4f{vector.x, vector.y, vector.z, 0.0f};
+            const auto temp = simd::scale_vector(
+                simd::cross_product(
+                    axis,
+                    vector4),
+                2.0f);
+            const auto result = simd::add_vector(
+                simd::add_vector(
+                    vector4,
+                    simd::scale_vector(
+                        temp,
+                        quaternion.w)),
+                simd::cross_product(
+                    axis,
+                    temp));
+
+            return {result.x, result.y, result.z};
+        }
+    #else
+        inline Quaternionf multiply_quaternion(
+            const Quaternionf& left,
+            const Quaternionf& right)
+        {
+            return scalar::multiply_quaternion(
+                left,
+                right);
+        }
+
+        inline Vector3f rotate_vector(
+            const Quaternionf& quaternion,
+            const Vector3f& vector)
+        {
+            return scalar::rotate_vector(
+                quaternion,
+                vector);
+        }
+    #endif
+    }
+
+
+    namespace detail
+    {
+        constexpr Vector4f to_vector(const Quaternionf& quaternion)
+        {
+            return {quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+        }
+
+        constexpr Quaternionf to_quaternion(const Vector4f& vector)
+        {
+            return {vector.x, vector.y, vector.z, vector.w};
+        }
+    }
+
+    constexpr Quaternionf make_identity_quaternion()
+    {
+        return {0.0f, 0.0f, 0.0f, 1.0f};
+    }
+
+    // Rotation by angle degrees around axis, matches rotate_matrix.
+    inline Quaternionf make_quaternion(
+        const Vector3f& axis,
+        const float angle)
+    {
+        const auto half_angle = detail::to_radians(angle) * 0.5f;
+        const auto unit_axis = normalize_vector(axis) * std::sin(half_angle);
+
+        return {unit_axis.x, unit_axis.y, unit_axis.z, std::cos(half_angle)};
+    }
+
+    constexpr Quaternionf operator*(
+        const Quaternionf& left,
+        const Quaternionf& right)
+    {
+        if consteval
+        {
+            return kernel::scalar::multiply_quaternion(
+                left,
+                right);
+        }
+        else
+        {
+            return kernel::simd::multiply_quaternion(
+                left,
+                right);
+        }
+    }
+
+    constexpr Quaternionf conjugate_quaternion(const Quaternionf& quaternion)
+    {
+        return {-quaternion.x, -quaternion.y, -quaternion.z, quaternion.w};
+    }
+
+    // Equals the conjugate for unit quaternions, throws for the zero quaternion.
+    constexpr Quaternionf inverse_quaternion(const Quaternionf& quaternion)
+    {
+        const auto vector = detail::to_vector(quaternion);
+        const auto length_squared = dot_product(
+            vector,
+            vector);
+        if (length_squared == 0.0f)
+        {
+            throw error::XarException{"Quaternion is not invertible"};
+        }
+
+        return detail::to_quaternion(detail::to_vector(conjugate_quaternion(quaternion)) * (1.0f / length_squared));
+    }
+
+    inline Quaternionf normalize_quaternion(const Quaternionf& quaternion)
+    {
+        return detail::to_quaternion(normalize_vector(detail::to_vector(quaternion)));
+    }
+
+    constexpr Vector3f rotate_vector(
+        const Quaternionf& quaternion,
+        const Vector3f& vector)
+    {
+        if consteval
+        {
+            return kernel::scalar::rotate_vector(
+                quaternion,
+                vector);
+        }
+        else
+        {
+            return kernel::simd::rotate_vector(
+                quaternion,
+                vector);
+        }
+    }
+
+    // Constant angular velocity interpolation along the shorter arc, falls back to a normalized lerp
+    // when the rotations are nearly equal.
+    inline Quaternionf slerp_quaternion(
+        const Quaternionf& from,
+        const Quaternionf& to,
+        const float factor)
+    {
+        const auto from_vector = detail::to_vector(from);
+        auto to_vector = detail::to_vector(to);
+
+        auto cos_angle = dot_product(
+            from_vector,
+            to_vector);
+        if (cos_angle < 0.0f)
+        {
+            to_vector = to_vector * -1.0f;
+            cos_angle = -cos_angle;
+        }
+
+        if (cos_angle > 0.9995f)
+        {
+            return detail::to_quaternion(
+                normalize_vector(from_vector + (to_vector - from_vector) * factor));
+        }
+
+        const auto angle = std::acos(std::min(cos_angle, 1.0f));
+        const auto inverse_sin_angle = 1.0f / std::sin(angle);
+
+        return detail::to_quaternion(
+            from_vector * (std::sin((1.0f - factor) * angle) * inverse_sin_angle) +
+            to_vector * (std::sin(factor * angle) * inverse_sin_angle));
+    }
+
+    // The quaternion must be normalized.
+    constexpr Matrix4x4f make_rotation_matrix(const Quaternionf& quaternion)
+    {
+        const auto xx = quaternion.x * quaternion.x;
+        const auto yy = quaternion.y * quaternion.y;
+        const auto zz = quaternion.z * quaternion.z;
+        const auto xy = quaternion.x * quaternion.y;
+        const auto xz = quaternion.x * quaternion.z;
+        const auto yz = quaternion.y * quaternion.z;
+        const auto wx = quaternion.w * quaternion.x;
+        const auto wy = quaternion.w * quaternion.y;
+        const auto wz = quaternion.w * quaternion.z;
+
+        auto matrix = Matrix4x4f{};
+        matrix.as_column_list = {{
+            {1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f},
+            {2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f},
+            {2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f},
+            {0.0f, 0.0f, 0.0f, 1.0f},
+        }};
+
+        return matrix;
+    }
+
+    // The upper 3x3 block must be a pure rotation, scale has to be divided out first.
+    inline Quaternionf make_quaternion_from_matrix(const Matrix4x4f& matrix)
+    {
+        const auto& column_list = matrix.as_column_list;
+        const auto m00 = column_list[0].x;
+        const auto m11 = column_list[1].y;
+        const auto m22 = column_list[2].z;
+        const auto trace = m00 + m11 + m22;
+
+        // Divides by the largest of the four candidates to stay away from cancellation.
+        auto quaternion = Quaternionf{};
+        if (trace > 0.0f)
+        {
+            const auto s = std::sqrt(trace + 1.0f) * 2.0f;
+            quaternion = {
+                (column_list[1].z - column_list[2].y) / s,
+                (column_list[2].x - column_list[0].z) / s,
+                (column_list[0].y - column_list[1].x) / s,
+                0.25f * s,
+            };
+        }
+        else if (m00 > m11 && m00 > m22)
+        {
+            const auto s = std::sqrt(1.0f + m00 - m11 - m22) * 2.0f;
+            quaternion = {
+                0.25f * s,
+                (column_list[1].x + column_list[0].y) / s,
+                (column_list[2].x + column_list[0].z) / s,
+                (column_list[1].z - column_list[2].y) / s,
+            };
+        }
+        else if (m11 > m22)
+        {
+            const auto s = std::sqrt(1.0f + m11 - m00 - m22) * 2.0f;
+            quaternion = {
+                (column_list[1].x + column_list[0].y) / s,
+                0.25f * s,
+                (column_list[2].y + column_list[1].z) / s,
+                (column_list[2].x - column_list[0].z) / s,
+            };
+        }
+        else
+        {
+            const auto s = std::sqrt(1.0f + m22 - m00 - m11) * 2.0f;
+            quaternion = {
+                (column_list[2].x + column_list[0].z) / s,
+                (column_list[2].y + column_list[1].z) / s,
+                0.25f * s,
+                (column_list[0].y - column_list[1].x) / s,
+            };
+        }
+
+        return normalize_quaternion(quaternion);
+    }
+}
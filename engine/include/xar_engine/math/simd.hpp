@@ -0,0 +1,54 @@
+#pragma once
+
+// Instruction set of the simd kernels. They are inline, so they stay at the architecture baseline (SSE2 on x86-64)
+// instead of following __AVX__ and similar flags of the including translation unit, which would give translation
+// units different definitions of the same function. XAR_ENGINE_MATH_FORCE_SCALAR builds the simd kernels on top of
+// the scalar ones.
+#if !defined(XAR_ENGINE_MATH_FORCE_SCALAR)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define XAR_ENGINE_MATH_SSE
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #define XAR_ENGINE_MATH_NEON
+    #endif
+#endif
+
+#include <xar_engine/meta/enum.hpp>
+
+#if defined(XAR_ENGINE_MATH_SSE)
+    #include <immintrin.h>
+#elif defined(XAR_ENGINE_MATH_NEON)
+    #include <arm_neon.h>
+#endif
+
+
+namespace xar_engine::math::kernel
+{
+    // SSE and AVX are the compile time levels of the header kernels. The batch kernels pick one of SCALAR,
+    // SSE4_2, AVX2, AVX512 and NEON at run time, see get_batch_instruction_set.
+    enum class EInstructionSet
+    {
+        SCALAR,
+        SSE,
+        SSE4_2,
+        AVX,
+        AVX2,
+        AVX512,
+        NEON,
+    };
+
+    namespace simd
+    {
+        constexpr EInstructionSet get_instruction_set()
+        {
+        #if defined(XAR_ENGINE_MATH_SSE)
+            return EInstructionSet::SSE;
+        #elif defined(XAR_ENGINE_MATH_NEON)
+            return EInstructionSet::NEON;
+        #else
+            return EInstructionSet::SCALAR;
+        #endif
+        }
+    }
+}
+
+ENUM_TO_STRING(xar_engine::math::kernel::EInstructionSet);
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <xar_engine/math/affine.hpp>
+#include <xar_engine/math/matrix.hpp>
+#include <xar_engine/math/quaternion.hpp>
+#include <xar_engine/math/vector.hpp>
+
+
+namespace xar_engine::math
+{
+    // Scale, then rotation, then translation.
+    struct Transform
+    {
+        Vector3f translation;
+        Quaternionf rotation;
+        Vector3f scale;
+    };
+
+
+    namespace detail
+    {
+        constexpr Vector3f multiply_components(
+            const Vector3f& left,
+            const Vector3f& right)
+        {
+            return {left.x * right.x, left.y * right.y, left.z * right.z};
+        }
+    }
+
+    constexpr Transform make_identity_transform()
+    {
+        return {
+            {0.0f, 0.0f, 0.0f},
+            make_identity_quaternion(),
+            {1.0f, 1.0f, 1.0f},
+        };
+    }
+
+    // The rotation must be normalized.
+    constexpr Affine3x4f make_affine_from_transform(const Transform& transform)
+    {
+        const auto& rotation = transform.rotation;
+        const auto& scale = transform.scale;
+
+        const auto xx = rotation.x * rotation.x;
+        const auto yy = rotation.y * rotation.y;
+        const auto zz = rotation.z * rotation.z;
+        const auto xy = rotation.x * rotation.y;
+        const auto xz = rotation.x * rotation.z;
+        const auto yz = rotation.y * rotation.z;
+        const auto wx = rotation.w * rotation.x;
+        const auto wy = rotation.w * rotation.y;
+        const auto wz = rotation.w * rotation.z;
+
+        auto affine = Affine3x4f{};
+        affine.as_row_list = {{
+            {
+                (1.0f - 2.0f * (yy + zz)) * scale.x,
+                2.0f * (xy - wz) * scale.y,
+                2.0f * (xz + wy) * scale.z,
+                transform.translation.x
+            },
+            {
+                2.0f * (xy + wz) * scale.x,
+                (1.0f - 2.0f * (xx + zz)) * scale.y,
+                2.0f * (yz - wx) * scale.z,
+                transform.translation.y
+            },
+            {
+                2.0f * (xz - wy) * scale.x,
+                2.0f * (yz + wx) * scale.y,
+                (1.0f - 2.0f * (xx + yy)) * scale.z,
+                transform.translation.z
+            },
+        }};
+
+        return affine;
+    }
+
+    constexpr Matrix4x4f make_matrix_from_transform(const Transform& transform)
+    {
+        return make_matrix_from_affine(make_affine_from_transform(transform));
+    }
+
+    // Applies child first. Exact when the parent scale is uniform, otherwise the shear a non-uniformly
+    // scaled parent puts on a rotated child is dropped; compose as Affine3x4f when that matters.
+    constexpr Transform operator*(
+        const Transform& parent,
+        const Transform& child)
+    {
+        return {
+            parent.translation + rotate_vector(
+                parent.rotation,
+                detail::multiply_components(
+                    parent.scale,
+                    child.translation)),
+            parent.rotation * child.rotation,
+            detail::multiply_components(
+                parent.scale,
+                child.scale),
+        };
+    }
+
+    // Exact for uniform scale, like operator*. Throws when a scale component is zero.
+    constexpr Transform inverse_transform(const Transform& transform)
+    {
+        const auto& scale = transform.scale;
+        if (scale.x == 0.0f || scale.y == 0.0f || scale.z == 0.0f)
+        {
+            throw error::XarException{"Transform is not invertible"};
+        }
+
+        const auto inverse_scale = Vector3f{1.0f / scale.x, 1.0f / scale.y, 1.0f / scale.z};
+        const auto inverse_rotation = conjugate_quaternion(transform.rotation);
+
+        return {
+            detail::multiply_components(
+                inverse_scale,
+                rotate_vector(
+                    inverse_rotation,
+                    transform.translation * -1.0f)),
+            inverse_rotation,
+            inverse_scale,
+        };
+    }
+
+    // Linear for translation and scale, spherical for rotation.
+    inline Transform interpolate_transform(
+        const Transform& from,
+        const Transform& to,
+        const float factor)
+    {
+        return {
+            from.translation + (to.translation - from.translation) * factor,
+            slerp_quaternion(
+                from.rotation,
+                to.rotation,
+                factor),
+            from.scale + (to.scale - from.scale) * factor,
+        };
+    }
+}
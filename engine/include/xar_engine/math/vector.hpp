@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cmath>
 #include <cstdint>
 
 #include <xar_engine/math/epsilon.hpp>
+#include <xar_engine/math/simd.hpp>
 
 
 namespace xar_engine::math
@@ -29,8 +31,9 @@ namespace xar_engine::math
         T z;
     };
 
+    // Aligned to its size, so the four components load as one SIMD register.
     template <typename T>
-    struct TVector<T, 4>
+    struct alignas(sizeof(T) * 4) TVector<T, 4>
     {
         using Type = T;
 
@@ -38,6 +41,36 @@ namespace xar_engine::math
         T y;
         T z;
         T w;
+
+        constexpr T& operator[](std::uint32_t index)
+        {
+            switch (index)
+            {
+                case 0:
+                    return x;
+                case 1:
+                    return y;
+                case 2:
+                    return z;
+                default:
+                    return w;
+            }
+        }
+
+        constexpr const T& operator[](std::uint32_t index) const
+        {
+            switch (index)
+            {
+                case 0:
+                    return x;
+                case 1:
+                    return y;
+                case 2:
+                    return z;
+                default:
+                    return w;
+            }
+        }
     };
 
 
@@ -78,7 +111,7 @@ namespace xar_engine::math
 
 
     template <typename T>
-    bool operator==(
+    constexpr bool operator==(
         const Vector2<T>& left,
         const Vector2<T>& right)
     {
@@ -92,7 +125,7 @@ namespace xar_engine::math
     }
 
     template <typename T>
-    bool operator!=(
+    constexpr bool operator!=(
         const Vector2<T>& left,
         const Vector2<T>& right)
     {
@@ -100,7 +133,7 @@ namespace xar_engine::math
     }
 
     template <typename T>
-    bool operator==(
+    constexpr bool operator==(
         const Vector3<T>& left,
         const Vector3<T>& right)
     {
@@ -117,7 +150,7 @@ namespace xar_engine::math
     }
 
     template <typename T>
-    bool operator!=(
+    constexpr bool operator!=(
         const Vector3<T>& left,
         const Vector3<T>& right)
     {
@@ -125,7 +158,7 @@ namespace xar_engine::math
     }
 
     template <typename T>
-    bool operator==(
+    constexpr bool operator==(
         const Vector4<T>& left,
         const Vector4<T>& right)
     {
@@ -145,10 +178,503 @@ namespace xar_engine::math
     }
 
     template <typename T>
-    bool operator!=(
+    constexpr bool operator!=(
         const Vector4<T>& left,
         const Vector4<T>& right)
     {
         return !(left == right);
     }
-}
\ No newline at end of file
+
+
+    constexpr Vector3f operator+(
+        const Vector3f& left,
+        const Vector3f& right)
+    {
+        return {left.x + right.x, left.y + right.y, left.z + right.z};
+    }
+
+    constexpr Vector3f operator-(
+        const Vector3f& left,
+        const Vector3f& right)
+    {
+        return {left.x - right.x, left.y - right.y, left.z - right.z};
+    }
+
+    constexpr Vector3f operator*(
+        const Vector3f& vector,
+        const float scalar)
+    {
+        return {vector.x * scalar, vector.y * scalar, vector.z * scalar};
+    }
+
+    constexpr float dot_product(
+        const Vector3f& left,
+        const Vector3f& right)
+    {
+        return left.x * right.x + left.y * right.y + left.z * right.z;
+    }
+
+    constexpr Vector3f cross_product(
+        const Vector3f& left,
+        const Vector3f& right)
+    {
+        return {
+            left.y * right.z - left.z * right.y,
+            left.z * right.x - left.x * right.z,
+            left.x * right.y - left.y * right.x,
+        };
+    }
+
+    inline float vector_length(const Vector3f& vector)
+    {
+        return std::sqrt(
+            dot_product(
+                vector,
+                vector));
+    }
+
+    // A zero vector is returned unchanged.
+    inline Vector3f normalize_vector(const Vector3f& vector)
+    {
+        const auto length = vector_length(vector);
+        if (length == 0.0f)
+        {
+            return vector;
+        }
+
+        return vector * (1.0f / length);
+    }
+
+
+    // Plain C++ reference implementations, used in constant evaluation and where no simd kernel exists.
+    namespace kernel::scalar
+    {
+        constexpr Vector4f add_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return {left.x + right.x, left.y + right.y, left.z + right.z, left.w + right.w};
+        }
+
+        constexpr Vector4f subtract_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return {left.x - right.x, left.y - right.y, left.z - right.z, left.w - right.w};
+        }
+
+        constexpr Vector4f scale_vector(
+            const Vector4f& vector,
+            const float factor)
+        {
+            return {vector.x * factor, vector.y * factor, vector.z * factor, vector.w * factor};
+        }
+
+        constexpr float dot_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w;
+        }
+
+        // Cross product of the xyz components, w of the result is 0.
+        constexpr Vector4f cross_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return {
+                left.y * right.z - left.z * right.y,
+                left.z * right.x - left.x * right.z,
+                left.x * right.y - left.y * right.x,
+                0.0f
+            };
+        }
+
+        inline Vector4f normalize_vector(const Vector4f& vector)
+        {
+            const auto length_squared = scalar::dot_product(
+                vector,
+                vector);
+            if (length_squared == 0.0f)
+            {
+                return vector;
+            }
+
+            return scalar::scale_vector(
+                vector,
+                1.0f / std::sqrt(length_squared));
+        }
+    }
+
+    namespace kernel::simd
+    {
+    #if defined(XAR_ENGINE_MATH_SSE)
+        namespace detail
+        {
+            inline __m128 load(const Vector4f& vector)
+            {
+                return _mm_load_ps(&vector.x);
+            }
+
+            inline Vector4f store(__m128 value)
+            {
+                auto vector = Vector4f{};
+                _mm_store_ps(
+                    &vector.x,
+                    value);
+
+                return vector;
+            }
+
+            template <int x, int y, int z, int w>
+            __m128 swizzle(__m128 value)
+            {
+                return _mm_shuffle_ps(
+                    value,
+                    value,
+                    _MM_SHUFFLE(w, z, y, x));
+            }
+
+            // Sum of all four lanes in every lane.
+            inline __m128 horizontal_sum(__m128 value)
+            {
+                value = _mm_add_ps(
+                    value,
+                    swizzle<1, 0, 3, 2>(value));
+                return _mm_add_ps(
+                    value,
+                    swizzle<2, 3, 0, 1>(value));
+            }
+
+            inline __m128 dot_product(
+                __m128 left,
+                __m128 right)
+            {
+                return horizontal_sum(
+                    _mm_mul_ps(
+                        left,
+                        right));
+            }
+        }
+
+        inline Vector4f add_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return detail::store(
+                _mm_add_ps(
+                    detail::load(left),
+                    detail::load(right)));
+        }
+
+        inline Vector4f subtract_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return detail::store(
+                _mm_sub_ps(
+                    detail::load(left),
+                    detail::load(right)));
+        }
+
+        inline Vector4f scale_vector(
+            const Vector4f& vector,
+            const float factor)
+        {
+            return detail::store(
+                _mm_mul_ps(
+                    detail::load(vector),
+                    _mm_set1_ps(factor)));
+        }
+
+        inline float dot_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return _mm_cvtss_f32(
+                detail::dot_product(
+                    detail::load(left),
+                    detail::load(right)));
+        }
+
+        inline Vector4f cross_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            const auto left_value = detail::load(left);
+            const auto right_value = detail::load(right);
+
+            const auto result = _mm_sub_ps(
+                _mm_mul_ps(
+                    detail::swizzle<1, 2, 0, 3>(left_value),
+                    detail::swizzle<2, 0, 1, 3>(right_value)),
+                _mm_mul_ps(
+                    detail::swizzle<2, 0, 1, 3>(left_value),
+                    detail::swizzle<1, 2, 0, 3>(right_value)));
+
+            // Clears w, which would otherwise hold w * w - w * w.
+            return detail::store(
+                _mm_and_ps(
+                    result,
+                    _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0))));
+        }
+
+        inline Vector4f normalize_vector(const Vector4f& vector)
+        {
+            const auto value = detail::load(vector);
+            const auto length_squared = detail::dot_product(
+                value,
+                value);
+            if (_mm_cvtss_f32(length_squared) == 0.0f)
+            {
+                return vector;
+            }
+
+            return detail::store(
+                _mm_div_ps(
+                    value,
+                    _mm_sqrt_ps(length_squared)));
+        }
+    #elif defined(XAR_ENGINE_MATH_NEON)
+        namespace detail
+        {
+            inline float32x4_t load(const Vector4f& vector)
+            {
+                return vld1q_f32(&vector.x);
+            }
+
+            inline Vector4f store(float32x4_t value)
+            {
+                auto vector = Vector4f{};
+                vst1q_f32(
+                    &vector.x,
+                    value);
+
+                return vector;
+            }
+        }
+
+        inline Vector4f add_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return detail::store(
+                vaddq_f32(
+                    detail::load(left),
+                    detail::load(right)));
+        }
+
+        inline Vector4f subtract_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return detail::store(
+                vsubq_f32(
+                    detail::load(left),
+                    detail::load(right)));
+        }
+
+        inline Vector4f scale_vector(
+            const Vector4f& vector,
+            const float factor)
+        {
+            return detail::store(
+                vmulq_n_f32(
+                    detail::load(vector),
+                    factor));
+        }
+
+        inline float dot_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return vaddvq_f32(
+                vmulq_f32(
+                    detail::load(left),
+                    detail::load(right)));
+        }
+
+        inline Vector4f cross_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return scalar::cross_product(
+                left,
+                right);
+        }
+
+        inline Vector4f normalize_vector(const Vector4f& vector)
+        {
+            const auto length_squared = simd::dot_product(
+                vector,
+                vector);
+            if (length_squared == 0.0f)
+            {
+                return vector;
+            }
+
+            return detail::store(
+                vdivq_f32(
+                    detail::load(vector),
+                    vdupq_n_f32(std::sqrt(length_squared))));
+        }
+    #else
+        inline Vector4f add_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return scalar::add_vector(
+                left,
+                right);
+        }
+
+        inline Vector4f subtract_vector(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return scalar::subtract_vector(
+                left,
+                right);
+        }
+
+        inline Vector4f scale_vector(
+            const Vector4f& vector,
+            const float factor)
+        {
+            return scalar::scale_vector(
+                vector,
+                factor);
+        }
+
+        inline float dot_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return scalar::dot_product(
+                left,
+                right);
+        }
+
+        inline Vector4f cross_product(
+            const Vector4f& left,
+            const Vector4f& right)
+        {
+            return scalar::cross_product(
+                left,
+                right);
+        }
+
+        inline Vector4f normalize_vector(const Vector4f& vector)
+        {
+            return scalar::normalize_vector(vector);
+        }
+    #endif
+    }
+
+
+    // The Vector4f operations run the scalar kernels in constant evaluation and the simd kernels otherwise.
+    constexpr Vector4f operator+(
+        const Vector4f& left,
+        const Vector4f& right)
+    {
+        if consteval
+        {
+            return kernel::scalar::add_vector(
+                left,
+                right);
+        }
+        else
+        {
+            return kernel::simd::add_vector(
+                left,
+                right);
+        }
+    }
+
+    constexpr Vector4f operator-(
+        const Vector4f& left,
+        const Vector4f& right)
+    {
+        if consteval
+        {
+            return kernel::scalar::subtract_vector(
+                left,
+                right);
+        }
+        else
+        {
+            return kernel::simd::subtract_vector(
+                left,
+                right);
+        }
+    }
+
+    constexpr Vector4f operator*(
+        const Vector4f& vector,
+        const float scalar)
+    {
+        if consteval
+        {
+            return kernel::scalar::scale_vector(
+                vector,
+                scalar);
+        }
+        else
+        {
+            return kernel::simd::scale_vector(
+                vector,
+                scalar);
+        }
+    }
+
+    constexpr float dot_product(
+        const Vector4f& left,
+        const Vector4f& right)
+    {
+        if consteval
+        {
+            return kernel::scalar::dot_product(
+                left,
+                right);
+        }
+        else
+        {
+            return kernel::simd::dot_product(
+                left,
+                right);
+        }
+    }
+
+    // Cross product of the xyz components, w of the result is 0.
+    constexpr Vector4f cross_product(
+        const Vector4f& left,
+        const Vector4f& right)
+    {
+        if consteval
+        {
+            return kernel::scalar::cross_product(
+                left,
+                right);
+        }
+        else
+        {
+            return kernel::simd::cross_product(
+                left,
+                right);
+        }
+    }
+
+    inline float vector_length(const Vector4f& vector)
+    {
+        return std::sqrt(
+            kernel::simd::dot_product(
+                vector,
+                vector));
+    }
+
+    // A zero vector is returned unchanged.
+    inline Vector4f normalize_vector(const Vector4f& vector)
+    {
+        return kernel::simd::normalize_vector(vector);
+    }
+}
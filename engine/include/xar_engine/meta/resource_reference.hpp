@@ -1,91 +1,170 @@
 #pragma once
 
 #include <cstdint>
-#include <functional>
-#include <memory>
+#include <type_traits>
+#include <utility>
 
 
 namespace xar_engine::meta
 {
+    template <typename Tag>
+    struct TResourceHandle
+    {
+        using Id = std::uint32_t;
+
+        static constexpr auto INVALID_ID = ~Id{0};
+
+        Id id = INVALID_ID;
+    };
+
+
+    // Keeps the reference counts of the resources it hands out, next to the resources themselves.
+    template <typename Tag>
+    class IResourceOwner
+    {
+    public:
+        using Id = TResourceHandle<Tag>::Id;
+
+    public:
+        virtual ~IResourceOwner() = default;
+
+
+        virtual void retain_resource(Id id) = 0;
+        // Destroys the resource when its last reference is released.
+        virtual void release_resource(Id id) = 0;
+    };
+
+
+    // Id of a resource plus the owner counting references to it, both held by value so making, copying and
+    // passing a reference never allocates. A reference without an owner is a plain id and copies without
+    // counting. Whether references to one resource can be copied on several threads is up to the owner.
     template <typename Tag>
     class TResourceReference
     {
     public:
-        using Id = std::uint32_t;
-        using Deleter = std::function<void()>;
+        using Handle = TResourceHandle<Tag>;
+        using Id = Handle::Id;
+        using Owner = IResourceOwner<Tag>;
 
     public:
         TResourceReference();
+        // Adopts the reference the owner counted for the new resource.
         TResourceReference(
             Id id,
-            Deleter deleter);
+            Owner* owner);
+
+        TResourceReference(const TResourceReference& other);
+        TResourceReference(TResourceReference&& other) noexcept;
+
+        ~TResourceReference();
+
+        TResourceReference& operator=(const TResourceReference& other);
+        TResourceReference& operator=(TResourceReference&& other) noexcept;
 
 
         [[nodiscard]]
         Id get_id() const;
 
-    private:
-        struct State;
+        [[nodiscard]]
+        Handle get_handle() const;
+
+        operator Handle() const;
 
     private:
-        std::shared_ptr<State> _state;
+        Id _id;
+        Owner* _owner;
     };
 
+    static_assert(std::is_trivially_copyable_v<TResourceHandle<void>>);
+
 
     template <typename Tag>
-    struct TResourceReference<Tag>::State
+    TResourceReference<Tag>::TResourceReference()
+        : _id(Handle::INVALID_ID)
+        , _owner(nullptr)
     {
-    public:
-        State(
-            Id id,
-            Deleter deleter);
-
-        ~State();
-
-    public:
-        Id id;
-        Deleter deleter;
-    };
+    }
 
     template <typename Tag>
-    TResourceReference<Tag>::State::State(
+    TResourceReference<Tag>::TResourceReference(
         const Id id,
-        Deleter deleter)
-        : id(id)
-        , deleter(std::move(deleter))
+        Owner* const owner)
+        : _id(id)
+        , _owner(owner)
     {
     }
 
     template <typename Tag>
-    TResourceReference<Tag>::State::~State()
+    TResourceReference<Tag>::TResourceReference(const TResourceReference& other)
+        : _id(other._id)
+        , _owner(other._owner)
     {
-        if (deleter)
+        if (_owner)
         {
-            deleter();
+            _owner->retain_resource(_id);
         }
     }
 
+    template <typename Tag>
+    TResourceReference<Tag>::TResourceReference(TResourceReference&& other) noexcept
+        : _id(std::exchange(other._id, Handle::INVALID_ID))
+        , _owner(std::exchange(other._owner, nullptr))
+    {
+    }
 
     template <typename Tag>
-    TResourceReference<Tag>::TResourceReference()
-        : _state(nullptr)
+    TResourceReference<Tag>::~TResourceReference()
     {
+        if (_owner)
+        {
+            _owner->release_resource(_id);
+        }
     }
 
     template <typename Tag>
-    TResourceReference<Tag>::TResourceReference(
-        const Id id,
-        Deleter deleter)
-        : _state(
-        std::make_shared<State>(
-            id,
-            std::move(deleter)))
+    TResourceReference<Tag>& TResourceReference<Tag>::operator=(const TResourceReference& other)
     {
+        auto copy = TResourceReference{other};
+        std::swap(
+            _id,
+            copy._id);
+        std::swap(
+            _owner,
+            copy._owner);
+
+        return *this;
+    }
+
+    template <typename Tag>
+    TResourceReference<Tag>& TResourceReference<Tag>::operator=(TResourceReference&& other) noexcept
+    {
+        // The old resource is released last, its destruction may release whatever holds this reference.
+        auto moved = TResourceReference{std::move(other)};
+        std::swap(
+            _id,
+            moved._id);
+        std::swap(
+            _owner,
+            moved._owner);
+
+        return *this;
     }
 
     template <typename Tag>
     TResourceReference<Tag>::Id TResourceReference<Tag>::get_id() const
     {
-        return _state->id;
+        return _id;
+    }
+
+    template <typename Tag>
+    TResourceReference<Tag>::Handle TResourceReference<Tag>::get_handle() const
+    {
+        return {_id};
+    }
+
+    template <typename Tag>
+    TResourceReference<Tag>::operator Handle() const
+    {
+        return get_handle();
     }
-}
\ No newline at end of file
+}
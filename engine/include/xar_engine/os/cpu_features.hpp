@@ -0,0 +1,22 @@
+#pragma once
+
+
+namespace xar_engine::os
+{
+    // Instruction set extensions the processor and the operating system both support. The AVX flags are only
+    // set when the operating system saves the wider registers on a context switch.
+    struct CpuFeatures
+    {
+        bool has_sse4_2;
+        bool has_avx;
+        bool has_avx2;
+        bool has_fma;
+        bool has_avx512f;
+        bool has_neon;
+    };
+
+
+    // Detected on the first call, the result does not change while the process runs.
+    [[nodiscard]]
+    const CpuFeatures& get_cpu_features();
+}
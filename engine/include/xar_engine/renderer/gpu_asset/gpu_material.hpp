@@ -7,4 +7,10 @@ namespace xar_engine::renderer::gpu_asset
 {
     enum class GpuMaterialTag;
     using GpuMaterialReference = meta::TResourceReference<GpuMaterialTag>;
+
+    enum class EGpuTexturePlacement
+    {
+        DEDICATED_IMAGE,
+        ATLAS_PAGE,
+    };
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include <xar_engine/renderer/gpu_asset/gpu_model.hpp>
 
-#include <xar_engine/math/matrix.hpp>
+#include <xar_engine/math/affine.hpp>
 
 
 namespace xar_engine::renderer::gpu_asset
@@ -10,6 +10,6 @@ namespace xar_engine::renderer::gpu_asset
     struct GpuMeshInstance
     {
         GpuMeshReference gpu_mesh;
-        math::Matrix4x4f model_matrix;
+        math::Affine3x4f model_matrix;
     };
 }
\ No newline at end of file
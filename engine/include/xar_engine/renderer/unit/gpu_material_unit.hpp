@@ -1,5 +1,8 @@
 #pragma once
 
+#include <filesystem>
+
+#include <xar_engine/asset/image.hpp>
 #include <xar_engine/asset/material.hpp>
 
 #include <xar_engine/renderer/gpu_asset/gpu_material.hpp>
@@ -11,16 +14,34 @@ namespace xar_engine::renderer::unit
     {
     public:
         struct MakeGpuMaterialParameters;
+        struct MakeGpuMaterialFromImageParameters;
+        struct MakeGpuMaterialFromCookedFileParameters;
 
     public:
         virtual ~IGpuMaterialUnit();
 
         virtual gpu_asset::GpuMaterialReference make_gpu_material(const MakeGpuMaterialParameters& parameters) = 0;
+        virtual gpu_asset::GpuMaterialReference make_gpu_material_from_image(const MakeGpuMaterialFromImageParameters& parameters) = 0;
+        // Reads a cooked .xtex file straight into staging memory, the pixels are not copied on the CPU.
+        virtual gpu_asset::GpuMaterialReference make_gpu_material_from_cooked_file(const MakeGpuMaterialFromCookedFileParameters& parameters) = 0;
     };
 
 
     struct IGpuMaterialUnit::MakeGpuMaterialParameters
     {
         asset::Material material;
+        gpu_asset::EGpuTexturePlacement texture_placement;
+    };
+
+    struct IGpuMaterialUnit::MakeGpuMaterialFromImageParameters
+    {
+        const asset::Image& color_base_image;
+        gpu_asset::EGpuTexturePlacement texture_placement;
+    };
+
+    struct IGpuMaterialUnit::MakeGpuMaterialFromCookedFileParameters
+    {
+        std::filesystem::path color_base_texture;
+        gpu_asset::EGpuTexturePlacement texture_placement;
     };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <filesystem>
 #include <vector>
 
 #include <xar_engine/asset/model.hpp>
@@ -13,11 +14,14 @@ namespace xar_engine::renderer::unit
     {
     public:
         struct MakeGpuModelParameters;
+        struct MakeGpuModelFromCookedFileParameters;
 
     public:
         virtual ~IGpuModelUnit();
 
         virtual std::vector<gpu_asset::GpuModel> make_gpu_model(const MakeGpuModelParameters& parameters) = 0;
+        // Copies the streams of cooked .xmesh files straight from the mapped files into staging memory.
+        virtual std::vector<gpu_asset::GpuModel> make_gpu_model_from_cooked_file(const MakeGpuModelFromCookedFileParameters& parameters) = 0;
     };
 
 
@@ -25,4 +29,9 @@ namespace xar_engine::renderer::unit
     {
         std::vector<asset::Model> model_list;
     };
+
+    struct IGpuModelUnit::MakeGpuModelFromCookedFileParameters
+    {
+        std::vector<std::filesystem::path> path_list;
+    };
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <xar_engine/asset/model.hpp>
+
+#include <xar_engine/math/affine.hpp>
+#include <xar_engine/math/quaternion.hpp>
+#include <xar_engine/math/vector.hpp>
+
+
+namespace xar_engine::scene
+{
+    // Transforms of a node hierarchy stored as parallel lists indexed by node, parents precede children.
+    // Local transforms can be changed freely, world_matrix_list is only valid after update_world_matrices.
+    struct TransformTable
+    {
+        std::vector<std::int32_t> parent_index_list;
+
+        std::vector<math::Vector3f> local_translation_list;
+        std::vector<math::Quaternionf> local_rotation_list;
+        std::vector<math::Vector3f> local_scale_list;
+
+        std::vector<math::Affine3x4f> world_matrix_list;
+    };
+
+
+    [[nodiscard]]
+    TransformTable make_transform_table(const asset::ModelNodeList& node_list);
+
+    // Resolves every world matrix in one forward pass, root nodes are placed relative to root_matrix.
+    void update_world_matrices(
+        TransformTable& transform_table,
+        const math::Affine3x4f& root_matrix);
+}
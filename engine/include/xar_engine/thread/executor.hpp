@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+
+namespace xar_engine::thread
+{
+    class IExecutor
+    {
+    public:
+        virtual ~IExecutor();
+
+        virtual void execute(std::function<void()> task) = 0;
+    };
+
+
+    // Collects tasks from any thread and runs them on the thread that calls run_pending(),
+    // e.g. once per frame on the main thread.
+    class QueueExecutor
+        : public IExecutor
+    {
+    public:
+        void execute(std::function<void()> task) override;
+
+        std::uint32_t run_pending();
+
+    private:
+        std::mutex _mutex;
+        std::vector<std::function<void()>> _task_list;
+    };
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <expected>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <xar_engine/thread/executor.hpp>
+
+
+namespace xar_engine::thread
+{
+    // Lazily started coroutine producing a T. It runs when awaited or passed to start_task and
+    // resumes its awaiter on whichever thread it finishes.
+    template <typename T>
+    class TTask
+    {
+    public:
+        class promise_type;
+
+    public:
+        TTask(TTask&& other) noexcept;
+        TTask& operator=(TTask&& other) noexcept;
+
+        ~TTask();
+
+
+        [[nodiscard]]
+        bool await_ready() const noexcept;
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept;
+        T await_resume();
+
+    private:
+        explicit TTask(std::coroutine_handle<promise_type> handle);
+
+    private:
+        std::coroutine_handle<promise_type> _handle;
+    };
+
+    template <typename T>
+    class TTask<T>::promise_type
+    {
+    public:
+        TTask get_return_object();
+
+        std::suspend_always initial_suspend() noexcept;
+        auto final_suspend() noexcept;
+
+        template <typename U>
+        void return_value(U&& value);
+        void unhandled_exception();
+
+        T get_result();
+
+    private:
+        friend class TTask;
+
+        std::coroutine_handle<> _continuation;
+        std::variant<std::monostate, T, std::exception_ptr> _result;
+    };
+
+
+    // Starts the task without awaiting it. on_completed receives the result or the thrown exception
+    // on the thread the task finished on.
+    template <typename T>
+    void start_task(
+        TTask<T> task,
+        std::type_identity_t<std::function<void(std::expected<T, std::exception_ptr>)>> on_completed);
+
+
+    template <typename T>
+    TTask<T>::TTask(std::coroutine_handle<promise_type> handle)
+        : _handle(handle)
+    {
+    }
+
+    template <typename T>
+    TTask<T>::TTask(TTask&& other) noexcept
+        : _handle(std::exchange(other._handle, nullptr))
+    {
+    }
+
+    template <typename T>
+    TTask<T>& TTask<T>::operator=(TTask&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle)
+            {
+                _handle.destroy();
+            }
+            _handle = std::exchange(other._handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    TTask<T>::~TTask()
+    {
+        if (_handle)
+        {
+            _handle.destroy();
+        }
+    }
+
+    template <typename T>
+    bool TTask<T>::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename T>
+    std::coroutine_handle<> TTask<T>::await_suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        _handle.promise()._continuation = continuation;
+        return _handle;
+    }
+
+    template <typename T>
+    T TTask<T>::await_resume()
+    {
+        return _handle.promise().get_result();
+    }
+
+
+    template <typename T>
+    TTask<T> TTask<T>::promise_type::get_return_object()
+    {
+        return TTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    template <typename T>
+    std::suspend_always TTask<T>::promise_type::initial_suspend() noexcept
+    {
+        return {};
+    }
+
+    template <typename T>
+    auto TTask<T>::promise_type::final_suspend() noexcept
+    {
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+            {
+                const auto continuation = handle.promise()._continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        return FinalAwaiter{};
+    }
+
+    template <typename T>
+    template <typename U>
+    void TTask<T>::promise_type::return_value(U&& value)
+    {
+        _result.template emplace<1>(std::forward<U>(value));
+    }
+
+    template <typename T>
+    void TTask<T>::promise_type::unhandled_exception()
+    {
+        _result.template emplace<2>(std::current_exception());
+    }
+
+    template <typename T>
+    T TTask<T>::promise_type::get_result()
+    {
+        if (_result.index() == 2)
+        {
+            std::rethrow_exception(std::get<2>(_result));
+        }
+
+        return std::move(std::get<1>(_result));
+    }
+
+
+    // Awaiting the result suspends the coroutine and resumes it from a task given to the executor.
+    [[nodiscard]]
+    inline auto resume_on(IExecutor& executor)
+    {
+        struct ResumeOnAwaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> handle) const
+            {
+                executor.execute(
+                    [handle]()
+                    {
+                        handle.resume();
+                    });
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+
+            IExecutor& executor;
+        };
+
+        return ResumeOnAwaiter{executor};
+    }
+
+
+    namespace task_detail
+    {
+        struct DetachedTask
+        {
+            struct promise_type
+            {
+                DetachedTask get_return_object() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() noexcept
+                {
+                    return {};
+                }
+
+                void return_void() noexcept
+                {
+                }
+
+                void unhandled_exception() noexcept
+                {
+                    std::terminate();
+                }
+            };
+        };
+
+        template <typename T>
+        DetachedTask run_detached(
+            TTask<T> task,
+            std::function<void(std::expected<T, std::exception_ptr>)> on_completed)
+        {
+            auto result = std::expected<T, std::exception_ptr>{std::unexpect, nullptr};
+            try
+            {
+                result = co_await std::move(task);
+            }
+            catch (...)
+            {
+                result = std::unexpected{std::current_exception()};
+            }
+
+            on_completed(std::move(result));
+        }
+    }
+
+    template <typename T>
+    void start_task(
+        TTask<T> task,
+        std::type_identity_t<std::function<void(std::expected<T, std::exception_ptr>)>> on_completed)
+    {
+        task_detail::run_detached(
+            std::move(task),
+            std::move(on_completed));
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <xar_engine/thread/executor.hpp>
+
+
+namespace xar_engine::thread
+{
+    class ThreadPool
+        : public IExecutor
+    {
+    public:
+        explicit ThreadPool(std::uint32_t worker_count);
+
+        ~ThreadPool() override;
+
+
+        void execute(std::function<void()> task) override;
+
+
+        template <typename TFunction>
+        std::future<std::invoke_result_t<TFunction>> submit(TFunction&& function);
+
+        // Calls function(index) for every index in [0, count) on the workers and waits for all of them.
+        // The first exception thrown by any call is rethrown to the caller. Must not be called from a worker of the same pool.
+        void parallel_for(
+            std::size_t count,
+            const std::function<void(std::size_t)>& function);
+
+
+        [[nodiscard]]
+        std::uint32_t get_worker_count() const;
+
+        [[nodiscard]]
+        static std::uint32_t get_default_worker_count();
+
+    private:
+        void push_task(std::function<void()> task);
+        void run_worker();
+
+    private:
+        std::mutex _mutex;
+        std::condition_variable _condition_variable;
+        std::queue<std::function<void()>> _task_queue;
+        bool _stopping;
+
+        std::vector<std::thread> _worker_list;
+    };
+
+
+    template <typename TFunction>
+    std::future<std::invoke_result_t<TFunction>> ThreadPool::submit(TFunction&& function)
+    {
+        using Result = std::invoke_result_t<TFunction>;
+
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<TFunction>(function));
+        auto future = task->get_future();
+
+        push_task(
+            [task = std::move(task)]()
+            {
+                (*task)();
+            });
+
+        return future;
+    }
+}
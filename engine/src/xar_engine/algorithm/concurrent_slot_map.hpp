@@ -0,0 +1,264 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::algorithm
+{
+    // Slot map with the keys of TSlotMap that can be used from several threads. Values never move, they live in
+    // pages of slots that are allocated on demand and kept until the map is destroyed, so find() is lock-free:
+    // two atomic loads and a key compare. Emplace and erase only lock to take or return a slot index, values
+    // are constructed and destroyed outside the lock.
+    // find() does not keep the value alive, the caller has to make sure no other thread erases it meanwhile.
+    template <typename T>
+    class TConcurrentSlotMap
+    {
+    public:
+        using Key = std::uint32_t;
+
+        static constexpr auto INDEX_BIT_COUNT = 20u;
+        static constexpr auto GENERATION_BIT_COUNT = 32u - INDEX_BIT_COUNT;
+        static constexpr auto INDEX_MASK = (std::uint32_t{1} << INDEX_BIT_COUNT) - 1;
+        static constexpr auto MAX_SIZE = INDEX_MASK;
+        static constexpr auto INVALID_KEY = ~Key{0};
+
+        static constexpr auto PAGE_SLOT_COUNT = std::uint32_t{1024};
+
+    public:
+        TConcurrentSlotMap();
+
+        TConcurrentSlotMap(const TConcurrentSlotMap&) = delete;
+        TConcurrentSlotMap& operator=(const TConcurrentSlotMap&) = delete;
+
+
+        template <typename... TArgs>
+        Key emplace(TArgs&&... args);
+
+        // Returns false when the key is stale or another thread erased it first.
+        bool erase(Key key);
+
+
+        // Returns nullptr when the key is stale.
+        [[nodiscard]]
+        const T* find(Key key) const;
+        [[nodiscard]]
+        T* find(Key key);
+
+        [[nodiscard]]
+        std::size_t size() const;
+
+    private:
+        struct Slot;
+
+    private:
+        static constexpr auto PAGE_COUNT = (MAX_SIZE + PAGE_SLOT_COUNT - 1) / PAGE_SLOT_COUNT;
+        static constexpr auto GENERATION_MASK = (std::uint32_t{1} << GENERATION_BIT_COUNT) - 1;
+
+    private:
+        [[nodiscard]]
+        Slot* find_slot(Key key) const;
+
+        [[nodiscard]]
+        Slot& get_slot(std::uint32_t slot_index) const;
+
+        [[nodiscard]]
+        std::uint32_t allocate_slot_index();
+        void free_slot_index(std::uint32_t slot_index);
+
+    private:
+        std::array<std::atomic<Slot*>, PAGE_COUNT> _page_list;
+        std::atomic<std::size_t> _size;
+
+        std::mutex _mutex;
+        std::vector<std::unique_ptr<Slot[]>> _owned_page_list;
+        std::vector<std::uint32_t> _free_slot_index_list;
+        std::uint32_t _next_unused_slot_index;
+    };
+
+
+    template <typename T>
+    struct TConcurrentSlotMap<T>::Slot
+    {
+        // The key of the value while the slot holds one, INVALID_KEY otherwise. Published after the value is
+        // constructed, so a reader that sees its key also sees the value.
+        std::atomic<Key> key{INVALID_KEY};
+        std::optional<T> value;
+
+        // Guarded by the map mutex.
+        std::uint32_t generation = 0;
+    };
+
+
+    template <typename T>
+    TConcurrentSlotMap<T>::TConcurrentSlotMap()
+        : _page_list{}
+        , _size(0)
+        , _mutex{}
+        , _owned_page_list{}
+        , _free_slot_index_list{}
+        , _next_unused_slot_index(0)
+    {
+    }
+
+    template <typename T>
+    template <typename... TArgs>
+    TConcurrentSlotMap<T>::Key TConcurrentSlotMap<T>::emplace(TArgs&&... args)
+    {
+        const auto slot_index = allocate_slot_index();
+        auto& slot = get_slot(slot_index);
+
+        try
+        {
+            slot.value.emplace(std::forward<TArgs>(args)...);
+        }
+        catch (...)
+        {
+            free_slot_index(slot_index);
+            throw;
+        }
+
+        // The generation only changes while the slot is free, so it is safe to read outside the lock here.
+        const auto key = (slot.generation << INDEX_BIT_COUNT) | slot_index;
+        _size.fetch_add(
+            1,
+            std::memory_order_relaxed);
+        slot.key.store(
+            key,
+            std::memory_order_release);
+
+        return key;
+    }
+
+    template <typename T>
+    bool TConcurrentSlotMap<T>::erase(const Key key)
+    {
+        auto* const slot = find_slot(key);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+
+        auto expected_key = key;
+        if (!slot->key.compare_exchange_strong(
+            expected_key,
+            INVALID_KEY,
+            std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        _size.fetch_sub(
+            1,
+            std::memory_order_relaxed);
+        slot->value.reset();
+
+        {
+            auto lock = std::lock_guard{_mutex};
+
+            slot->generation = (slot->generation + 1) & GENERATION_MASK;
+            if (slot->generation != 0)
+            {
+                _free_slot_index_list.push_back(key & INDEX_MASK);
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    const T* TConcurrentSlotMap<T>::find(const Key key) const
+    {
+        const auto* const slot = find_slot(key);
+        return slot != nullptr ? &*slot->value : nullptr;
+    }
+
+    template <typename T>
+    T* TConcurrentSlotMap<T>::find(const Key key)
+    {
+        auto* const slot = find_slot(key);
+        return slot != nullptr ? &*slot->value : nullptr;
+    }
+
+    template <typename T>
+    std::size_t TConcurrentSlotMap<T>::size() const
+    {
+        return _size.load(std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    TConcurrentSlotMap<T>::Slot* TConcurrentSlotMap<T>::find_slot(const Key key) const
+    {
+        const auto slot_index = key & INDEX_MASK;
+        if (slot_index == INDEX_MASK)
+        {
+            return nullptr;
+        }
+
+        auto* const page = _page_list[slot_index / PAGE_SLOT_COUNT].load(std::memory_order_acquire);
+        if (page == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto& slot = page[slot_index % PAGE_SLOT_COUNT];
+        if (slot.key.load(std::memory_order_acquire) != key)
+        {
+            return nullptr;
+        }
+
+        return &slot;
+    }
+
+    template <typename T>
+    TConcurrentSlotMap<T>::Slot& TConcurrentSlotMap<T>::get_slot(const std::uint32_t slot_index) const
+    {
+        return _page_list[slot_index / PAGE_SLOT_COUNT].load(std::memory_order_acquire)[slot_index % PAGE_SLOT_COUNT];
+    }
+
+    template <typename T>
+    std::uint32_t TConcurrentSlotMap<T>::allocate_slot_index()
+    {
+        auto lock = std::lock_guard{_mutex};
+
+        if (!_free_slot_index_list.empty())
+        {
+            const auto slot_index = _free_slot_index_list.back();
+            _free_slot_index_list.pop_back();
+
+            return slot_index;
+        }
+
+        XAR_THROW_IF(
+            _next_unused_slot_index == MAX_SIZE,
+            error::XarException,
+            "Slot map has no free slot left, the limit is {}",
+            MAX_SIZE);
+
+        const auto slot_index = _next_unused_slot_index++;
+        if (slot_index % PAGE_SLOT_COUNT == 0)
+        {
+            _owned_page_list.push_back(std::make_unique<Slot[]>(PAGE_SLOT_COUNT));
+            _page_list[slot_index / PAGE_SLOT_COUNT].store(
+                _owned_page_list.back().get(),
+                std::memory_order_release);
+        }
+
+        return slot_index;
+    }
+
+    template <typename T>
+    void TConcurrentSlotMap<T>::free_slot_index(const std::uint32_t slot_index)
+    {
+        auto lock = std::lock_guard{_mutex};
+        _free_slot_index_list.push_back(slot_index);
+    }
+}
@@ -0,0 +1,89 @@
+#include <xar_engine/algorithm/shelf_packer.hpp>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::algorithm
+{
+    namespace
+    {
+        std::uint32_t align_up(
+            std::uint32_t value,
+            std::uint32_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    ShelfPacker::ShelfPacker(
+        math::Vector2u32 dimension,
+        std::uint32_t alignment)
+        : _dimension(dimension)
+        , _alignment(alignment)
+        , _used_height(0)
+        , _shelf_list()
+    {
+        XAR_THROW_IF(
+            _alignment == 0,
+            error::XarException,
+            "Alignment must be greater than 0");
+    }
+
+    std::optional<math::Vector2u32> ShelfPacker::pack(math::Vector2u32 dimension)
+    {
+        const auto aligned_width = align_up(
+            dimension.x,
+            _alignment);
+        const auto aligned_height = align_up(
+            dimension.y,
+            _alignment);
+
+        if (aligned_width > _dimension.x || aligned_height > _dimension.y)
+        {
+            return std::nullopt;
+        }
+
+        Shelf* best_shelf = nullptr;
+        for (auto& shelf: _shelf_list)
+        {
+            if (shelf.height < aligned_height || _dimension.x - shelf.used_width < aligned_width)
+            {
+                continue;
+            }
+
+            if (best_shelf == nullptr || shelf.height < best_shelf->height)
+            {
+                best_shelf = &shelf;
+            }
+        }
+
+        if (best_shelf == nullptr)
+        {
+            if (_dimension.y - _used_height < aligned_height)
+            {
+                return std::nullopt;
+            }
+
+            best_shelf = &_shelf_list.emplace_back(
+                Shelf{
+                    _used_height,
+                    aligned_height,
+                    0,
+                });
+            _used_height += aligned_height;
+        }
+
+        const auto position = math::Vector2u32{
+            best_shelf->used_width,
+            best_shelf->y,
+        };
+        best_shelf->used_width += aligned_width;
+
+        return position;
+    }
+
+    const math::Vector2u32& ShelfPacker::get_dimension() const
+    {
+        return _dimension;
+    }
+}
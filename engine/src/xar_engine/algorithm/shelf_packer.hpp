@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <xar_engine/math/vector.hpp>
+
+
+namespace xar_engine::algorithm
+{
+    class ShelfPacker
+    {
+    public:
+        ShelfPacker(
+            math::Vector2u32 dimension,
+            std::uint32_t alignment);
+
+
+        std::optional<math::Vector2u32> pack(math::Vector2u32 dimension);
+
+
+        [[nodiscard]]
+        const math::Vector2u32& get_dimension() const;
+
+    private:
+        struct Shelf
+        {
+            std::uint32_t y;
+            std::uint32_t height;
+            std::uint32_t used_width;
+        };
+
+    private:
+        math::Vector2u32 _dimension;
+        std::uint32_t _alignment;
+        std::uint32_t _used_height;
+        std::vector<Shelf> _shelf_list;
+    };
+}
@@ -0,0 +1,66 @@
+#include <xar_engine/algorithm/slot_allocator.hpp>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::algorithm
+{
+    SlotAllocator::SlotAllocator(std::uint32_t capacity)
+        : _capacity(capacity)
+        , _next_unused_slot(0)
+        , _free_slot_list()
+        , _allocated_slot_list(capacity, false)
+    {
+    }
+
+    std::uint32_t SlotAllocator::allocate()
+    {
+        auto slot = _next_unused_slot;
+        if (!_free_slot_list.empty())
+        {
+            slot = _free_slot_list.back();
+            _free_slot_list.pop_back();
+        }
+        else
+        {
+            XAR_THROW_IF(
+                _next_unused_slot == _capacity,
+                error::XarException,
+                "All {} slots are allocated",
+                _capacity);
+
+            ++_next_unused_slot;
+        }
+
+        _allocated_slot_list[slot] = true;
+
+        return slot;
+    }
+
+    void SlotAllocator::free(std::uint32_t slot)
+    {
+        XAR_THROW_IF(
+            !is_allocated(slot),
+            error::XarException,
+            "Slot {} is not allocated",
+            slot);
+
+        _allocated_slot_list[slot] = false;
+        _free_slot_list.push_back(slot);
+    }
+
+    bool SlotAllocator::is_allocated(std::uint32_t slot) const
+    {
+        return slot < _capacity && _allocated_slot_list[slot];
+    }
+
+    std::uint32_t SlotAllocator::get_allocated_count() const
+    {
+        return _next_unused_slot - static_cast<std::uint32_t>(_free_slot_list.size());
+    }
+
+    std::uint32_t SlotAllocator::get_capacity() const
+    {
+        return _capacity;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+
+namespace xar_engine::algorithm
+{
+    class SlotAllocator
+    {
+    public:
+        explicit SlotAllocator(std::uint32_t capacity);
+
+
+        std::uint32_t allocate();
+        void free(std::uint32_t slot);
+
+
+        [[nodiscard]]
+        bool is_allocated(std::uint32_t slot) const;
+
+        [[nodiscard]]
+        std::uint32_t get_allocated_count() const;
+
+        [[nodiscard]]
+        std::uint32_t get_capacity() const;
+
+    private:
+        std::uint32_t _capacity;
+        std::uint32_t _next_unused_slot;
+        std::vector<std::uint32_t> _free_slot_list;
+        std::vector<bool> _allocated_slot_list;
+    };
+}
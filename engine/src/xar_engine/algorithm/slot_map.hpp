@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::algorithm
+{
+    // Dense slot map. Values live contiguously and are found through a slot array in O(1), keys carry the slot
+    // index in the low bits and the slot generation in the high bits, so a key of an erased value never finds
+    // the value that reuses its slot. A slot whose generation would wrap is retired instead of reused. The last
+    // index is never used, so INVALID_KEY never finds a value.
+    // Erase moves the last value into the hole, so pointers and references to values are invalidated by add
+    // and erase.
+    template <typename T>
+    class TSlotMap
+    {
+    public:
+        using Key = std::uint32_t;
+
+        static constexpr auto INDEX_BIT_COUNT = 20u;
+        static constexpr auto GENERATION_BIT_COUNT = 32u - INDEX_BIT_COUNT;
+        static constexpr auto INDEX_MASK = (std::uint32_t{1} << INDEX_BIT_COUNT) - 1;
+        static constexpr auto MAX_SIZE = INDEX_MASK;
+        static constexpr auto INVALID_KEY = ~Key{0};
+
+    public:
+        TSlotMap();
+
+
+        Key add(T&& value);
+
+        // Returns false when the key is stale.
+        bool erase(Key key);
+
+
+        [[nodiscard]]
+        bool contains(Key key) const;
+
+        // Returns nullptr when the key is stale.
+        [[nodiscard]]
+        const T* find(Key key) const;
+        [[nodiscard]]
+        T* find(Key key);
+
+        // In no particular order.
+        [[nodiscard]]
+        std::span<const T> get_value_list() const;
+        [[nodiscard]]
+        std::span<T> get_value_list();
+
+        [[nodiscard]]
+        std::size_t size() const;
+
+    private:
+        struct Slot;
+
+    private:
+        static constexpr auto GENERATION_MASK = (std::uint32_t{1} << GENERATION_BIT_COUNT) - 1;
+        static constexpr auto FREE_SLOT = ~std::uint32_t{0};
+
+    private:
+        [[nodiscard]]
+        const Slot* find_slot(Key key) const;
+
+    private:
+        std::vector<T> _value_list;
+        std::vector<std::uint32_t> _value_slot_index_list;
+        std::vector<Slot> _slot_list;
+        std::vector<std::uint32_t> _free_slot_index_list;
+    };
+
+
+    template <typename T>
+    struct TSlotMap<T>::Slot
+    {
+        std::uint32_t value_index;
+        std::uint32_t generation;
+    };
+
+
+    template <typename T>
+    TSlotMap<T>::TSlotMap()
+        : _value_list{}
+        , _value_slot_index_list{}
+        , _slot_list{}
+        , _free_slot_index_list{}
+    {
+    }
+
+    template <typename T>
+    TSlotMap<T>::Key TSlotMap<T>::add(T&& value)
+    {
+        auto slot_index = std::uint32_t{0};
+        if (!_free_slot_index_list.empty())
+        {
+            slot_index = _free_slot_index_list.back();
+            _free_slot_index_list.pop_back();
+        }
+        else
+        {
+            XAR_THROW_IF(
+                _slot_list.size() == MAX_SIZE,
+                error::XarException,
+                "Slot map has no free slot left, the limit is {}",
+                MAX_SIZE);
+
+            slot_index = static_cast<std::uint32_t>(_slot_list.size());
+            _slot_list.push_back({FREE_SLOT, 0});
+        }
+
+        auto& slot = _slot_list[slot_index];
+        slot.value_index = static_cast<std::uint32_t>(_value_list.size());
+        _value_list.push_back(std::forward<T>(value));
+        _value_slot_index_list.push_back(slot_index);
+
+        return (slot.generation << INDEX_BIT_COUNT) | slot_index;
+    }
+
+    template <typename T>
+    bool TSlotMap<T>::erase(const Key key)
+    {
+        if (find_slot(key) == nullptr)
+        {
+            return false;
+        }
+
+        const auto slot_index = key & INDEX_MASK;
+        auto& slot = _slot_list[slot_index];
+
+        // Destroyed on return, when the map is consistent again, since the destructor may erase other values.
+        [[maybe_unused]] const auto erased_value = std::move(_value_list[slot.value_index]);
+
+        const auto last_value_index = static_cast<std::uint32_t>(_value_list.size() - 1);
+        if (slot.value_index != last_value_index)
+        {
+            const auto last_slot_index = _value_slot_index_list[last_value_index];
+            _value_list[slot.value_index] = std::move(_value_list[last_value_index]);
+            _value_slot_index_list[slot.value_index] = last_slot_index;
+            _slot_list[last_slot_index].value_index = slot.value_index;
+        }
+
+        _value_list.pop_back();
+        _value_slot_index_list.pop_back();
+
+        slot.value_index = FREE_SLOT;
+        slot.generation = (slot.generation + 1) & GENERATION_MASK;
+        if (slot.generation != 0)
+        {
+            _free_slot_index_list.push_back(slot_index);
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool TSlotMap<T>::contains(const Key key) const
+    {
+        return find_slot(key) != nullptr;
+    }
+
+    template <typename T>
+    const T* TSlotMap<T>::find(const Key key) const
+    {
+        const auto* const slot = find_slot(key);
+        return slot != nullptr ? &_value_list[slot->value_index] : nullptr;
+    }
+
+    template <typename T>
+    T* TSlotMap<T>::find(const Key key)
+    {
+        const auto* const slot = find_slot(key);
+        return slot != nullptr ? &_value_list[slot->value_index] : nullptr;
+    }
+
+    template <typename T>
+    std::span<const T> TSlotMap<T>::get_value_list() const
+    {
+        return _value_list;
+    }
+
+    template <typename T>
+    std::span<T> TSlotMap<T>::get_value_list()
+    {
+        return _value_list;
+    }
+
+    template <typename T>
+    std::size_t TSlotMap<T>::size() const
+    {
+        return _value_list.size();
+    }
+
+    template <typename T>
+    const TSlotMap<T>::Slot* TSlotMap<T>::find_slot(const Key key) const
+    {
+        const auto slot_index = key & INDEX_MASK;
+        if (slot_index >= _slot_list.size())
+        {
+            return nullptr;
+        }
+
+        const auto& slot = _slot_list[slot_index];
+        if (slot.value_index == FREE_SLOT || slot.generation != (key >> INDEX_BIT_COUNT))
+        {
+            return nullptr;
+        }
+
+        return &slot;
+    }
+}
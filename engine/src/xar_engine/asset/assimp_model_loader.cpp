@@ -1,5 +1,9 @@
 #include <xar_engine/asset/assimp_model_loader.hpp>
 
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
@@ -11,6 +15,8 @@ namespace xar_engine::asset
 {
     namespace
     {
+        static_assert(std::is_same_v<ai_real, float> && sizeof(aiVector3D) == sizeof(math::Vector3f));
+
         class MeshParser
         {
         public:
@@ -25,8 +31,10 @@ namespace xar_engine::asset
                 return {
                     parse_positions(),
                     parse_normals(),
+                    {},
                     parse_texture_coords(),
-                    parse_indices()
+                    parse_indices(),
+                    {}
                 };
             }
 
@@ -39,18 +47,7 @@ namespace xar_engine::asset
                     return {};
                 }
 
-                auto positions = std::vector<math::Vector3f>(_ai_mesh.mNumVertices);
-                for (auto ai_vertex_index = 0; ai_vertex_index < _ai_mesh.mNumVertices; ++ai_vertex_index)
-                {
-                    auto& vertex = positions[ai_vertex_index];
-                    const auto& ai_vertex = _ai_mesh.mVertices[ai_vertex_index];
-
-                    vertex.x = ai_vertex.x;
-                    vertex.y = ai_vertex.y;
-                    vertex.z = ai_vertex.z;
-                }
-
-                return positions;
+                return copy_vectors(_ai_mesh.mVertices);
             }
 
             [[nodiscard]]
@@ -61,18 +58,7 @@ namespace xar_engine::asset
                     return {};
                 }
 
-                auto normals = std::vector<math::Vector3f>(_ai_mesh.mNumVertices);
-                for (auto ai_vertex_index = 0; ai_vertex_index < _ai_mesh.mNumVertices; ++ai_vertex_index)
-                {
-                    auto& vertex = normals[ai_vertex_index];
-                    const auto& ai_vertex = _ai_mesh.mNormals[ai_vertex_index];
-
-                    vertex.x = ai_vertex.x;
-                    vertex.y = ai_vertex.y;
-                    vertex.z = ai_vertex.z;
-                }
-
-                return normals;
+                return copy_vectors(_ai_mesh.mNormals);
             }
 
             [[nodiscard]]
@@ -106,19 +92,33 @@ namespace xar_engine::asset
 
                 auto indices = std::vector<std::uint32_t>(_ai_mesh.mNumFaces * 3);
 
-                for (auto ai_face_index = 0; ai_face_index < _ai_mesh.mNumFaces; ++ai_face_index)
+                // aiProcess_Triangulate leaves only triangles, so every face contributes exactly three indices.
+                auto* index = indices.data();
+                const auto* const ai_face_end = _ai_mesh.mFaces + _ai_mesh.mNumFaces;
+                for (const auto* ai_face = _ai_mesh.mFaces; ai_face != ai_face_end; ++ai_face, index += 3)
                 {
-                    const auto index = ai_face_index * 3;
-                    const auto& ai_face = _ai_mesh.mFaces[ai_face_index];
+                    const auto* const ai_face_indices = ai_face->mIndices;
 
-                    indices[index + 0] = ai_face.mIndices[0];
-                    indices[index + 1] = ai_face.mIndices[1];
-                    indices[index + 2] = ai_face.mIndices[2];
+                    index[0] = ai_face_indices[0];
+                    index[1] = ai_face_indices[1];
+                    index[2] = ai_face_indices[2];
                 }
 
                 return indices;
             }
 
+            [[nodiscard]]
+            std::vector<math::Vector3f> copy_vectors(const aiVector3D* ai_vectors) const
+            {
+                auto vectors = std::vector<math::Vector3f>(_ai_mesh.mNumVertices);
+                std::memcpy(
+                    vectors.data(),
+                    ai_vectors,
+                    vectors.size() * sizeof(math::Vector3f));
+
+                return vectors;
+            }
+
         private:
             const aiMesh& _ai_mesh;
         };
@@ -126,9 +126,12 @@ namespace xar_engine::asset
         class SceneParser
         {
         public:
-            explicit SceneParser(std::filesystem::path path)
+            SceneParser(
+                std::filesystem::path path,
+                thread::ThreadPool& thread_pool)
                 : _scene(nullptr)
                 , _path(std::move(path))
+                , _thread_pool(thread_pool)
             {
             }
 
@@ -152,6 +155,8 @@ namespace xar_engine::asset
                 return {
                     parse_metadata(),
                     parse_meshes(),
+                    parse_nodes(),
+                    {}
                 };
             }
 
@@ -166,26 +171,83 @@ namespace xar_engine::asset
 
             std::vector<Mesh> parse_meshes() const
             {
-                std::vector<Mesh> meshes;
-                meshes.reserve(_scene->mNumMeshes);
+                auto meshes = std::vector<Mesh>(_scene->mNumMeshes);
+
+                _thread_pool.parallel_for(
+                    meshes.size(),
+                    [this, &meshes](std::size_t ai_mesh_index)
+                    {
+                        auto mesh_parser = MeshParser{*_scene->mMeshes[ai_mesh_index]};
+                        meshes[ai_mesh_index] = mesh_parser.parse_mesh();
+                    });
+
+                return meshes;
+            }
+
+            ModelNodeList parse_nodes() const
+            {
+                auto node_list = ModelNodeList{};
 
-                for (auto ai_mesh_index = 0; ai_mesh_index < _scene->mNumMeshes; ++ai_mesh_index)
+                // Breadth-first order places every parent ahead of its children.
+                auto ai_node_list = std::vector<std::pair<const aiNode*, std::int32_t>>{
+                    {_scene->mRootNode, NO_PARENT_NODE_INDEX}
+                };
+                for (auto node_index = std::size_t{0}; node_index < ai_node_list.size(); ++node_index)
                 {
-                    auto mesh_parser = MeshParser{*_scene->mMeshes[ai_mesh_index]};
-                    meshes.push_back(mesh_parser.parse_mesh());
+                    const auto [ai_node, parent_index] = ai_node_list[node_index];
+
+                    auto ai_scaling = aiVector3D{};
+                    auto ai_rotation = aiQuaternion{};
+                    auto ai_position = aiVector3D{};
+                    ai_node->mTransformation.Decompose(
+                        ai_scaling,
+                        ai_rotation,
+                        ai_position);
+
+                    node_list.parent_index_list.push_back(parent_index);
+                    node_list.translation_list.push_back({ai_position.x, ai_position.y, ai_position.z});
+                    node_list.rotation_list.push_back({ai_rotation.x, ai_rotation.y, ai_rotation.z, ai_rotation.w});
+                    node_list.scale_list.push_back({ai_scaling.x, ai_scaling.y, ai_scaling.z});
+                    node_list.mesh_index_offset_list.push_back(static_cast<std::uint32_t>(node_list.mesh_index_list.size()));
+                    node_list.mesh_index_count_list.push_back(ai_node->mNumMeshes);
+                    node_list.mesh_index_list.insert(
+                        node_list.mesh_index_list.end(),
+                        ai_node->mMeshes,
+                        ai_node->mMeshes + ai_node->mNumMeshes);
+
+                    for (auto ai_child_index = 0u; ai_child_index < ai_node->mNumChildren; ++ai_child_index)
+                    {
+                        ai_node_list.emplace_back(
+                            ai_node->mChildren[ai_child_index],
+                            static_cast<std::int32_t>(node_index));
+                    }
                 }
 
-                return meshes;
+                return node_list;
             }
 
         private:
             mutable const aiScene* _scene;
             std::filesystem::path _path;
+            thread::ThreadPool& _thread_pool;
         };
     }
 
+    AssimpModelLoader::AssimpModelLoader()
+        : AssimpModelLoader(std::make_shared<thread::ThreadPool>(thread::ThreadPool::get_default_worker_count()))
+    {
+    }
+
+    AssimpModelLoader::AssimpModelLoader(std::shared_ptr<thread::ThreadPool> thread_pool)
+        : _thread_pool(std::move(thread_pool))
+    {
+    }
+
     Model AssimpModelLoader::load_model_from_file(const std::filesystem::path& path) const
     {
-        return SceneParser{path}.parse_scene();
+        return SceneParser{
+            path,
+            *_thread_pool
+        }.parse_scene();
     }
 }
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <memory>
+
 #include <xar_engine/asset/model_loader.hpp>
 
+#include <xar_engine/thread/thread_pool.hpp>
+
 
 namespace xar_engine::asset
 {
@@ -9,7 +13,14 @@ namespace xar_engine::asset
         : public IModelLoader
     {
     public:
+        AssimpModelLoader();
+        explicit AssimpModelLoader(std::shared_ptr<thread::ThreadPool> thread_pool);
+
+
         [[nodiscard]]
         Model load_model_from_file(const std::filesystem::path& path) const override;
+
+    private:
+        std::shared_ptr<thread::ThreadPool> _thread_pool;
     };
 }
\ No newline at end of file
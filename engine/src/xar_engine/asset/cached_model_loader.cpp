@@ -0,0 +1,100 @@
+#include <xar_engine/asset/cached_model_loader.hpp>
+
+#include <xar_engine/asset/xmesh_model_file.hpp>
+
+#include <xar_engine/logging/logger.hpp>
+
+
+namespace xar_engine::asset
+{
+    namespace
+    {
+        constexpr auto tag = "CachedModelLoader";
+    }
+
+    CachedModelLoader::CachedModelLoader(std::unique_ptr<IModelLoader> source_model_loader)
+        : _source_model_loader(std::move(source_model_loader))
+    {
+    }
+
+    Model CachedModelLoader::load_model_from_file(const std::filesystem::path& path) const
+    {
+        if (path.extension() == xmesh::FILE_EXTENSION)
+        {
+            return XmeshModelLoader{}.load_model_from_file(path);
+        }
+
+        const auto cache_path = get_cache_path(path);
+        if (is_cache_valid(
+            path,
+            cache_path))
+        {
+            try
+            {
+                return XmeshModelLoader{}.load_model_from_file(cache_path);
+            }
+            catch (const std::exception& exception)
+            {
+                XAR_LOG(
+                    logging::LogLevel::WARNING,
+                    tag,
+                    "Failed to load model cache '{}', source will be imported again: {}",
+                    cache_path.string(),
+                    exception.what());
+            }
+        }
+
+        auto model = _source_model_loader->load_model_from_file(path);
+
+        try
+        {
+            xmesh::write_model_to_file(
+                model,
+                cache_path);
+        }
+        catch (const std::exception& exception)
+        {
+            XAR_LOG(
+                logging::LogLevel::WARNING,
+                tag,
+                "Failed to write model cache '{}': {}",
+                cache_path.string(),
+                exception.what());
+        }
+
+        return model;
+    }
+
+    std::filesystem::path CachedModelLoader::get_cache_path(const std::filesystem::path& path)
+    {
+        auto cache_path = path;
+        cache_path += xmesh::FILE_EXTENSION;
+
+        return cache_path;
+    }
+
+    bool CachedModelLoader::is_cache_valid(
+        const std::filesystem::path& path,
+        const std::filesystem::path& cache_path) const
+    {
+        auto error_code = std::error_code{};
+
+        const auto cache_write_time = std::filesystem::last_write_time(
+            cache_path,
+            error_code);
+        if (error_code)
+        {
+            return false;
+        }
+
+        const auto source_write_time = std::filesystem::last_write_time(
+            path,
+            error_code);
+        if (error_code)
+        {
+            return false;
+        }
+
+        return cache_write_time >= source_write_time;
+    }
+}
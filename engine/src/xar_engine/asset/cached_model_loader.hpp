@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+
+#include <xar_engine/asset/model_loader.hpp>
+
+
+namespace xar_engine::asset
+{
+    // Loads '<path>.xmesh' when it is not older than the source file. Otherwise imports the source
+    // with the wrapped loader and writes the cache for the next run.
+    class CachedModelLoader
+        : public IModelLoader
+    {
+    public:
+        explicit CachedModelLoader(std::unique_ptr<IModelLoader> source_model_loader);
+
+
+        [[nodiscard]]
+        Model load_model_from_file(const std::filesystem::path& path) const override;
+
+        [[nodiscard]]
+        static std::filesystem::path get_cache_path(const std::filesystem::path& path);
+
+    private:
+        [[nodiscard]]
+        bool is_cache_valid(
+            const std::filesystem::path& path,
+            const std::filesystem::path& cache_path) const;
+
+    private:
+        std::unique_ptr<IModelLoader> _source_model_loader;
+    };
+}
@@ -0,0 +1,52 @@
+#include <xar_engine/asset/extension_model_loader.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+
+namespace xar_engine::asset
+{
+    namespace
+    {
+        std::string to_lowercase(std::string text)
+        {
+            std::ranges::transform(
+                text,
+                text.begin(),
+                [](unsigned char character)
+                {
+                    return static_cast<char>(std::tolower(character));
+                });
+
+            return text;
+        }
+    }
+
+    ExtensionModelLoader::ExtensionModelLoader(std::unique_ptr<IModelLoader> fallback_model_loader)
+        : _fallback_model_loader(std::move(fallback_model_loader))
+    {
+    }
+
+    void ExtensionModelLoader::add_model_loader(
+        const std::string& file_extension,
+        std::unique_ptr<IModelLoader> model_loader)
+    {
+        _model_loader_map[to_lowercase(file_extension)] = std::move(model_loader);
+    }
+
+    Model ExtensionModelLoader::load_model_from_file(const std::filesystem::path& path) const
+    {
+        return get_model_loader(path).load_model_from_file(path);
+    }
+
+    const IModelLoader& ExtensionModelLoader::get_model_loader(const std::filesystem::path& path) const
+    {
+        const auto model_loader_it = _model_loader_map.find(to_lowercase(path.extension().string()));
+        if (model_loader_it == _model_loader_map.end())
+        {
+            return *_fallback_model_loader;
+        }
+
+        return *model_loader_it->second;
+    }
+}
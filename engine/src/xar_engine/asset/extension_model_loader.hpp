@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <xar_engine/asset/model_loader.hpp>
+
+
+namespace xar_engine::asset
+{
+    // Picks a loader by the lowercase file extension of the path, e.g. ".obj".
+    class ExtensionModelLoader
+        : public IModelLoader
+    {
+    public:
+        explicit ExtensionModelLoader(std::unique_ptr<IModelLoader> fallback_model_loader);
+
+
+        void add_model_loader(
+            const std::string& file_extension,
+            std::unique_ptr<IModelLoader> model_loader);
+
+
+        [[nodiscard]]
+        Model load_model_from_file(const std::filesystem::path& path) const override;
+
+        [[nodiscard]]
+        const IModelLoader& get_model_loader(const std::filesystem::path& path) const;
+
+    private:
+        std::unique_ptr<IModelLoader> _fallback_model_loader;
+        std::unordered_map<std::string, std::unique_ptr<IModelLoader>> _model_loader_map;
+    };
+}
@@ -1,10 +1,228 @@
 #include <xar_engine/asset/image.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/meta/enum_impl.hpp>
+
 
 namespace xar_engine::asset::image
 {
+    std::uint32_t get_channel_count(EPixelFormat pixel_format)
+    {
+        switch (pixel_format)
+        {
+            case EPixelFormat::R8:
+            case EPixelFormat::R16_FLOAT:
+            {
+                return 1;
+            }
+            case EPixelFormat::R8G8:
+            {
+                return 2;
+            }
+            case EPixelFormat::R8G8B8A8:
+            case EPixelFormat::R16G16B16A16_FLOAT:
+            {
+                return 4;
+            }
+        }
+
+        XAR_THROW(
+            error::XarException,
+            "EPixelFormat value {} is not supported",
+            static_cast<std::uint32_t>(pixel_format));
+    }
+
+    std::uint32_t get_pixel_byte_size(EPixelFormat pixel_format)
+    {
+        switch (pixel_format)
+        {
+            case EPixelFormat::R8:
+            case EPixelFormat::R8G8:
+            case EPixelFormat::R8G8B8A8:
+            {
+                return get_channel_count(pixel_format);
+            }
+            case EPixelFormat::R16_FLOAT:
+            case EPixelFormat::R16G16B16A16_FLOAT:
+            {
+                return get_channel_count(pixel_format) * 2;
+            }
+        }
+
+        XAR_THROW(
+            error::XarException,
+            "EPixelFormat value {} is not supported",
+            static_cast<std::uint32_t>(pixel_format));
+    }
+
     std::uint32_t get_byte_size(const Image& image)
     {
-        return image.pixel_width * image.pixel_height * image.channel_count;
+        return image.pixel_width * image.pixel_height * get_pixel_byte_size(image.pixel_format);
+    }
+
+    std::uint32_t get_mip_level_count(
+        std::uint32_t pixel_width,
+        std::uint32_t pixel_height)
+    {
+        return std::bit_width(
+            std::max(
+                std::max(
+                    pixel_width,
+                    pixel_height),
+                std::uint32_t{1}));
+    }
+
+    EPixelFormat get_four_channel_pixel_format(EPixelFormat pixel_format)
+    {
+        switch (pixel_format)
+        {
+            case EPixelFormat::R8:
+            case EPixelFormat::R8G8:
+            case EPixelFormat::R8G8B8A8:
+            {
+                return EPixelFormat::R8G8B8A8;
+            }
+            case EPixelFormat::R16_FLOAT:
+            case EPixelFormat::R16G16B16A16_FLOAT:
+            {
+                return EPixelFormat::R16G16B16A16_FLOAT;
+            }
+        }
+
+        XAR_THROW(
+            error::XarException,
+            "EPixelFormat value {} is not supported",
+            static_cast<std::uint32_t>(pixel_format));
     }
-}
\ No newline at end of file
+
+    void expand_to_four_channels(
+        EPixelFormat pixel_format,
+        std::span<const std::uint8_t> source_bytes,
+        std::span<std::uint8_t> target_bytes)
+    {
+        const auto target_pixel_format = get_four_channel_pixel_format(pixel_format);
+        const auto source_pixel_byte_size = get_pixel_byte_size(pixel_format);
+        const auto target_pixel_byte_size = get_pixel_byte_size(target_pixel_format);
+        const auto pixel_count = source_bytes.size() / source_pixel_byte_size;
+        XAR_THROW_IF(
+            target_bytes.size() < pixel_count * target_pixel_byte_size,
+            error::XarException,
+            "Expanding {} pixels needs {} bytes but only {} are available",
+            pixel_count,
+            pixel_count * target_pixel_byte_size,
+            target_bytes.size());
+
+        if (pixel_format == target_pixel_format)
+        {
+            std::memcpy(
+                target_bytes.data(),
+                source_bytes.data(),
+                pixel_count * source_pixel_byte_size);
+            return;
+        }
+
+        const auto channel_count = get_channel_count(pixel_format);
+        const auto channel_byte_size = source_pixel_byte_size / channel_count;
+        // 0x3c00 is 1.0 as an IEEE 754 half float.
+        const auto opaque_alpha = channel_byte_size == 1
+                                  ? std::array<std::uint8_t, 2>{255, 0}
+                                  : std::bit_cast<std::array<std::uint8_t, 2>>(std::uint16_t{0x3c00});
+
+        for (auto pixel_index = std::size_t{0}; pixel_index < pixel_count; ++pixel_index)
+        {
+            const auto* const source_pixel = source_bytes.data() + pixel_index * source_pixel_byte_size;
+            auto* const target_pixel = target_bytes.data() + pixel_index * target_pixel_byte_size;
+
+            for (auto channel_index = 0u; channel_index < 3u; ++channel_index)
+            {
+                std::memcpy(
+                    target_pixel + channel_index * channel_byte_size,
+                    source_pixel,
+                    channel_byte_size);
+            }
+
+            std::memcpy(
+                target_pixel + 3 * channel_byte_size,
+                channel_count == 2 ? source_pixel + channel_byte_size : opaque_alpha.data(),
+                channel_byte_size);
+        }
+    }
+
+    void copy_with_edge_border(
+        EPixelFormat pixel_format,
+        std::uint32_t source_width,
+        std::uint32_t source_height,
+        std::span<const std::uint8_t> source_bytes,
+        std::uint32_t target_width,
+        std::uint32_t target_height,
+        std::uint32_t target_offset_x,
+        std::uint32_t target_offset_y,
+        std::span<std::uint8_t> target_bytes)
+    {
+        const auto pixel_byte_size = get_pixel_byte_size(pixel_format);
+        XAR_THROW_IF(
+            source_width == 0 || source_height == 0 ||
+            target_offset_x + source_width > target_width || target_offset_y + source_height > target_height,
+            error::XarException,
+            "Source image {}x{} at {}x{} does not fit into target image {}x{}",
+            source_width,
+            source_height,
+            target_offset_x,
+            target_offset_y,
+            target_width,
+            target_height);
+        XAR_THROW_IF(
+            source_bytes.size() < std::size_t{source_width} * source_height * pixel_byte_size ||
+            target_bytes.size() < std::size_t{target_width} * target_height * pixel_byte_size,
+            error::XarException,
+            "Image bytes are smaller than the image dimensions");
+
+        const auto source_row_byte_size = std::size_t{source_width} * pixel_byte_size;
+        const auto target_row_byte_size = std::size_t{target_width} * pixel_byte_size;
+        const auto right_border_x = target_offset_x + source_width;
+
+        for (auto target_y = std::uint32_t{0}; target_y < target_height; ++target_y)
+        {
+            const auto source_y = std::clamp(
+                static_cast<std::int64_t>(target_y) - target_offset_y,
+                std::int64_t{0},
+                static_cast<std::int64_t>(source_height) - 1);
+            const auto* const source_row = source_bytes.data() + source_y * source_row_byte_size;
+            auto* const target_row = target_bytes.data() + target_y * target_row_byte_size;
+
+            for (auto target_x = std::uint32_t{0}; target_x < target_offset_x; ++target_x)
+            {
+                std::memcpy(
+                    target_row + target_x * pixel_byte_size,
+                    source_row,
+                    pixel_byte_size);
+            }
+
+            std::memcpy(
+                target_row + target_offset_x * pixel_byte_size,
+                source_row,
+                source_row_byte_size);
+
+            for (auto target_x = right_border_x; target_x < target_width; ++target_x)
+            {
+                std::memcpy(
+                    target_row + target_x * pixel_byte_size,
+                    source_row + source_row_byte_size - pixel_byte_size,
+                    pixel_byte_size);
+            }
+        }
+    }
+}
+
+ENUM_TO_STRING_IMPL(xar_engine::asset::EPixelFormat,
+                    xar_engine::asset::EPixelFormat::R8,
+                    xar_engine::asset::EPixelFormat::R8G8,
+                    xar_engine::asset::EPixelFormat::R8G8B8A8,
+                    xar_engine::asset::EPixelFormat::R16_FLOAT,
+                    xar_engine::asset::EPixelFormat::R16G16B16A16_FLOAT);
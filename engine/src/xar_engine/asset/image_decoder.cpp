@@ -0,0 +1,66 @@
+#include <xar_engine/asset/image_decoder.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <xar_engine/meta/enum_impl.hpp>
+
+
+namespace xar_engine::asset
+{
+    IImageDecoder::~IImageDecoder() = default;
+}
+
+namespace xar_engine::asset::image
+{
+    namespace
+    {
+        template <std::size_t size>
+        bool starts_with(
+            std::span<const std::uint8_t> file_bytes,
+            const std::array<std::uint8_t, size>& signature)
+        {
+            return
+                file_bytes.size() >= signature.size() &&
+                std::equal(
+                    signature.begin(),
+                    signature.end(),
+                    file_bytes.begin());
+        }
+
+        constexpr auto PNG_SIGNATURE = std::array<std::uint8_t, 8>{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        constexpr auto JPEG_SIGNATURE = std::array<std::uint8_t, 3>{0xFF, 0xD8, 0xFF};
+        constexpr auto HDR_RADIANCE_SIGNATURE = std::array<std::uint8_t, 10>{'#', '?', 'R', 'A', 'D', 'I', 'A', 'N', 'C', 'E'};
+        constexpr auto HDR_RGBE_SIGNATURE = std::array<std::uint8_t, 6>{'#', '?', 'R', 'G', 'B', 'E'};
+        constexpr auto XTEX_SIGNATURE = std::array<std::uint8_t, 4>{'X', 'T', 'E', 'X'};
+    }
+
+    EImageFileType detect_file_type(std::span<const std::uint8_t> file_bytes)
+    {
+        if (starts_with(file_bytes, PNG_SIGNATURE))
+        {
+            return EImageFileType::PNG;
+        }
+        if (starts_with(file_bytes, JPEG_SIGNATURE))
+        {
+            return EImageFileType::JPEG;
+        }
+        if (starts_with(file_bytes, HDR_RADIANCE_SIGNATURE) || starts_with(file_bytes, HDR_RGBE_SIGNATURE))
+        {
+            return EImageFileType::HDR;
+        }
+        if (starts_with(file_bytes, XTEX_SIGNATURE))
+        {
+            return EImageFileType::XTEX;
+        }
+
+        return EImageFileType::UNKNOWN;
+    }
+}
+
+ENUM_TO_STRING_IMPL(xar_engine::asset::EImageFileType,
+                    xar_engine::asset::EImageFileType::UNKNOWN,
+                    xar_engine::asset::EImageFileType::PNG,
+                    xar_engine::asset::EImageFileType::JPEG,
+                    xar_engine::asset::EImageFileType::HDR,
+                    xar_engine::asset::EImageFileType::XTEX);
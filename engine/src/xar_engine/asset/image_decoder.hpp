@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include <xar_engine/asset/image.hpp>
+
+#include <xar_engine/meta/enum.hpp>
+
+
+namespace xar_engine::asset
+{
+    enum class EImageFileType
+    {
+        UNKNOWN,
+        PNG,
+        JPEG,
+        HDR,
+        XTEX,
+    };
+
+    class IImageDecoder
+    {
+    public:
+        virtual ~IImageDecoder();
+
+        [[nodiscard]]
+        virtual Image decode_image(std::span<const std::uint8_t> file_bytes) const = 0;
+    };
+}
+
+namespace xar_engine::asset::image
+{
+    EImageFileType detect_file_type(std::span<const std::uint8_t> file_bytes);
+}
+
+ENUM_TO_STRING(xar_engine::asset::EImageFileType);
@@ -0,0 +1,83 @@
+#include <xar_engine/asset/image_decoder_registry.hpp>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+
+namespace xar_engine::asset
+{
+    ImageDecoderRegistry::ImageDecoderRegistry(std::unique_ptr<IImageDecoder> fallback_image_decoder)
+        : _fallback_image_decoder(std::move(fallback_image_decoder))
+        , _image_decoder_map()
+    {
+        XAR_THROW_IF(
+            _fallback_image_decoder == nullptr,
+            error::XarException,
+            "Fallback image decoder is required");
+    }
+
+    void ImageDecoderRegistry::add_image_decoder(
+        EImageFileType image_file_type,
+        std::unique_ptr<IImageDecoder> image_decoder)
+    {
+        XAR_THROW_IF(
+            image_decoder == nullptr,
+            error::XarException,
+            "Image decoder for {} is null",
+            meta::enum_to_string(image_file_type));
+
+        _image_decoder_map.insert_or_assign(
+            image_file_type,
+            std::move(image_decoder));
+    }
+
+    const IImageDecoder& ImageDecoderRegistry::get_image_decoder(EImageFileType image_file_type) const
+    {
+        const auto image_decoder_iter = _image_decoder_map.find(image_file_type);
+        if (image_decoder_iter != _image_decoder_map.end())
+        {
+            return *image_decoder_iter->second;
+        }
+
+        return *_fallback_image_decoder;
+    }
+
+    const IImageDecoder& ImageDecoderRegistry::get_image_decoder(std::span<const std::uint8_t> file_bytes) const
+    {
+        return get_image_decoder(image::detect_file_type(file_bytes));
+    }
+
+
+    RegistryImageLoader::RegistryImageLoader(
+        std::shared_ptr<const ImageDecoderRegistry> image_decoder_registry,
+        std::shared_ptr<file::IFileReader> file_reader)
+        : _image_decoder_registry(std::move(image_decoder_registry))
+        , _file_reader(std::move(file_reader))
+    {
+        XAR_THROW_IF(
+            _file_reader == nullptr,
+            error::XarException,
+            "File reader is required");
+    }
+
+    Image RegistryImageLoader::load_image_from_file(const std::filesystem::path& path) const
+    {
+        return std::move(load_image_list_from_file({path})[0]);
+    }
+
+    std::vector<Image> RegistryImageLoader::load_image_list_from_file(const std::vector<std::filesystem::path>& path_list) const
+    {
+        const auto file_bytes_list = file::read_whole_file_list(
+            *_file_reader,
+            path_list);
+
+        auto image_list = std::vector<Image>{};
+        image_list.reserve(file_bytes_list.size());
+        for (const auto& file_bytes: file_bytes_list)
+        {
+            image_list.push_back(_image_decoder_registry->get_image_decoder(file_bytes).decode_image(file_bytes));
+        }
+
+        return image_list;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <xar_engine/asset/image_decoder.hpp>
+#include <xar_engine/asset/image_loader.hpp>
+
+#include <xar_engine/file/file_reader.hpp>
+
+
+namespace xar_engine::asset
+{
+    class ImageDecoderRegistry
+    {
+    public:
+        explicit ImageDecoderRegistry(std::unique_ptr<IImageDecoder> fallback_image_decoder);
+
+
+        void add_image_decoder(
+            EImageFileType image_file_type,
+            std::unique_ptr<IImageDecoder> image_decoder);
+
+
+        [[nodiscard]]
+        const IImageDecoder& get_image_decoder(EImageFileType image_file_type) const;
+
+        [[nodiscard]]
+        const IImageDecoder& get_image_decoder(std::span<const std::uint8_t> file_bytes) const;
+
+    private:
+        std::unique_ptr<IImageDecoder> _fallback_image_decoder;
+        std::unordered_map<EImageFileType, std::unique_ptr<IImageDecoder>> _image_decoder_map;
+    };
+
+
+    class RegistryImageLoader
+        : public IImageLoader
+    {
+    public:
+        RegistryImageLoader(
+            std::shared_ptr<const ImageDecoderRegistry> image_decoder_registry,
+            std::shared_ptr<file::IFileReader> file_reader);
+
+
+        [[nodiscard]]
+        Image load_image_from_file(const std::filesystem::path& path) const override;
+
+        [[nodiscard]]
+        std::vector<Image> load_image_list_from_file(const std::vector<std::filesystem::path>& path_list) const override;
+
+    private:
+        std::shared_ptr<const ImageDecoderRegistry> _image_decoder_registry;
+        std::shared_ptr<file::IFileReader> _file_reader;
+    };
+}
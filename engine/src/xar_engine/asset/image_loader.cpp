@@ -1,18 +1,104 @@
 #include <xar_engine/asset/image_loader.hpp>
 
-#include <xar_engine/asset/stb_image_loader.hpp>
+#include <exception>
+#include <optional>
+
+#include <xar_engine/asset/image_decoder_registry.hpp>
+#include <xar_engine/asset/stb_image_decoder.hpp>
+#include <xar_engine/asset/xtex_image_file.hpp>
+
+#include <xar_engine/file/file_reader.hpp>
+
+#ifdef XAR_ENGINE_WITH_SPNG
+#include <xar_engine/asset/spng_image_decoder.hpp>
+#endif
+
+#ifdef XAR_ENGINE_WITH_TURBOJPEG
+#include <xar_engine/asset/turbojpeg_image_decoder.hpp>
+#endif
 
 
 namespace xar_engine::asset
 {
+    namespace
+    {
+        std::shared_ptr<const ImageDecoderRegistry> make_default_image_decoder_registry()
+        {
+            auto image_decoder_registry = std::make_shared<ImageDecoderRegistry>(std::make_unique<StbImageDecoder>());
+            image_decoder_registry->add_image_decoder(
+                EImageFileType::XTEX,
+                std::make_unique<XtexImageDecoder>());
+
+#ifdef XAR_ENGINE_WITH_SPNG
+            image_decoder_registry->add_image_decoder(
+                EImageFileType::PNG,
+                std::make_unique<SpngImageDecoder>());
+#endif
+
+#ifdef XAR_ENGINE_WITH_TURBOJPEG
+            image_decoder_registry->add_image_decoder(
+                EImageFileType::JPEG,
+                std::make_unique<TurboJpegImageDecoder>());
+#endif
+
+            return image_decoder_registry;
+        }
+    }
+
+
     IImageLoader::~IImageLoader() = default;
 
+    std::vector<Image> IImageLoader::load_image_list_from_file(const std::vector<std::filesystem::path>& path_list) const
+    {
+        auto image_list = std::vector<Image>{};
+        image_list.reserve(path_list.size());
+        for (const auto& path: path_list)
+        {
+            image_list.push_back(load_image_from_file(path));
+        }
+
+        return image_list;
+    }
+
+    thread::TTask<Image> IImageLoader::load_image_async(
+        std::filesystem::path path,
+        thread::IExecutor& worker_executor,
+        thread::IExecutor& resume_executor) const
+    {
+        co_await thread::resume_on(worker_executor);
+
+        // A failed load still resumes on resume_executor, a co_await is not allowed inside the handler.
+        auto image = std::optional<Image>{};
+        auto exception = std::exception_ptr{};
+        try
+        {
+            image = load_image_from_file(path);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        co_await thread::resume_on(resume_executor);
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        co_return std::move(*image);
+    }
+
 
     IImageLoaderFactory::~IImageLoaderFactory() = default;
 
 
     std::unique_ptr<IImageLoader> ImageLoaderFactory::make() const
     {
-        return std::make_unique<StbImageLoader>();
+        static const auto image_decoder_registry = make_default_image_decoder_registry();
+
+        return std::make_unique<RegistryImageLoader>(
+            image_decoder_registry,
+            file::FileReaderFactory().make());
     }
-}
\ No newline at end of file
+}
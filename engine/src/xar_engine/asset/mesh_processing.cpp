@@ -0,0 +1,569 @@
+#include <xar_engine/asset/mesh_processing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/math/batch.hpp>
+
+
+namespace xar_engine::asset::mesh
+{
+    namespace
+    {
+        constexpr auto MIN_LENGTH_SQUARED = 1e-20f;
+        constexpr auto MIN_TEXTURE_COORD_AREA = 1e-12f;
+
+        // Attributes are processed as separate x, y and z arrays, so the per-vertex passes are plain loops
+        // over contiguous floats that the compiler can vectorize.
+        struct Vector3List
+        {
+            explicit Vector3List(std::size_t count)
+                : x(count)
+                , y(count)
+                , z(count)
+            {
+            }
+
+            explicit Vector3List(std::span<const math::Vector3f> vector_list)
+                : Vector3List(vector_list.size())
+            {
+                for (auto index = std::size_t{0}; index < vector_list.size(); ++index)
+                {
+                    x[index] = vector_list[index].x;
+                    y[index] = vector_list[index].y;
+                    z[index] = vector_list[index].z;
+                }
+            }
+
+            [[nodiscard]]
+            math::Vector3f get(std::size_t index) const
+            {
+                return {
+                    x[index],
+                    y[index],
+                    z[index]
+                };
+            }
+
+            void add(
+                std::size_t index,
+                const math::Vector3f& vector,
+                float weight)
+            {
+                x[index] += vector.x * weight;
+                y[index] += vector.y * weight;
+                z[index] += vector.z * weight;
+            }
+
+            [[nodiscard]]
+            std::vector<math::Vector3f> to_vector_list() const
+            {
+                auto vector_list = std::vector<math::Vector3f>(x.size());
+                for (auto index = std::size_t{0}; index < vector_list.size(); ++index)
+                {
+                    vector_list[index] = get(index);
+                }
+
+                return vector_list;
+            }
+
+            std::vector<float> x;
+            std::vector<float> y;
+            std::vector<float> z;
+        };
+
+        math::Vector3f subtract(
+            const math::Vector3f& left,
+            const math::Vector3f& right)
+        {
+            return {
+                left.x - right.x,
+                left.y - right.y,
+                left.z - right.z
+            };
+        }
+
+        math::Vector3f scale(
+            const math::Vector3f& vector,
+            float factor)
+        {
+            return {
+                vector.x * factor,
+                vector.y * factor,
+                vector.z * factor
+            };
+        }
+
+        float dot(
+            const math::Vector3f& left,
+            const math::Vector3f& right)
+        {
+            return left.x * right.x + left.y * right.y + left.z * right.z;
+        }
+
+        math::Vector3f cross(
+            const math::Vector3f& left,
+            const math::Vector3f& right)
+        {
+            return {
+                left.y * right.z - left.z * right.y,
+                left.z * right.x - left.x * right.z,
+                left.x * right.y - left.y * right.x
+            };
+        }
+
+        // Removes the component along the unit normal and normalizes, returns false for degenerate results.
+        bool project_to_plane(
+            const math::Vector3f& unit_normal,
+            math::Vector3f& vector)
+        {
+            vector = subtract(
+                vector,
+                scale(
+                    unit_normal,
+                    dot(
+                        unit_normal,
+                        vector)));
+
+            const auto length_squared = dot(
+                vector,
+                vector);
+            if (length_squared <= MIN_LENGTH_SQUARED)
+            {
+                return false;
+            }
+
+            vector = scale(
+                vector,
+                1.0f / std::sqrt(length_squared));
+            return true;
+        }
+
+        float get_corner_angle(
+            const math::Vector3f& edge_0,
+            const math::Vector3f& edge_1)
+        {
+            const auto length_product_squared = dot(edge_0, edge_0) * dot(edge_1, edge_1);
+            if (length_product_squared <= MIN_LENGTH_SQUARED)
+            {
+                return 0.0f;
+            }
+
+            return std::acos(
+                std::clamp(
+                    dot(edge_0, edge_1) / std::sqrt(length_product_squared),
+                    -1.0f,
+                    1.0f));
+        }
+
+        void check_index_list(
+            std::span<const std::uint32_t> index_list,
+            std::size_t vertex_count)
+        {
+            XAR_THROW_IF(
+                index_list.size() % 3 != 0,
+                error::XarException,
+                "Mesh index count {} is not a multiple of 3",
+                index_list.size());
+
+            const auto max_index_iter = std::ranges::max_element(index_list);
+            XAR_THROW_IF(
+                max_index_iter != index_list.end() && *max_index_iter >= vertex_count,
+                error::XarException,
+                "Mesh index {} is out of range for {} vertices",
+                *max_index_iter,
+                vertex_count);
+        }
+
+        BoundingVolume merge_mesh_bounding_volumes(const std::vector<Mesh>& mesh_list)
+        {
+            auto bounding_volume_list = std::vector<BoundingVolume>{};
+            bounding_volume_list.reserve(mesh_list.size());
+            for (const auto& mesh: mesh_list)
+            {
+                if (!mesh.position_list.empty())
+                {
+                    bounding_volume_list.push_back(mesh.bounding_volume);
+                }
+            }
+
+            return merge_bounding_volumes(bounding_volume_list);
+        }
+    }
+
+    BoundingVolume compute_bounding_volume(std::span<const math::Vector3f> position_list)
+    {
+        if (position_list.empty())
+        {
+            return {};
+        }
+
+        const auto box = math::compute_aabb(position_list);
+
+        // Box centered sphere, slightly looser than a minimal sphere but cheap and deterministic.
+        const auto sphere_center = math::Vector3f{
+            (box.min.x + box.max.x) * 0.5f,
+            (box.min.y + box.max.y) * 0.5f,
+            (box.min.z + box.max.z) * 0.5f,
+        };
+        const auto max_distance_squared = math::compute_max_distance_squared(
+            position_list,
+            sphere_center);
+
+        return {
+            box.min,
+            box.max,
+            sphere_center,
+            std::sqrt(max_distance_squared)
+        };
+    }
+
+    BoundingVolume merge_bounding_volumes(std::span<const BoundingVolume> bounding_volume_list)
+    {
+        if (bounding_volume_list.empty())
+        {
+            return {};
+        }
+
+        auto box_min = bounding_volume_list[0].box_min;
+        auto box_max = bounding_volume_list[0].box_max;
+        for (const auto& bounding_volume: bounding_volume_list)
+        {
+            box_min.x = std::min(box_min.x, bounding_volume.box_min.x);
+            box_min.y = std::min(box_min.y, bounding_volume.box_min.y);
+            box_min.z = std::min(box_min.z, bounding_volume.box_min.z);
+            box_max.x = std::max(box_max.x, bounding_volume.box_max.x);
+            box_max.y = std::max(box_max.y, bounding_volume.box_max.y);
+            box_max.z = std::max(box_max.z, bounding_volume.box_max.z);
+        }
+
+        const auto sphere_center = math::Vector3f{
+            (box_min.x + box_max.x) * 0.5f,
+            (box_min.y + box_max.y) * 0.5f,
+            (box_min.z + box_max.z) * 0.5f,
+        };
+        auto sphere_radius = 0.0f;
+        for (const auto& bounding_volume: bounding_volume_list)
+        {
+            const auto offset = subtract(
+                bounding_volume.sphere_center,
+                sphere_center);
+            sphere_radius = std::max(
+                sphere_radius,
+                std::sqrt(
+                    dot(
+                        offset,
+                        offset)) + bounding_volume.sphere_radius);
+        }
+
+        return {
+            box_min,
+            box_max,
+            sphere_center,
+            sphere_radius
+        };
+    }
+
+    std::vector<math::Vector3f> compute_smooth_normals(
+        std::span<const math::Vector3f> position_list,
+        std::span<const std::uint32_t> index_list)
+    {
+        check_index_list(
+            index_list,
+            position_list.size());
+
+        auto normal_list = Vector3List{position_list.size()};
+        for (auto corner = std::size_t{0}; corner < index_list.size(); corner += 3)
+        {
+            const auto index_0 = index_list[corner];
+            const auto index_1 = index_list[corner + 1];
+            const auto index_2 = index_list[corner + 2];
+
+            // The cross product length is twice the triangle area, which gives the area weighting.
+            const auto face_normal = cross(
+                subtract(
+                    position_list[index_1],
+                    position_list[index_0]),
+                subtract(
+                    position_list[index_2],
+                    position_list[index_0]));
+
+            normal_list.add(index_0, face_normal, 1.0f);
+            normal_list.add(index_1, face_normal, 1.0f);
+            normal_list.add(index_2, face_normal, 1.0f);
+        }
+
+        auto* const x = normal_list.x.data();
+        auto* const y = normal_list.y.data();
+        auto* const z = normal_list.z.data();
+        for (auto index = std::size_t{0}; index < position_list.size(); ++index)
+        {
+            const auto length_squared = x[index] * x[index] + y[index] * y[index] + z[index] * z[index];
+            const auto is_degenerate = length_squared <= MIN_LENGTH_SQUARED;
+            const auto inverse_length = is_degenerate ? 0.0f : 1.0f / std::sqrt(length_squared);
+
+            // Unreferenced or degenerate vertices point up instead of carrying a zero normal.
+            x[index] = x[index] * inverse_length;
+            y[index] = is_degenerate ? 1.0f : y[index] * inverse_length;
+            z[index] = z[index] * inverse_length;
+        }
+
+        return normal_list.to_vector_list();
+    }
+
+    std::vector<math::Vector4f> compute_tangents(
+        std::span<const math::Vector3f> position_list,
+        std::span<const math::Vector3f> normal_list,
+        std::span<const math::Vector2f> texture_coord_list,
+        std::span<const std::uint32_t> index_list)
+    {
+        XAR_THROW_IF(
+            normal_list.size() != position_list.size() || texture_coord_list.size() != position_list.size(),
+            error::XarException,
+            "Tangents need one normal and texture coordinate per position");
+        check_index_list(
+            index_list,
+            position_list.size());
+
+        auto tangent_list = Vector3List{position_list.size()};
+        auto bitangent_list = Vector3List{position_list.size()};
+        for (auto corner = std::size_t{0}; corner < index_list.size(); corner += 3)
+        {
+            const auto index_list_of_face = std::array<std::uint32_t, 3>{
+                index_list[corner],
+                index_list[corner + 1],
+                index_list[corner + 2]
+            };
+
+            const auto edge_1 = subtract(
+                position_list[index_list_of_face[1]],
+                position_list[index_list_of_face[0]]);
+            const auto edge_2 = subtract(
+                position_list[index_list_of_face[2]],
+                position_list[index_list_of_face[0]]);
+
+            const auto& texture_coord_0 = texture_coord_list[index_list_of_face[0]];
+            const auto delta_u_1 = texture_coord_list[index_list_of_face[1]].x - texture_coord_0.x;
+            const auto delta_v_1 = texture_coord_list[index_list_of_face[1]].y - texture_coord_0.y;
+            const auto delta_u_2 = texture_coord_list[index_list_of_face[2]].x - texture_coord_0.x;
+            const auto delta_v_2 = texture_coord_list[index_list_of_face[2]].y - texture_coord_0.y;
+
+            const auto texture_coord_area = delta_u_1 * delta_v_2 - delta_u_2 * delta_v_1;
+            if (std::abs(texture_coord_area) <= MIN_TEXTURE_COORD_AREA)
+            {
+                continue;
+            }
+
+            const auto inverse_area = 1.0f / texture_coord_area;
+            const auto face_tangent = scale(
+                subtract(
+                    scale(edge_1, delta_v_2),
+                    scale(edge_2, delta_v_1)),
+                inverse_area);
+            const auto face_bitangent = scale(
+                subtract(
+                    scale(edge_2, delta_u_1),
+                    scale(edge_1, delta_u_2)),
+                inverse_area);
+
+            for (auto face_corner = std::size_t{0}; face_corner < 3; ++face_corner)
+            {
+                const auto vertex = index_list_of_face[face_corner];
+                const auto& position = position_list[vertex];
+
+                const auto corner_angle = get_corner_angle(
+                    subtract(
+                        position_list[index_list_of_face[(face_corner + 1) % 3]],
+                        position),
+                    subtract(
+                        position_list[index_list_of_face[(face_corner + 2) % 3]],
+                        position));
+
+                auto corner_tangent = face_tangent;
+                auto corner_bitangent = face_bitangent;
+                if (project_to_plane(normal_list[vertex], corner_tangent))
+                {
+                    tangent_list.add(vertex, corner_tangent, corner_angle);
+                }
+                if (project_to_plane(normal_list[vertex], corner_bitangent))
+                {
+                    bitangent_list.add(vertex, corner_bitangent, corner_angle);
+                }
+            }
+        }
+
+        const auto normal_soa_list = Vector3List{normal_list};
+        const auto* const normal_x = normal_soa_list.x.data();
+        const auto* const normal_y = normal_soa_list.y.data();
+        const auto* const normal_z = normal_soa_list.z.data();
+        auto* const tangent_x = tangent_list.x.data();
+        auto* const tangent_y = tangent_list.y.data();
+        auto* const tangent_z = tangent_list.z.data();
+        const auto* const bitangent_x = bitangent_list.x.data();
+        const auto* const bitangent_y = bitangent_list.y.data();
+        const auto* const bitangent_z = bitangent_list.z.data();
+
+        auto result_list = std::vector<math::Vector4f>(position_list.size());
+        for (auto index = std::size_t{0}; index < position_list.size(); ++index)
+        {
+            // Gram-Schmidt against the normal. Vertices without a usable tangent get an arbitrary
+            // perpendicular built from the axis least aligned with the normal.
+            const auto tangent_dot_normal =
+                tangent_x[index] * normal_x[index] + tangent_y[index] * normal_y[index] + tangent_z[index] * normal_z[index];
+            auto x = tangent_x[index] - normal_x[index] * tangent_dot_normal;
+            auto y = tangent_y[index] - normal_y[index] * tangent_dot_normal;
+            auto z = tangent_z[index] - normal_z[index] * tangent_dot_normal;
+
+            auto length_squared = x * x + y * y + z * z;
+            if (length_squared <= MIN_LENGTH_SQUARED)
+            {
+                const auto use_x_axis = std::abs(normal_x[index]) < 0.9f;
+                x = use_x_axis ? 0.0f : normal_z[index];
+                y = use_x_axis ? normal_z[index] : 0.0f;
+                z = use_x_axis ? -normal_y[index] : -normal_x[index];
+                length_squared = x * x + y * y + z * z;
+            }
+
+            const auto inverse_length = 1.0f / std::sqrt(std::max(length_squared, MIN_LENGTH_SQUARED));
+            x *= inverse_length;
+            y *= inverse_length;
+            z *= inverse_length;
+
+            const auto handedness =
+                (normal_y[index] * z - normal_z[index] * y) * bitangent_x[index] +
+                (normal_z[index] * x - normal_x[index] * z) * bitangent_y[index] +
+                (normal_x[index] * y - normal_y[index] * x) * bitangent_z[index];
+
+            result_list[index] = {
+                x,
+                y,
+                z,
+                handedness < 0.0f ? -1.0f : 1.0f
+            };
+        }
+
+        return result_list;
+    }
+
+    void process_mesh(Mesh& mesh)
+    {
+        if (mesh.normal_list.size() != mesh.position_list.size())
+        {
+            mesh.normal_list = compute_smooth_normals(
+                mesh.position_list,
+                mesh.index_list);
+        }
+
+        if (!mesh.position_list.empty() && mesh.texture_coord_list.size() == mesh.position_list.size())
+        {
+            mesh.tangent_list = compute_tangents(
+                mesh.position_list,
+                mesh.normal_list,
+                mesh.texture_coord_list,
+                mesh.index_list);
+        }
+        else
+        {
+            mesh.tangent_list.clear();
+        }
+
+        mesh.bounding_volume = compute_bounding_volume(mesh.position_list);
+    }
+
+    void process_node_list(Model& model)
+    {
+        auto& node_list = model.node_list;
+        const auto mesh_count = static_cast<std::uint32_t>(model.mesh_list.size());
+
+        if (node_list.parent_index_list.empty())
+        {
+            node_list.parent_index_list = {NO_PARENT_NODE_INDEX};
+            node_list.translation_list = {{0.0f, 0.0f, 0.0f}};
+            node_list.rotation_list = {{0.0f, 0.0f, 0.0f, 1.0f}};
+            node_list.scale_list = {{1.0f, 1.0f, 1.0f}};
+            node_list.mesh_index_offset_list = {0};
+            node_list.mesh_index_count_list = {mesh_count};
+            node_list.mesh_index_list.resize(mesh_count);
+            std::iota(
+                node_list.mesh_index_list.begin(),
+                node_list.mesh_index_list.end(),
+                std::uint32_t{0});
+            return;
+        }
+
+        const auto node_count = node_list.parent_index_list.size();
+        XAR_THROW_IF(
+            node_list.translation_list.size() != node_count ||
+            node_list.rotation_list.size() != node_count ||
+            node_list.scale_list.size() != node_count ||
+            node_list.mesh_index_offset_list.size() != node_count ||
+            node_list.mesh_index_count_list.size() != node_count,
+            error::XarException,
+            "Node lists of model '{}' have different sizes",
+            model.metadata.name);
+
+        for (auto node_index = std::size_t{0}; node_index < node_count; ++node_index)
+        {
+            const auto parent_index = node_list.parent_index_list[node_index];
+            XAR_THROW_IF(
+                parent_index != NO_PARENT_NODE_INDEX && (parent_index < 0 || static_cast<std::size_t>(parent_index) >= node_index),
+                error::XarException,
+                "Node {} of model '{}' does not follow its parent {}",
+                node_index,
+                model.metadata.name,
+                parent_index);
+
+            const auto mesh_index_offset = std::uint64_t{node_list.mesh_index_offset_list[node_index]};
+            const auto mesh_index_count = std::uint64_t{node_list.mesh_index_count_list[node_index]};
+            XAR_THROW_IF(
+                mesh_index_offset + mesh_index_count > node_list.mesh_index_list.size(),
+                error::XarException,
+                "Mesh references of node {} of model '{}' are out of range",
+                node_index,
+                model.metadata.name);
+        }
+
+        for (const auto mesh_index: node_list.mesh_index_list)
+        {
+            XAR_THROW_IF(
+                mesh_index >= mesh_count,
+                error::XarException,
+                "Model '{}' references mesh {} but has {} meshes",
+                model.metadata.name,
+                mesh_index,
+                mesh_count);
+        }
+    }
+
+    void process_model(Model& model)
+    {
+        process_node_list(model);
+
+        for (auto& mesh: model.mesh_list)
+        {
+            process_mesh(mesh);
+        }
+
+        model.bounding_volume = merge_mesh_bounding_volumes(model.mesh_list);
+    }
+
+    void process_model(
+        Model& model,
+        thread::ThreadPool& thread_pool)
+    {
+        process_node_list(model);
+
+        thread_pool.parallel_for(
+            model.mesh_list.size(),
+            [&model](std::size_t mesh_index)
+            {
+                process_mesh(model.mesh_list[mesh_index]);
+            });
+
+        model.bounding_volume = merge_mesh_bounding_volumes(model.mesh_list);
+    }
+}
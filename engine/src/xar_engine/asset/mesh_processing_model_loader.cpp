@@ -0,0 +1,25 @@
+#include <xar_engine/asset/mesh_processing_model_loader.hpp>
+
+#include <xar_engine/asset/mesh_processing.hpp>
+
+
+namespace xar_engine::asset
+{
+    MeshProcessingModelLoader::MeshProcessingModelLoader(
+        std::unique_ptr<IModelLoader> model_loader,
+        std::shared_ptr<thread::ThreadPool> thread_pool)
+        : _model_loader(std::move(model_loader))
+        , _thread_pool(std::move(thread_pool))
+    {
+    }
+
+    Model MeshProcessingModelLoader::load_model_from_file(const std::filesystem::path& path) const
+    {
+        auto model = _model_loader->load_model_from_file(path);
+        mesh::process_model(
+            model,
+            *_thread_pool);
+
+        return model;
+    }
+}
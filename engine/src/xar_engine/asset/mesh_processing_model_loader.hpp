@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+
+#include <xar_engine/asset/model_loader.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_engine::asset
+{
+    // Runs the mesh import stage (normals, tangents, bounds) on everything the wrapped loader returns.
+    class MeshProcessingModelLoader
+        : public IModelLoader
+    {
+    public:
+        MeshProcessingModelLoader(
+            std::unique_ptr<IModelLoader> model_loader,
+            std::shared_ptr<thread::ThreadPool> thread_pool);
+
+
+        [[nodiscard]]
+        Model load_model_from_file(const std::filesystem::path& path) const override;
+
+    private:
+        std::unique_ptr<IModelLoader> _model_loader;
+        std::shared_ptr<thread::ThreadPool> _thread_pool;
+    };
+}
@@ -1,18 +1,65 @@
 #include <xar_engine/asset/model_loader.hpp>
 
+#include <exception>
+#include <optional>
+
 #include <xar_engine/asset/assimp_model_loader.hpp>
+#include <xar_engine/asset/cached_model_loader.hpp>
+#include <xar_engine/asset/extension_model_loader.hpp>
+#include <xar_engine/asset/mesh_processing_model_loader.hpp>
+#include <xar_engine/asset/obj_model_loader.hpp>
 
 
 namespace xar_engine::asset
 {
     IModelLoader::~IModelLoader() = default;
 
+    thread::TTask<Model> IModelLoader::load_model_async(
+        std::filesystem::path path,
+        thread::IExecutor& worker_executor,
+        thread::IExecutor& resume_executor) const
+    {
+        co_await thread::resume_on(worker_executor);
+
+        // A failed load still resumes on resume_executor, a co_await is not allowed inside the handler.
+        auto model = std::optional<Model>{};
+        auto exception = std::exception_ptr{};
+        try
+        {
+            model = load_model_from_file(path);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        co_await thread::resume_on(resume_executor);
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        co_return std::move(*model);
+    }
+
 
     IModelLoaderFactory::~IModelLoaderFactory() = default;
 
 
     std::unique_ptr<IModelLoader> ModelLoaderFactory::make() const
     {
-        return std::make_unique<AssimpModelLoader>();
+        auto thread_pool = std::make_shared<thread::ThreadPool>(thread::ThreadPool::get_default_worker_count());
+
+        auto extension_model_loader = std::make_unique<ExtensionModelLoader>(std::make_unique<AssimpModelLoader>(thread_pool));
+        extension_model_loader->add_model_loader(
+            ".obj",
+            std::make_unique<ObjModelLoader>(thread_pool));
+
+        // The cache stores processed models, so cached loads skip the import stage.
+        return std::make_unique<CachedModelLoader>(
+            std::make_unique<MeshProcessingModelLoader>(
+                std::move(extension_model_loader),
+                thread_pool));
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,670 @@
+#include <xar_engine/asset/obj_model_loader.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <numeric>
+#include <string_view>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/file/memory_mapped_file.hpp>
+
+
+namespace xar_engine::asset
+{
+    namespace
+    {
+        constexpr auto MIN_CHUNK_BYTE_SIZE = std::size_t{64 * 1024};
+        constexpr auto CHUNKS_PER_WORKER = std::size_t{4};
+
+        constexpr auto MISSING_INDEX = std::int32_t{-1};
+        constexpr auto RELATIVE_INDEX_BIAS = std::int32_t{1} << 30;
+
+        struct ObjCorner
+        {
+            std::int32_t position_index;
+            std::int32_t texture_coord_index;
+            std::int32_t normal_index;
+
+            bool operator==(const ObjCorner& other) const = default;
+        };
+
+        struct ObjChunk
+        {
+            std::vector<math::Vector3f> position_list;
+            std::vector<math::Vector2f> texture_coord_list;
+            std::vector<math::Vector3f> normal_list;
+
+            // Positive indices are 1-based and absolute as written in the file, zero marks a missing attribute.
+            // Negative (relative) indices are stored as a 0-based index into this chunk's lists minus
+            // RELATIVE_INDEX_BIAS, which may reach into a previous chunk.
+            std::vector<ObjCorner> corner_list;
+            std::vector<std::uint32_t> face_corner_count_list;
+            std::vector<std::size_t> mesh_begin_face_list;
+        };
+
+        struct ObjMeshRange
+        {
+            std::size_t face_begin;
+            std::size_t face_end;
+        };
+
+        class ObjVertexMap
+        {
+        public:
+            explicit ObjVertexMap(std::size_t max_vertex_count)
+                : _slot_list(std::bit_ceil(std::max(max_vertex_count * 2, std::size_t{16})))
+                , _slot_mask(_slot_list.size() - 1)
+            {
+            }
+
+            // Returns the vertex index stored for the corner and whether it was inserted by this call.
+            std::pair<std::uint32_t, bool> emplace(
+                const ObjCorner& corner,
+                std::uint32_t vertex_index)
+            {
+                for (auto slot_index = hash(corner) & _slot_mask;; slot_index = (slot_index + 1) & _slot_mask)
+                {
+                    auto& slot = _slot_list[slot_index];
+                    if (!slot.is_used)
+                    {
+                        slot = {
+                            corner,
+                            vertex_index,
+                            true
+                        };
+                        return {
+                            vertex_index,
+                            true
+                        };
+                    }
+
+                    if (slot.corner == corner)
+                    {
+                        return {
+                            slot.vertex_index,
+                            false
+                        };
+                    }
+                }
+            }
+
+        private:
+            struct Slot
+            {
+                ObjCorner corner;
+                std::uint32_t vertex_index;
+                bool is_used;
+            };
+
+        private:
+            [[nodiscard]]
+            static std::size_t hash(const ObjCorner& corner)
+            {
+                auto hash_value = static_cast<std::uint64_t>(static_cast<std::uint32_t>(corner.position_index));
+                hash_value = hash_value * 0x9E3779B97F4A7C15ull ^ static_cast<std::uint32_t>(corner.texture_coord_index);
+                hash_value = hash_value * 0x9E3779B97F4A7C15ull ^ static_cast<std::uint32_t>(corner.normal_index);
+
+                return static_cast<std::size_t>(hash_value ^ (hash_value >> 29));
+            }
+
+        private:
+            std::vector<Slot> _slot_list;
+            std::size_t _slot_mask;
+        };
+
+        class ObjChunkParser
+        {
+        public:
+            ObjChunkParser(
+                std::string_view text,
+                const std::filesystem::path& path)
+                : _text(text)
+                , _path(path)
+            {
+            }
+
+            [[nodiscard]]
+            ObjChunk parse_chunk()
+            {
+                auto chunk = ObjChunk{};
+
+                while (!_text.empty())
+                {
+                    const auto line_end = _text.find('\n');
+                    auto line = _text.substr(
+                        0,
+                        line_end);
+                    _text.remove_prefix(line_end == std::string_view::npos ? _text.size() : line_end + 1);
+
+                    parse_line(
+                        line,
+                        chunk);
+                }
+
+                return chunk;
+            }
+
+        private:
+            void parse_line(
+                std::string_view line,
+                ObjChunk& chunk) const
+            {
+                skip_whitespace(line);
+                const auto keyword = read_token(line);
+
+                if (keyword == "v")
+                {
+                    auto& position = chunk.position_list.emplace_back();
+                    position.x = read_float(line);
+                    position.y = read_float(line);
+                    position.z = read_float(line);
+                }
+                else if (keyword == "vt")
+                {
+                    auto& texture_coord = chunk.texture_coord_list.emplace_back();
+                    texture_coord.x = read_float(line);
+                    texture_coord.y = 1.0f - read_float(line);
+                }
+                else if (keyword == "vn")
+                {
+                    auto& normal = chunk.normal_list.emplace_back();
+                    normal.x = read_float(line);
+                    normal.y = read_float(line);
+                    normal.z = read_float(line);
+                }
+                else if (keyword == "f")
+                {
+                    parse_face(
+                        line,
+                        chunk);
+                }
+                else if (keyword == "o" || keyword == "g" || keyword == "usemtl")
+                {
+                    const auto face_count = chunk.face_corner_count_list.size();
+                    if (chunk.mesh_begin_face_list.empty() || chunk.mesh_begin_face_list.back() != face_count)
+                    {
+                        chunk.mesh_begin_face_list.push_back(face_count);
+                    }
+                }
+            }
+
+            void parse_face(
+                std::string_view line,
+                ObjChunk& chunk) const
+            {
+                auto corner_count = std::uint32_t{0};
+
+                for (auto token = read_token(line); !token.empty(); token = read_token(line))
+                {
+                    auto& corner = chunk.corner_list.emplace_back();
+                    corner.position_index = encode_index(
+                        read_index(token),
+                        chunk.position_list.size());
+                    corner.texture_coord_index = encode_index(
+                        read_index(token),
+                        chunk.texture_coord_list.size());
+                    corner.normal_index = encode_index(
+                        read_index(token),
+                        chunk.normal_list.size());
+
+                    XAR_THROW_IF(
+                        corner.position_index == 0,
+                        error::XarException,
+                        "Face without position index in OBJ file '{}'",
+                        _path.string());
+
+                    ++corner_count;
+                }
+
+                XAR_THROW_IF(
+                    corner_count < 3,
+                    error::XarException,
+                    "Face with {} corners in OBJ file '{}'",
+                    corner_count,
+                    _path.string());
+
+                chunk.face_corner_count_list.push_back(corner_count);
+            }
+
+            [[nodiscard]]
+            std::int32_t encode_index(
+                std::int32_t index,
+                std::size_t chunk_element_count) const
+            {
+                if (index >= 0)
+                {
+                    return index;
+                }
+
+                XAR_THROW_IF(
+                    chunk_element_count >= static_cast<std::size_t>(RELATIVE_INDEX_BIAS) || index <= -RELATIVE_INDEX_BIAS,
+                    error::XarException,
+                    "Relative face index {} is out of range in OBJ file '{}'",
+                    index,
+                    _path.string());
+
+                return static_cast<std::int32_t>(chunk_element_count) + index - RELATIVE_INDEX_BIAS;
+            }
+
+            [[nodiscard]]
+            float read_float(std::string_view& line) const
+            {
+                const auto token = read_token(line);
+
+                auto value = 0.0f;
+                const auto result = std::from_chars(
+                    token.data(),
+                    token.data() + token.size(),
+                    value);
+                XAR_THROW_IF(
+                    token.empty() || result.ec != std::errc{},
+                    error::XarException,
+                    "Invalid number '{}' in OBJ file '{}'",
+                    token,
+                    _path.string());
+
+                return value;
+            }
+
+            // Reads one '/' separated index of a face corner, returns 0 when it is omitted.
+            [[nodiscard]]
+            std::int32_t read_index(std::string_view& token) const
+            {
+                if (token.empty())
+                {
+                    return 0;
+                }
+
+                auto value = std::int32_t{0};
+                const auto result = std::from_chars(
+                    token.data(),
+                    token.data() + token.size(),
+                    value);
+                XAR_THROW_IF(
+                    result.ec != std::errc{} && token.front() != '/',
+                    error::XarException,
+                    "Invalid face index '{}' in OBJ file '{}'",
+                    token,
+                    _path.string());
+
+                token.remove_prefix(result.ptr - token.data());
+                if (!token.empty() && token.front() == '/')
+                {
+                    token.remove_prefix(1);
+                }
+
+                return value;
+            }
+
+            static void skip_whitespace(std::string_view& line)
+            {
+                const auto token_begin = line.find_first_not_of(" \t\r");
+                line.remove_prefix(token_begin == std::string_view::npos ? line.size() : token_begin);
+            }
+
+            [[nodiscard]]
+            static std::string_view read_token(std::string_view& line)
+            {
+                skip_whitespace(line);
+
+                const auto token_end = std::min(
+                    line.find_first_of(" \t\r"),
+                    line.size());
+                const auto token = line.substr(
+                    0,
+                    token_end);
+                line.remove_prefix(token_end);
+
+                return token;
+            }
+
+        private:
+            std::string_view _text;
+            const std::filesystem::path& _path;
+        };
+
+        class ObjParser
+        {
+        public:
+            ObjParser(
+                const std::filesystem::path& path,
+                thread::ThreadPool& thread_pool)
+                : _path(path)
+                , _thread_pool(thread_pool)
+            {
+            }
+
+            [[nodiscard]]
+            Model parse_model()
+            {
+                const auto memory_mapped_file = file::MemoryMappedFile{_path};
+                const auto bytes = memory_mapped_file.get_bytes();
+
+                const auto text_list = split_into_chunks(
+                    std::string_view{
+                        reinterpret_cast<const char*>(bytes.data()),
+                        bytes.size()
+                    });
+
+                _chunk_list.resize(text_list.size());
+                _thread_pool.parallel_for(
+                    text_list.size(),
+                    [this, &text_list](std::size_t chunk_index)
+                    {
+                        _chunk_list[chunk_index] = ObjChunkParser{
+                            text_list[chunk_index],
+                            _path
+                        }.parse_chunk();
+                    });
+
+                merge_chunks();
+
+                // OBJ has no node hierarchy, mesh::process_node_list adds a root node owning every mesh.
+                auto model = Model{
+                    {_path.stem().string()},
+                    std::vector<Mesh>(_mesh_range_list.size()),
+                    {},
+                    {}
+                };
+                _thread_pool.parallel_for(
+                    _mesh_range_list.size(),
+                    [this, &model](std::size_t mesh_index)
+                    {
+                        model.mesh_list[mesh_index] = build_mesh(_mesh_range_list[mesh_index]);
+                    });
+
+                return model;
+            }
+
+        private:
+            [[nodiscard]]
+            std::vector<std::string_view> split_into_chunks(std::string_view text) const
+            {
+                const auto chunk_count = std::clamp(
+                    text.size() / MIN_CHUNK_BYTE_SIZE,
+                    std::size_t{1},
+                    _thread_pool.get_worker_count() * CHUNKS_PER_WORKER);
+                const auto chunk_byte_size = text.size() / chunk_count + 1;
+
+                auto text_list = std::vector<std::string_view>{};
+                text_list.reserve(chunk_count);
+                while (!text.empty())
+                {
+                    const auto line_end = text.find(
+                        '\n',
+                        std::min(
+                            chunk_byte_size,
+                            text.size() - 1));
+                    const auto chunk_end = line_end == std::string_view::npos ? text.size() : line_end + 1;
+
+                    text_list.push_back(
+                        text.substr(
+                            0,
+                            chunk_end));
+                    text.remove_prefix(chunk_end);
+                }
+
+                return text_list;
+            }
+
+            // Resolves chunk-relative indices to 0-based indices into the concatenated attribute lists
+            // and records where every mesh begins.
+            void merge_chunks()
+            {
+                auto chunk_base_list = std::vector<ObjCorner>(_chunk_list.size());
+                auto chunk_base = ObjCorner{0, 0, 0};
+                for (auto chunk_index = std::size_t{0}; chunk_index < _chunk_list.size(); ++chunk_index)
+                {
+                    const auto& chunk = _chunk_list[chunk_index];
+
+                    chunk_base_list[chunk_index] = chunk_base;
+                    chunk_base.position_index += static_cast<std::int32_t>(chunk.position_list.size());
+                    chunk_base.texture_coord_index += static_cast<std::int32_t>(chunk.texture_coord_list.size());
+                    chunk_base.normal_index += static_cast<std::int32_t>(chunk.normal_list.size());
+                }
+
+                _thread_pool.parallel_for(
+                    _chunk_list.size(),
+                    [this, &chunk_base_list](std::size_t chunk_index)
+                    {
+                        resolve_chunk_indices(
+                            _chunk_list[chunk_index],
+                            chunk_base_list[chunk_index]);
+                    });
+
+                auto face_count = std::size_t{0};
+                begin_mesh(0);
+                for (auto& chunk: _chunk_list)
+                {
+                    for (const auto mesh_begin_face: chunk.mesh_begin_face_list)
+                    {
+                        begin_mesh(face_count + mesh_begin_face);
+                    }
+
+                    face_count += chunk.face_corner_count_list.size();
+
+                    append(
+                        _position_list,
+                        chunk.position_list);
+                    append(
+                        _texture_coord_list,
+                        chunk.texture_coord_list);
+                    append(
+                        _normal_list,
+                        chunk.normal_list);
+                    append(
+                        _corner_list,
+                        chunk.corner_list);
+                    append(
+                        _face_corner_count_list,
+                        chunk.face_corner_count_list);
+                }
+
+                _mesh_range_list.back().face_end = face_count;
+                std::erase_if(
+                    _mesh_range_list,
+                    [](const ObjMeshRange& mesh_range)
+                    {
+                        return mesh_range.face_begin == mesh_range.face_end;
+                    });
+
+                _face_corner_begin_list.resize(_face_corner_count_list.size());
+                std::exclusive_scan(
+                    _face_corner_count_list.begin(),
+                    _face_corner_count_list.end(),
+                    _face_corner_begin_list.begin(),
+                    std::size_t{0});
+            }
+
+            void begin_mesh(std::size_t face_begin)
+            {
+                if (!_mesh_range_list.empty())
+                {
+                    _mesh_range_list.back().face_end = face_begin;
+                }
+
+                _mesh_range_list.push_back(
+                    {
+                        face_begin,
+                        face_begin
+                    });
+            }
+
+            static void resolve_chunk_indices(
+                ObjChunk& chunk,
+                const ObjCorner& chunk_base)
+            {
+                for (auto& corner: chunk.corner_list)
+                {
+                    corner.position_index = resolve_index(
+                        corner.position_index,
+                        chunk_base.position_index);
+                    corner.texture_coord_index = resolve_index(
+                        corner.texture_coord_index,
+                        chunk_base.texture_coord_index);
+                    corner.normal_index = resolve_index(
+                        corner.normal_index,
+                        chunk_base.normal_index);
+                }
+            }
+
+            [[nodiscard]]
+            static std::int32_t resolve_index(
+                std::int32_t index,
+                std::int32_t chunk_base)
+            {
+                if (index > 0)
+                {
+                    return index - 1;
+                }
+                if (index < 0)
+                {
+                    return chunk_base + index + RELATIVE_INDEX_BIAS;
+                }
+
+                return MISSING_INDEX;
+            }
+
+            [[nodiscard]]
+            Mesh build_mesh(const ObjMeshRange& mesh_range) const
+            {
+                const auto has_texture_coords = !_texture_coord_list.empty();
+                const auto has_normals = !_normal_list.empty();
+
+                auto corner_count = std::size_t{0};
+                auto triangle_count = std::size_t{0};
+                for (auto face_index = mesh_range.face_begin; face_index < mesh_range.face_end; ++face_index)
+                {
+                    corner_count += _face_corner_count_list[face_index];
+                    triangle_count += _face_corner_count_list[face_index] - 2;
+                }
+
+                auto mesh = Mesh{};
+                mesh.index_list.reserve(triangle_count * 3);
+
+                auto vertex_map = ObjVertexMap{corner_count};
+                auto corner_index_list = std::vector<std::uint32_t>(corner_count);
+                for (auto corner_index = std::size_t{0}; corner_index < corner_count; ++corner_index)
+                {
+                    auto corner = _corner_list[_face_corner_begin_list[mesh_range.face_begin] + corner_index];
+                    corner.texture_coord_index = has_texture_coords ? corner.texture_coord_index : MISSING_INDEX;
+                    corner.normal_index = has_normals ? corner.normal_index : MISSING_INDEX;
+
+                    const auto [vertex_index, is_inserted] = vertex_map.emplace(
+                        corner,
+                        static_cast<std::uint32_t>(mesh.position_list.size()));
+                    corner_index_list[corner_index] = vertex_index;
+
+                    if (is_inserted)
+                    {
+                        mesh.position_list.push_back(
+                            get_element(
+                                _position_list,
+                                corner.position_index,
+                                "position"));
+                        if (has_texture_coords)
+                        {
+                            mesh.texture_coord_list.push_back(
+                                corner.texture_coord_index == MISSING_INDEX
+                                    ? math::Vector2f{0.0f, 0.0f}
+                                    : get_element(
+                                        _texture_coord_list,
+                                        corner.texture_coord_index,
+                                        "texture coordinate"));
+                        }
+                        if (has_normals)
+                        {
+                            mesh.normal_list.push_back(
+                                corner.normal_index == MISSING_INDEX
+                                    ? math::Vector3f{0.0f, 0.0f, 0.0f}
+                                    : get_element(
+                                        _normal_list,
+                                        corner.normal_index,
+                                        "normal"));
+                        }
+                    }
+                }
+
+                auto face_corner_begin = std::size_t{0};
+                for (auto face_index = mesh_range.face_begin; face_index < mesh_range.face_end; ++face_index)
+                {
+                    const auto face_corner_count = _face_corner_count_list[face_index];
+                    for (auto fan_index = std::uint32_t{1}; fan_index + 1 < face_corner_count; ++fan_index)
+                    {
+                        mesh.index_list.push_back(corner_index_list[face_corner_begin]);
+                        mesh.index_list.push_back(corner_index_list[face_corner_begin + fan_index]);
+                        mesh.index_list.push_back(corner_index_list[face_corner_begin + fan_index + 1]);
+                    }
+
+                    face_corner_begin += face_corner_count;
+                }
+
+                return mesh;
+            }
+
+            template <typename T>
+            [[nodiscard]]
+            const T& get_element(
+                const std::vector<T>& element_list,
+                std::int32_t index,
+                std::string_view element_name) const
+            {
+                XAR_THROW_IF(
+                    index < 0 || static_cast<std::size_t>(index) >= element_list.size(),
+                    error::XarException,
+                    "Face references missing {} {} in OBJ file '{}'",
+                    element_name,
+                    index + 1,
+                    _path.string());
+
+                return element_list[index];
+            }
+
+            template <typename T>
+            static void append(
+                std::vector<T>& destination,
+                std::vector<T>& source)
+            {
+                destination.insert(
+                    destination.end(),
+                    source.begin(),
+                    source.end());
+                source = {};
+            }
+
+        private:
+            const std::filesystem::path& _path;
+            thread::ThreadPool& _thread_pool;
+
+            std::vector<ObjChunk> _chunk_list;
+
+            std::vector<math::Vector3f> _position_list;
+            std::vector<math::Vector2f> _texture_coord_list;
+            std::vector<math::Vector3f> _normal_list;
+            std::vector<ObjCorner> _corner_list;
+            std::vector<std::uint32_t> _face_corner_count_list;
+            std::vector<std::size_t> _face_corner_begin_list;
+            std::vector<ObjMeshRange> _mesh_range_list;
+        };
+    }
+
+    ObjModelLoader::ObjModelLoader()
+        : ObjModelLoader(std::make_shared<thread::ThreadPool>(thread::ThreadPool::get_default_worker_count()))
+    {
+    }
+
+    ObjModelLoader::ObjModelLoader(std::shared_ptr<thread::ThreadPool> thread_pool)
+        : _thread_pool(std::move(thread_pool))
+    {
+    }
+
+    Model ObjModelLoader::load_model_from_file(const std::filesystem::path& path) const
+    {
+        return ObjParser{
+            path,
+            *_thread_pool
+        }.parse_model();
+    }
+}
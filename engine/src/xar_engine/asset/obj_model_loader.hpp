@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include <xar_engine/asset/model_loader.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_engine::asset
+{
+    // Wavefront OBJ loader for positions, texture coordinates, normals and polygonal faces. Every 'o', 'g'
+    // or 'usemtl' statement followed by faces starts a new mesh. Other statements are ignored.
+    class ObjModelLoader
+        : public IModelLoader
+    {
+    public:
+        ObjModelLoader();
+        explicit ObjModelLoader(std::shared_ptr<thread::ThreadPool> thread_pool);
+
+
+        [[nodiscard]]
+        Model load_model_from_file(const std::filesystem::path& path) const override;
+
+    private:
+        std::shared_ptr<thread::ThreadPool> _thread_pool;
+    };
+}
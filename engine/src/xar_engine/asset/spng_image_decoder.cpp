@@ -0,0 +1,94 @@
+#include <xar_engine/asset/spng_image_decoder.hpp>
+
+#include <memory>
+
+#include <spng.h>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::asset
+{
+    Image SpngImageDecoder::decode_image(std::span<const std::uint8_t> file_bytes) const
+    {
+        const auto spng_context = std::unique_ptr<spng_ctx, decltype(&spng_ctx_free)>{
+            spng_ctx_new(0),
+            &spng_ctx_free
+        };
+        XAR_THROW_IF(
+            spng_context == nullptr,
+            error::XarException,
+            "spng_ctx_new failed");
+
+        auto spng_result = spng_set_png_buffer(
+            spng_context.get(),
+            file_bytes.data(),
+            file_bytes.size());
+        XAR_THROW_IF(
+            spng_result != 0,
+            error::XarException,
+            "spng_set_png_buffer failed: {}",
+            spng_strerror(spng_result));
+
+        auto spng_header = spng_ihdr{};
+        spng_result = spng_get_ihdr(
+            spng_context.get(),
+            &spng_header);
+        XAR_THROW_IF(
+            spng_result != 0,
+            error::XarException,
+            "spng_get_ihdr failed: {}",
+            spng_strerror(spng_result));
+
+        if (spng_header.bit_depth > 8)
+        {
+            return _high_bit_depth_image_decoder.decode_image(file_bytes);
+        }
+
+        Image image;
+        auto spng_format = SPNG_FMT_RGBA8;
+        switch (spng_header.color_type)
+        {
+            case SPNG_COLOR_TYPE_GRAYSCALE:
+            {
+                spng_format = SPNG_FMT_G8;
+                image.pixel_format = EPixelFormat::R8;
+                break;
+            }
+            case SPNG_COLOR_TYPE_GRAYSCALE_ALPHA:
+            {
+                spng_format = SPNG_FMT_GA8;
+                image.pixel_format = EPixelFormat::R8G8;
+                break;
+            }
+            default:
+            {
+                spng_format = SPNG_FMT_RGBA8;
+                image.pixel_format = EPixelFormat::R8G8B8A8;
+                break;
+            }
+        }
+
+        image.channel_count = image::get_channel_count(image.pixel_format);
+        image.pixel_width = spng_header.width;
+        image.pixel_height = spng_header.height;
+        image.mip_level_count = image::get_mip_level_count(
+            image.pixel_width,
+            image.pixel_height);
+        image.bytes.resize(image::get_byte_size(image));
+
+        spng_result = spng_decode_image(
+            spng_context.get(),
+            image.bytes.data(),
+            image.bytes.size(),
+            spng_format,
+            SPNG_DECODE_TRNS);
+        XAR_THROW_IF(
+            spng_result != 0,
+            error::XarException,
+            "spng_decode_image failed: {}",
+            spng_strerror(spng_result));
+
+        return image;
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <xar_engine/asset/image_decoder.hpp>
+#include <xar_engine/asset/stb_image_decoder.hpp>
+
+
+namespace xar_engine::asset
+{
+    class SpngImageDecoder
+        : public IImageDecoder
+    {
+    public:
+        [[nodiscard]]
+        Image decode_image(std::span<const std::uint8_t> file_bytes) const override;
+
+    private:
+        StbImageDecoder _high_bit_depth_image_decoder;
+    };
+}
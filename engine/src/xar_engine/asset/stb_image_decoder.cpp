@@ -0,0 +1,178 @@
+#include <xar_engine/asset/stb_image_decoder.hpp>
+
+#include <cstring>
+#include <limits>
+
+#define STB_IMAGE_IMPLEMENTATION
+
+#include <stb_image.h>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/math/half_float.hpp>
+
+
+namespace xar_engine::asset
+{
+    namespace
+    {
+        EPixelFormat get_8_bit_pixel_format(std::int32_t file_channel_count)
+        {
+            switch (file_channel_count)
+            {
+                case STBI_grey:
+                {
+                    return EPixelFormat::R8;
+                }
+                case STBI_grey_alpha:
+                {
+                    return EPixelFormat::R8G8;
+                }
+                default:
+                {
+                    return EPixelFormat::R8G8B8A8;
+                }
+            }
+        }
+
+        EPixelFormat get_16_bit_pixel_format(std::int32_t file_channel_count)
+        {
+            switch (file_channel_count)
+            {
+                case STBI_grey:
+                {
+                    return EPixelFormat::R16_FLOAT;
+                }
+                default:
+                {
+                    return EPixelFormat::R16G16B16A16_FLOAT;
+                }
+            }
+        }
+
+        template <typename T>
+        void write_half_float_bytes(
+            const T* const values,
+            float value_scale,
+            std::vector<std::uint8_t>& bytes)
+        {
+            const auto value_count = bytes.size() / sizeof(std::uint16_t);
+            for (auto value_index = std::size_t{0}; value_index < value_count; ++value_index)
+            {
+                const auto half_float = math::to_half_float(static_cast<float>(values[value_index]) * value_scale);
+                std::memcpy(
+                    bytes.data() + value_index * sizeof(half_float),
+                    &half_float,
+                    sizeof(half_float));
+            }
+        }
+    }
+
+    Image StbImageDecoder::decode_image(std::span<const std::uint8_t> file_bytes) const
+    {
+        const auto* const file_byte_data = reinterpret_cast<const stbi_uc*>(file_bytes.data());
+        const auto file_byte_count = static_cast<std::int32_t>(file_bytes.size());
+
+        auto width = std::int32_t{0};
+        auto height = std::int32_t{0};
+        auto file_channel_count = std::int32_t{0};
+
+        const auto info_result = stbi_info_from_memory(
+            file_byte_data,
+            file_byte_count,
+            &width,
+            &height,
+            &file_channel_count);
+        XAR_THROW_IF(
+            info_result == 0,
+            error::XarException,
+            "Failed to decode {} byte image",
+            file_bytes.size());
+
+        const auto is_hdr = stbi_is_hdr_from_memory(
+            file_byte_data,
+            file_byte_count) != 0;
+        const auto is_16_bit = stbi_is_16_bit_from_memory(
+            file_byte_data,
+            file_byte_count) != 0;
+
+        Image image;
+        image.pixel_format = is_hdr || is_16_bit ?
+                             get_16_bit_pixel_format(file_channel_count) :
+                             get_8_bit_pixel_format(file_channel_count);
+        image.channel_count = image::get_channel_count(image.pixel_format);
+        image.pixel_width = static_cast<std::uint32_t>(width);
+        image.pixel_height = static_cast<std::uint32_t>(height);
+        image.bytes.resize(image::get_byte_size(image));
+
+        const auto data_channel_count = static_cast<std::int32_t>(image.channel_count);
+        void* pixels = nullptr;
+        if (is_hdr)
+        {
+            auto* const float_pixels = stbi_loadf_from_memory(
+                file_byte_data,
+                file_byte_count,
+                &width,
+                &height,
+                &file_channel_count,
+                data_channel_count);
+            if (float_pixels != nullptr)
+            {
+                write_half_float_bytes(
+                    float_pixels,
+                    1.0f,
+                    image.bytes);
+            }
+            pixels = float_pixels;
+        }
+        else if (is_16_bit)
+        {
+            auto* const short_pixels = stbi_load_16_from_memory(
+                file_byte_data,
+                file_byte_count,
+                &width,
+                &height,
+                &file_channel_count,
+                data_channel_count);
+            if (short_pixels != nullptr)
+            {
+                write_half_float_bytes(
+                    short_pixels,
+                    1.0f / static_cast<float>(std::numeric_limits<stbi_us>::max()),
+                    image.bytes);
+            }
+            pixels = short_pixels;
+        }
+        else
+        {
+            auto* const byte_pixels = stbi_load_from_memory(
+                file_byte_data,
+                file_byte_count,
+                &width,
+                &height,
+                &file_channel_count,
+                data_channel_count);
+            if (byte_pixels != nullptr)
+            {
+                std::memcpy(
+                    image.bytes.data(),
+                    byte_pixels,
+                    image.bytes.size());
+            }
+            pixels = byte_pixels;
+        }
+        XAR_THROW_IF(
+            pixels == nullptr,
+            error::XarException,
+            "Failed to decode {} byte image",
+            file_bytes.size());
+
+        image.mip_level_count = image::get_mip_level_count(
+            image.pixel_width,
+            image.pixel_height);
+
+        stbi_image_free(pixels);
+
+        return image;
+    }
+}
@@ -0,0 +1,68 @@
+#include <xar_engine/asset/turbojpeg_image_decoder.hpp>
+
+#include <memory>
+
+#include <turbojpeg.h>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::asset
+{
+    Image TurboJpegImageDecoder::decode_image(std::span<const std::uint8_t> file_bytes) const
+    {
+        const auto tj_handle = std::unique_ptr<void, decltype(&tj3Destroy)>{
+            tj3Init(TJINIT_DECOMPRESS),
+            &tj3Destroy
+        };
+        XAR_THROW_IF(
+            tj_handle == nullptr,
+            error::XarException,
+            "tj3Init failed");
+
+        const auto header_result = tj3DecompressHeader(
+            tj_handle.get(),
+            file_bytes.data(),
+            file_bytes.size());
+        XAR_THROW_IF(
+            header_result != 0,
+            error::XarException,
+            "tj3DecompressHeader failed: {}",
+            tj3GetErrorStr(tj_handle.get()));
+
+        const auto is_gray = tj3Get(
+            tj_handle.get(),
+            TJPARAM_COLORSPACE) == TJCS_GRAY;
+
+        Image image;
+        image.pixel_format = is_gray ? EPixelFormat::R8 : EPixelFormat::R8G8B8A8;
+        image.channel_count = image::get_channel_count(image.pixel_format);
+        image.pixel_width = static_cast<std::uint32_t>(
+            tj3Get(
+                tj_handle.get(),
+                TJPARAM_JPEGWIDTH));
+        image.pixel_height = static_cast<std::uint32_t>(
+            tj3Get(
+                tj_handle.get(),
+                TJPARAM_JPEGHEIGHT));
+        image.mip_level_count = image::get_mip_level_count(
+            image.pixel_width,
+            image.pixel_height);
+        image.bytes.resize(image::get_byte_size(image));
+
+        const auto decompress_result = tj3Decompress8(
+            tj_handle.get(),
+            file_bytes.data(),
+            file_bytes.size(),
+            image.bytes.data(),
+            0,
+            is_gray ? TJPF_GRAY : TJPF_RGBA);
+        XAR_THROW_IF(
+            decompress_result != 0,
+            error::XarException,
+            "tj3Decompress8 failed: {}",
+            tj3GetErrorStr(tj_handle.get()));
+
+        return image;
+    }
+}
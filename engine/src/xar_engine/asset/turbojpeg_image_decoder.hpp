@@ -0,0 +1,15 @@
+#pragma once
+
+#include <xar_engine/asset/image_decoder.hpp>
+
+
+namespace xar_engine::asset
+{
+    class TurboJpegImageDecoder
+        : public IImageDecoder
+    {
+    public:
+        [[nodiscard]]
+        Image decode_image(std::span<const std::uint8_t> file_bytes) const override;
+    };
+}
@@ -0,0 +1,452 @@
+#include <xar_engine/asset/xmesh_model_file.hpp>
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <type_traits>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/file/memory_mapped_file.hpp>
+
+
+namespace xar_engine::asset
+{
+    namespace
+    {
+        // Streams are copied to and from the file as raw bytes, so the layout is
+        // only portable between little-endian hosts with tightly packed vectors.
+        static_assert(std::endian::native == std::endian::little);
+        static_assert(std::is_trivially_copyable_v<math::Vector3f> && sizeof(math::Vector3f) == 3 * sizeof(float));
+        static_assert(std::is_trivially_copyable_v<math::Vector2f> && sizeof(math::Vector2f) == 2 * sizeof(float));
+        static_assert(std::is_trivially_copyable_v<math::Vector4f> && sizeof(math::Vector4f) == 4 * sizeof(float));
+        static_assert(std::is_trivially_copyable_v<BoundingVolume> && sizeof(BoundingVolume) == 10 * sizeof(float));
+
+        constexpr auto XMESH_MAGIC = std::uint32_t{0x48534D58}; // "XMSH"
+        constexpr auto XMESH_VERSION = std::uint32_t{4};
+        constexpr auto XMESH_STREAM_ALIGNMENT = std::uint64_t{16};
+
+        struct XmeshFileHeader
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t mesh_count;
+            std::uint32_t name_byte_size;
+            std::uint64_t name_offset;
+            std::uint64_t mesh_header_offset;
+            BoundingVolume bounding_volume;
+            std::uint32_t node_count;
+            std::uint32_t node_mesh_index_count;
+            std::uint64_t node_offset;
+            std::uint64_t node_mesh_index_offset;
+        };
+
+        // Nodes are stored as records and split into the node lists on load.
+        // Ordered so that the aligned rotation leaves no implicit padding in the written bytes.
+        struct XmeshNode
+        {
+            math::Vector4f rotation;
+            math::Vector3f translation;
+            std::int32_t parent_index;
+            math::Vector3f scale;
+            std::uint32_t mesh_index_offset;
+            std::uint32_t mesh_index_count;
+            std::uint32_t reserved[3];
+        };
+
+        static_assert(sizeof(XmeshNode) == 64);
+
+        struct XmeshMeshHeader
+        {
+            std::uint32_t position_count;
+            std::uint32_t normal_count;
+            std::uint32_t tangent_count;
+            std::uint32_t texture_coord_count;
+            std::uint32_t index_count;
+            std::uint32_t reserved;
+            std::uint64_t position_offset;
+            std::uint64_t normal_offset;
+            std::uint64_t tangent_offset;
+            std::uint64_t texture_coord_offset;
+            std::uint64_t index_offset;
+            BoundingVolume bounding_volume;
+        };
+
+        std::uint64_t align_offset(std::uint64_t offset)
+        {
+            return (offset + XMESH_STREAM_ALIGNMENT - 1) & ~(XMESH_STREAM_ALIGNMENT - 1);
+        }
+
+        class XmeshWriter
+        {
+        public:
+            std::uint64_t allocate(std::uint64_t byte_size)
+            {
+                const auto offset = align_offset(_bytes.size());
+                _bytes.resize(offset + byte_size);
+
+                return offset;
+            }
+
+            template <typename T>
+            std::uint64_t append(std::span<const T> element_list)
+            {
+                const auto byte_size = element_list.size_bytes();
+                const auto offset = allocate(byte_size);
+
+                if (byte_size != 0)
+                {
+                    std::memcpy(
+                        _bytes.data() + offset,
+                        element_list.data(),
+                        byte_size);
+                }
+
+                return offset;
+            }
+
+            template <typename T>
+            void overwrite(
+                std::uint64_t offset,
+                const T& value)
+            {
+                std::memcpy(
+                    _bytes.data() + offset,
+                    &value,
+                    sizeof(T));
+            }
+
+            [[nodiscard]]
+            const std::vector<char>& get_bytes() const
+            {
+                return _bytes;
+            }
+
+        private:
+            std::vector<char> _bytes;
+        };
+
+        class XmeshReader
+        {
+        public:
+            XmeshReader(
+                std::span<const std::uint8_t> bytes,
+                const std::filesystem::path& path)
+                : _bytes(bytes)
+                , _path(path)
+            {
+            }
+
+            template <typename T>
+            T read(std::uint64_t offset) const
+            {
+                check_range(
+                    offset,
+                    sizeof(T));
+
+                auto value = T{};
+                std::memcpy(
+                    &value,
+                    _bytes.data() + offset,
+                    sizeof(T));
+
+                return value;
+            }
+
+            template <typename T>
+            std::span<const std::uint8_t> read_span(
+                std::uint64_t offset,
+                std::uint64_t count) const
+            {
+                check_range(
+                    offset,
+                    count * sizeof(T));
+
+                return _bytes.subspan(
+                    offset,
+                    count * sizeof(T));
+            }
+
+        private:
+            void check_range(
+                std::uint64_t offset,
+                std::uint64_t byte_size) const
+            {
+                XAR_THROW_IF(
+                    offset > _bytes.size() || byte_size > _bytes.size() - offset,
+                    error::XarException,
+                    "Xmesh file '{}' is truncated",
+                    _path.string());
+            }
+
+        private:
+            std::span<const std::uint8_t> _bytes;
+            const std::filesystem::path& _path;
+        };
+
+        template <typename T>
+        std::vector<T> to_element_list(
+            std::span<const std::uint8_t> bytes,
+            std::uint64_t count)
+        {
+            auto element_list = std::vector<T>(count);
+            if (count != 0)
+            {
+                std::memcpy(
+                    element_list.data(),
+                    bytes.data(),
+                    count * sizeof(T));
+            }
+
+            return element_list;
+        }
+    }
+
+    Model XmeshModelLoader::load_model_from_file(const std::filesystem::path& path) const
+    {
+        const auto memory_mapped_file = file::MemoryMappedFile{path};
+        const auto model_layout = xmesh::read_model_layout(
+            memory_mapped_file.get_bytes(),
+            path);
+
+        auto model = Model{
+            {
+                model_layout.name
+            },
+            {},
+            model_layout.node_list,
+            model_layout.bounding_volume
+        };
+        model.mesh_list.reserve(model_layout.mesh_layout_list.size());
+
+        for (const auto& mesh_layout: model_layout.mesh_layout_list)
+        {
+            model.mesh_list.push_back(
+                {
+                    to_element_list<math::Vector3f>(
+                        mesh_layout.position_bytes,
+                        mesh_layout.position_count),
+                    to_element_list<math::Vector3f>(
+                        mesh_layout.normal_bytes,
+                        mesh_layout.normal_count),
+                    to_element_list<math::Vector4f>(
+                        mesh_layout.tangent_bytes,
+                        mesh_layout.tangent_count),
+                    to_element_list<math::Vector2f>(
+                        mesh_layout.texture_coord_bytes,
+                        mesh_layout.texture_coord_count),
+                    to_element_list<std::uint32_t>(
+                        mesh_layout.index_bytes,
+                        mesh_layout.index_count),
+                    mesh_layout.bounding_volume,
+                });
+        }
+
+        return model;
+    }
+
+
+    namespace xmesh
+    {
+        XmeshModelLayout read_model_layout(
+            std::span<const std::uint8_t> file_bytes,
+            const std::filesystem::path& path)
+        {
+            const auto reader = XmeshReader{
+                file_bytes,
+                path
+            };
+
+            const auto file_header = reader.read<XmeshFileHeader>(0);
+            XAR_THROW_IF(
+                file_header.magic != XMESH_MAGIC,
+                error::XarException,
+                "File '{}' is not an xmesh file",
+                path.string());
+            XAR_THROW_IF(
+                file_header.version != XMESH_VERSION,
+                error::XarException,
+                "Xmesh file '{}' has version {} but version {} is required",
+                path.string(),
+                file_header.version,
+                XMESH_VERSION);
+
+            const auto name_bytes = reader.read_span<char>(
+                file_header.name_offset,
+                file_header.name_byte_size);
+
+            auto model_layout = XmeshModelLayout{
+                std::string{
+                    name_bytes.begin(),
+                    name_bytes.end()
+                },
+                {},
+                {},
+                file_header.bounding_volume
+            };
+            model_layout.mesh_layout_list.reserve(file_header.mesh_count);
+
+            auto& node_list = model_layout.node_list;
+            node_list.parent_index_list.reserve(file_header.node_count);
+            node_list.translation_list.reserve(file_header.node_count);
+            node_list.rotation_list.reserve(file_header.node_count);
+            node_list.scale_list.reserve(file_header.node_count);
+            node_list.mesh_index_offset_list.reserve(file_header.node_count);
+            node_list.mesh_index_count_list.reserve(file_header.node_count);
+            for (auto node_index = std::uint64_t{0}; node_index < file_header.node_count; ++node_index)
+            {
+                const auto node = reader.read<XmeshNode>(file_header.node_offset + node_index * sizeof(XmeshNode));
+
+                node_list.parent_index_list.push_back(node.parent_index);
+                node_list.translation_list.push_back(node.translation);
+                node_list.rotation_list.push_back(node.rotation);
+                node_list.scale_list.push_back(node.scale);
+                node_list.mesh_index_offset_list.push_back(node.mesh_index_offset);
+                node_list.mesh_index_count_list.push_back(node.mesh_index_count);
+            }
+            node_list.mesh_index_list = to_element_list<std::uint32_t>(
+                reader.read_span<std::uint32_t>(
+                    file_header.node_mesh_index_offset,
+                    file_header.node_mesh_index_count),
+                file_header.node_mesh_index_count);
+
+            for (auto mesh_index = std::uint64_t{0}; mesh_index < file_header.mesh_count; ++mesh_index)
+            {
+                const auto mesh_header = reader.read<XmeshMeshHeader>(file_header.mesh_header_offset + mesh_index * sizeof(XmeshMeshHeader));
+
+                model_layout.mesh_layout_list.push_back(
+                    {
+                        mesh_header.position_count,
+                        mesh_header.normal_count,
+                        mesh_header.tangent_count,
+                        mesh_header.texture_coord_count,
+                        mesh_header.index_count,
+                        reader.read_span<math::Vector3f>(
+                            mesh_header.position_offset,
+                            mesh_header.position_count),
+                        reader.read_span<math::Vector3f>(
+                            mesh_header.normal_offset,
+                            mesh_header.normal_count),
+                        reader.read_span<math::Vector4f>(
+                            mesh_header.tangent_offset,
+                            mesh_header.tangent_count),
+                        reader.read_span<math::Vector2f>(
+                            mesh_header.texture_coord_offset,
+                            mesh_header.texture_coord_count),
+                        reader.read_span<std::uint32_t>(
+                            mesh_header.index_offset,
+                            mesh_header.index_count),
+                        mesh_header.bounding_volume,
+                    });
+            }
+
+            return model_layout;
+        }
+
+        void write_model_to_file(
+            const Model& model,
+            const std::filesystem::path& path)
+        {
+            auto writer = XmeshWriter{};
+
+            const auto file_header_offset = writer.allocate(sizeof(XmeshFileHeader));
+            const auto mesh_header_offset = writer.allocate(model.mesh_list.size() * sizeof(XmeshMeshHeader));
+            const auto name_offset = writer.append(std::span<const char>{model.metadata.name});
+
+            const auto& node_list = model.node_list;
+            const auto node_count = node_list.parent_index_list.size();
+            XAR_THROW_IF(
+                node_list.translation_list.size() != node_count ||
+                node_list.rotation_list.size() != node_count ||
+                node_list.scale_list.size() != node_count ||
+                node_list.mesh_index_offset_list.size() != node_count ||
+                node_list.mesh_index_count_list.size() != node_count,
+                error::XarException,
+                "Node lists of model '{}' have different sizes",
+                model.metadata.name);
+            const auto node_offset = writer.allocate(node_count * sizeof(XmeshNode));
+            for (auto node_index = std::size_t{0}; node_index < node_count; ++node_index)
+            {
+                writer.overwrite(
+                    node_offset + node_index * sizeof(XmeshNode),
+                    XmeshNode{
+                        node_list.rotation_list[node_index],
+                        node_list.translation_list[node_index],
+                        node_list.parent_index_list[node_index],
+                        node_list.scale_list[node_index],
+                        node_list.mesh_index_offset_list[node_index],
+                        node_list.mesh_index_count_list[node_index],
+                        {},
+                    });
+            }
+            const auto node_mesh_index_offset = writer.append(std::span<const std::uint32_t>{node_list.mesh_index_list});
+
+            writer.overwrite(
+                file_header_offset,
+                XmeshFileHeader{
+                    XMESH_MAGIC,
+                    XMESH_VERSION,
+                    static_cast<std::uint32_t>(model.mesh_list.size()),
+                    static_cast<std::uint32_t>(model.metadata.name.size()),
+                    name_offset,
+                    mesh_header_offset,
+                    model.bounding_volume,
+                    static_cast<std::uint32_t>(node_count),
+                    static_cast<std::uint32_t>(node_list.mesh_index_list.size()),
+                    node_offset,
+                    node_mesh_index_offset,
+                });
+
+            for (auto mesh_index = std::size_t{0}; mesh_index < model.mesh_list.size(); ++mesh_index)
+            {
+                const auto& mesh = model.mesh_list[mesh_index];
+
+                auto mesh_header = XmeshMeshHeader{};
+                mesh_header.position_count = static_cast<std::uint32_t>(mesh.position_list.size());
+                mesh_header.normal_count = static_cast<std::uint32_t>(mesh.normal_list.size());
+                mesh_header.tangent_count = static_cast<std::uint32_t>(mesh.tangent_list.size());
+                mesh_header.texture_coord_count = static_cast<std::uint32_t>(mesh.texture_coord_list.size());
+                mesh_header.index_count = static_cast<std::uint32_t>(mesh.index_list.size());
+                mesh_header.position_offset = writer.append(std::span<const math::Vector3f>{mesh.position_list});
+                mesh_header.normal_offset = writer.append(std::span<const math::Vector3f>{mesh.normal_list});
+                mesh_header.tangent_offset = writer.append(std::span<const math::Vector4f>{mesh.tangent_list});
+                mesh_header.texture_coord_offset = writer.append(std::span<const math::Vector2f>{mesh.texture_coord_list});
+                mesh_header.index_offset = writer.append(std::span<const std::uint32_t>{mesh.index_list});
+                mesh_header.bounding_volume = mesh.bounding_volume;
+
+                writer.overwrite(
+                    mesh_header_offset + mesh_index * sizeof(XmeshMeshHeader),
+                    mesh_header);
+            }
+
+            // Write next to the target and rename, so a concurrent reader never maps a half-written file.
+            auto temporary_path = path;
+            temporary_path += ".tmp";
+            {
+                auto file = std::ofstream{
+                    temporary_path,
+                    std::ios::binary | std::ios::trunc
+                };
+                XAR_THROW_IF(
+                    !file.is_open(),
+                    error::XarException,
+                    "Failed to open file '{}' for writing",
+                    temporary_path.string());
+
+                file.write(
+                    writer.get_bytes().data(),
+                    static_cast<std::streamsize>(writer.get_bytes().size()));
+                XAR_THROW_IF(
+                    !file.good(),
+                    error::XarException,
+                    "Failed to write file '{}'",
+                    temporary_path.string());
+            }
+
+            std::filesystem::rename(
+                temporary_path,
+                path);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <xar_engine/asset/model_loader.hpp>
+
+
+namespace xar_engine::asset
+{
+    class XmeshModelLoader
+        : public IModelLoader
+    {
+    public:
+        [[nodiscard]]
+        Model load_model_from_file(const std::filesystem::path& path) const override;
+    };
+
+
+    namespace xmesh
+    {
+        inline constexpr auto FILE_EXTENSION = ".xmesh";
+
+        // Views into the stream bytes of one mesh, they point into the file bytes passed to read_model_layout.
+        struct XmeshMeshLayout
+        {
+            std::uint32_t position_count;
+            std::uint32_t normal_count;
+            std::uint32_t tangent_count;
+            std::uint32_t texture_coord_count;
+            std::uint32_t index_count;
+
+            std::span<const std::uint8_t> position_bytes;
+            std::span<const std::uint8_t> normal_bytes;
+            std::span<const std::uint8_t> tangent_bytes;
+            std::span<const std::uint8_t> texture_coord_bytes;
+            std::span<const std::uint8_t> index_bytes;
+
+            BoundingVolume bounding_volume;
+        };
+
+        struct XmeshModelLayout
+        {
+            std::string name;
+            std::vector<XmeshMeshLayout> mesh_layout_list;
+            // Decoded copy, node records are small compared to the mesh streams.
+            ModelNodeList node_list;
+
+            BoundingVolume bounding_volume;
+        };
+
+        // Validates the file and locates every stream without copying it.
+        [[nodiscard]]
+        XmeshModelLayout read_model_layout(
+            std::span<const std::uint8_t> file_bytes,
+            const std::filesystem::path& path);
+
+        void write_model_to_file(
+            const Model& model,
+            const std::filesystem::path& path);
+    }
+}
@@ -0,0 +1,152 @@
+#include <xar_engine/asset/xtex_image_file.hpp>
+
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::asset
+{
+    namespace
+    {
+        static_assert(std::endian::native == std::endian::little);
+
+        constexpr auto XTEX_MAGIC = std::uint32_t{0x58455458}; // "XTEX"
+        constexpr auto XTEX_VERSION = std::uint32_t{1};
+
+        struct XtexFileHeader
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t pixel_format;
+            std::uint32_t pixel_width;
+            std::uint32_t pixel_height;
+            std::uint32_t mip_level_count;
+            std::uint64_t pixel_byte_size;
+        };
+
+        // Pixel data starts at a 16-byte aligned offset right after the header.
+        constexpr auto XTEX_PIXEL_OFFSET = (sizeof(XtexFileHeader) + 15) & ~std::size_t{15};
+    }
+
+    Image XtexImageDecoder::decode_image(std::span<const std::uint8_t> file_bytes) const
+    {
+        auto image_layout = xtex::read_image_layout(file_bytes);
+
+        const auto pixel_bytes = file_bytes.subspan(
+            image_layout.pixel_byte_offset,
+            image::get_byte_size(image_layout.image));
+        image_layout.image.bytes.assign(
+            pixel_bytes.begin(),
+            pixel_bytes.end());
+
+        return std::move(image_layout.image);
+    }
+
+
+    namespace xtex
+    {
+        XtexImageLayout read_image_layout(std::span<const std::uint8_t> file_bytes)
+        {
+            XAR_THROW_IF(
+                file_bytes.size() < XTEX_PIXEL_OFFSET,
+                error::XarException,
+                "Xtex image is truncated");
+
+            auto file_header = XtexFileHeader{};
+            std::memcpy(
+                &file_header,
+                file_bytes.data(),
+                sizeof(XtexFileHeader));
+
+            XAR_THROW_IF(
+                file_header.magic != XTEX_MAGIC,
+                error::XarException,
+                "Image is not an xtex image");
+            XAR_THROW_IF(
+                file_header.version != XTEX_VERSION,
+                error::XarException,
+                "Xtex image has version {} but version {} is required",
+                file_header.version,
+                XTEX_VERSION);
+            XAR_THROW_IF(
+                file_header.pixel_format > static_cast<std::uint32_t>(EPixelFormat::R16G16B16A16_FLOAT),
+                error::XarException,
+                "Xtex image has unknown pixel format {}",
+                file_header.pixel_format);
+
+            auto image_layout = XtexImageLayout{
+                {},
+                XTEX_PIXEL_OFFSET
+            };
+            auto& image = image_layout.image;
+            image.pixel_format = static_cast<EPixelFormat>(file_header.pixel_format);
+            image.channel_count = image::get_channel_count(image.pixel_format);
+            image.pixel_width = file_header.pixel_width;
+            image.pixel_height = file_header.pixel_height;
+            image.mip_level_count = file_header.mip_level_count;
+
+            XAR_THROW_IF(
+                file_header.pixel_byte_size != image::get_byte_size(image) ||
+                file_bytes.size() - XTEX_PIXEL_OFFSET < file_header.pixel_byte_size,
+                error::XarException,
+                "Xtex image pixel data is truncated");
+
+            return image_layout;
+        }
+
+        void write_image_to_file(
+            const Image& image,
+            const std::filesystem::path& path)
+        {
+            const auto file_header = XtexFileHeader{
+                XTEX_MAGIC,
+                XTEX_VERSION,
+                static_cast<std::uint32_t>(image.pixel_format),
+                image.pixel_width,
+                image.pixel_height,
+                image.mip_level_count,
+                image.bytes.size(),
+            };
+
+            auto header_bytes = std::array<char, XTEX_PIXEL_OFFSET>{};
+            std::memcpy(
+                header_bytes.data(),
+                &file_header,
+                sizeof(XtexFileHeader));
+
+            auto temporary_path = path;
+            temporary_path += ".tmp";
+            {
+                auto file = std::ofstream{
+                    temporary_path,
+                    std::ios::binary | std::ios::trunc
+                };
+                XAR_THROW_IF(
+                    !file.is_open(),
+                    error::XarException,
+                    "Failed to open file '{}' for writing",
+                    temporary_path.string());
+
+                file.write(
+                    header_bytes.data(),
+                    static_cast<std::streamsize>(header_bytes.size()));
+                file.write(
+                    reinterpret_cast<const char*>(image.bytes.data()),
+                    static_cast<std::streamsize>(image.bytes.size()));
+                XAR_THROW_IF(
+                    !file.good(),
+                    error::XarException,
+                    "Failed to write file '{}'",
+                    temporary_path.string());
+            }
+
+            std::filesystem::rename(
+                temporary_path,
+                path);
+        }
+    }
+}
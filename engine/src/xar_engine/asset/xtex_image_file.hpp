@@ -0,0 +1,38 @@
+#pragma once
+
+#include <filesystem>
+
+#include <xar_engine/asset/image_decoder.hpp>
+
+
+namespace xar_engine::asset
+{
+    class XtexImageDecoder
+        : public IImageDecoder
+    {
+    public:
+        [[nodiscard]]
+        Image decode_image(std::span<const std::uint8_t> file_bytes) const override;
+    };
+
+
+    namespace xtex
+    {
+        inline constexpr auto FILE_EXTENSION = ".xtex";
+
+        struct XtexImageLayout
+        {
+            // Image description with empty bytes, the pixels stay in the file.
+            Image image;
+            std::uint64_t pixel_byte_offset;
+        };
+
+        // Validates the header and locates the pixel data in the complete file bytes.
+        [[nodiscard]]
+        XtexImageLayout read_image_layout(std::span<const std::uint8_t> file_bytes);
+
+        void write_image_to_file(
+            const Image& image,
+            const std::filesystem::path& path);
+    }
+}
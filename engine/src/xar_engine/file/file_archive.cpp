@@ -0,0 +1,36 @@
+#include <xar_engine/file/file_archive.hpp>
+
+#include <xar_engine/file/memory_mapped_file.hpp>
+
+
+namespace xar_engine::file
+{
+    IFileArchive::~IFileArchive() = default;
+
+
+    DirectoryFileArchive::DirectoryFileArchive(std::filesystem::path root_directory)
+        : _root_directory(std::move(root_directory))
+    {
+    }
+
+    bool DirectoryFileArchive::contains(const std::string& virtual_path) const
+    {
+        return std::filesystem::is_regular_file(_root_directory / virtual_path);
+    }
+
+    std::vector<std::uint8_t> DirectoryFileArchive::read_file(const std::string& virtual_path) const
+    {
+        const auto memory_mapped_file = MemoryMappedFile{_root_directory / virtual_path};
+        const auto bytes = memory_mapped_file.get_bytes();
+
+        return {
+            bytes.begin(),
+            bytes.end()
+        };
+    }
+
+    std::optional<std::span<const std::uint8_t>> DirectoryFileArchive::get_file_view(const std::string& virtual_path) const
+    {
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+
+namespace xar_engine::file
+{
+    class IFileArchive
+    {
+    public:
+        virtual ~IFileArchive();
+
+        [[nodiscard]]
+        virtual bool contains(const std::string& virtual_path) const = 0;
+
+        [[nodiscard]]
+        virtual std::vector<std::uint8_t> read_file(const std::string& virtual_path) const = 0;
+
+        // Returns the stored bytes without copying when the archive keeps the file mapped and uncompressed.
+        [[nodiscard]]
+        virtual std::optional<std::span<const std::uint8_t>> get_file_view(const std::string& virtual_path) const = 0;
+    };
+
+
+    // Loose files below a root directory, used during development before assets are packed.
+    class DirectoryFileArchive
+        : public IFileArchive
+    {
+    public:
+        explicit DirectoryFileArchive(std::filesystem::path root_directory);
+
+
+        [[nodiscard]]
+        bool contains(const std::string& virtual_path) const override;
+
+        [[nodiscard]]
+        std::vector<std::uint8_t> read_file(const std::string& virtual_path) const override;
+
+        [[nodiscard]]
+        std::optional<std::span<const std::uint8_t>> get_file_view(const std::string& virtual_path) const override;
+
+    private:
+        std::filesystem::path _root_directory;
+    };
+}
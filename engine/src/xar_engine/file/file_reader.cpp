@@ -0,0 +1,138 @@
+#include <xar_engine/file/file_reader.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/file/io_uring_file_reader.hpp>
+
+
+namespace xar_engine::file
+{
+    namespace
+    {
+        constexpr auto MAX_FALLBACK_WORKER_COUNT = std::uint32_t{4};
+
+        std::uint64_t read_file(const FileReadRequest& request)
+        {
+            auto file = std::ifstream{
+                request.path,
+                std::ios::binary
+            };
+            XAR_THROW_IF(
+                !file.is_open(),
+                error::XarException,
+                "Failed to open file {}",
+                request.path.string());
+
+            file.seekg(static_cast<std::streamoff>(request.file_offset));
+            file.read(
+                reinterpret_cast<char*>(request.buffer.data()),
+                static_cast<std::streamsize>(request.buffer.size()));
+            XAR_THROW_IF(
+                file.bad(),
+                error::XarException,
+                "Failed to read file {}",
+                request.path.string());
+
+            return static_cast<std::uint64_t>(file.gcount());
+        }
+    }
+
+
+    IFileReader::~IFileReader() = default;
+
+
+    ThreadPoolFileReader::ThreadPoolFileReader(std::uint32_t worker_count)
+        : _worker_count(worker_count)
+        , _thread_pool(nullptr)
+    {
+    }
+
+    std::vector<std::uint64_t> ThreadPoolFileReader::read_files(std::span<const FileReadRequest> request_list)
+    {
+        auto read_byte_count_list = std::vector<std::uint64_t>(request_list.size());
+        if (request_list.size() == 1)
+        {
+            read_byte_count_list[0] = read_file(request_list[0]);
+            return read_byte_count_list;
+        }
+
+        auto* thread_pool = static_cast<thread::ThreadPool*>(nullptr);
+        {
+            auto lock = std::lock_guard{_mutex};
+            if (_thread_pool == nullptr)
+            {
+                _thread_pool = std::make_unique<thread::ThreadPool>(_worker_count);
+            }
+            thread_pool = _thread_pool.get();
+        }
+
+        thread_pool->parallel_for(
+            request_list.size(),
+            [&request_list, &read_byte_count_list](std::size_t request_index)
+            {
+                read_byte_count_list[request_index] = read_file(request_list[request_index]);
+            });
+
+        return read_byte_count_list;
+    }
+
+
+    std::unique_ptr<IFileReader> FileReaderFactory::make() const
+    {
+#ifdef XAR_ENGINE_HAS_IO_URING
+        try
+        {
+            return std::make_unique<IoUringFileReader>();
+        }
+        catch (const error::XarException&)
+        {
+            // io_uring is missing or blocked on this kernel, fall back to plain reads.
+        }
+#endif
+
+        return std::make_unique<ThreadPoolFileReader>(
+            std::min(
+                thread::ThreadPool::get_default_worker_count(),
+                MAX_FALLBACK_WORKER_COUNT));
+    }
+
+
+    std::vector<std::vector<std::uint8_t>> read_whole_file_list(
+        IFileReader& file_reader,
+        const std::vector<std::filesystem::path>& path_list)
+    {
+        auto file_bytes_list = std::vector<std::vector<std::uint8_t>>(path_list.size());
+        auto request_list = std::vector<FileReadRequest>(path_list.size());
+        for (auto file_index = std::size_t{0}; file_index < path_list.size(); ++file_index)
+        {
+            auto error_code = std::error_code{};
+            const auto file_byte_size = std::filesystem::file_size(
+                path_list[file_index],
+                error_code);
+            XAR_THROW_IF(
+                error_code,
+                error::XarException,
+                "Failed to read file {}: {}",
+                path_list[file_index].string(),
+                error_code.message());
+
+            file_bytes_list[file_index].resize(file_byte_size);
+            request_list[file_index] = {
+                path_list[file_index],
+                0,
+                file_bytes_list[file_index]
+            };
+        }
+
+        const auto read_byte_count_list = file_reader.read_files(request_list);
+        for (auto file_index = std::size_t{0}; file_index < path_list.size(); ++file_index)
+        {
+            file_bytes_list[file_index].resize(read_byte_count_list[file_index]);
+        }
+
+        return file_bytes_list;
+    }
+}
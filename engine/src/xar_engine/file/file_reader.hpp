@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_engine::file
+{
+    struct FileReadRequest
+    {
+        std::filesystem::path path;
+        std::uint64_t file_offset;
+        std::span<std::uint8_t> buffer;
+    };
+
+    class IFileReader
+    {
+    public:
+        virtual ~IFileReader();
+
+        // Reads every request into its buffer and blocks until the whole batch completed. Returns the number
+        // of bytes read per request, which is only smaller than the buffer when the file ends first.
+        virtual std::vector<std::uint64_t> read_files(std::span<const FileReadRequest> request_list) = 0;
+    };
+
+
+    // Portable reader that spreads a batch over worker threads. The pool is only created for batches
+    // with more than one request.
+    class ThreadPoolFileReader
+        : public IFileReader
+    {
+    public:
+        explicit ThreadPoolFileReader(std::uint32_t worker_count);
+
+
+        std::vector<std::uint64_t> read_files(std::span<const FileReadRequest> request_list) override;
+
+    private:
+        std::uint32_t _worker_count;
+
+        std::mutex _mutex;
+        std::unique_ptr<thread::ThreadPool> _thread_pool;
+    };
+
+
+    class FileReaderFactory
+    {
+    public:
+        // Prefers io_uring where the platform and kernel support it.
+        [[nodiscard]]
+        std::unique_ptr<IFileReader> make() const;
+    };
+
+
+    [[nodiscard]]
+    std::vector<std::vector<std::uint8_t>> read_whole_file_list(
+        IFileReader& file_reader,
+        const std::vector<std::filesystem::path>& path_list);
+}
@@ -0,0 +1,505 @@
+#include <xar_engine/file/io_uring_file_reader.hpp>
+
+#ifdef XAR_ENGINE_HAS_IO_URING
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <fmt/core.h>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::file
+{
+    namespace
+    {
+        constexpr auto QUEUE_DEPTH = std::uint32_t{64};
+        constexpr auto MAX_READ_BYTE_SIZE = std::uint64_t{1} << 30;
+
+        struct ReadOperation
+        {
+            std::size_t request_index;
+            int file_descriptor;
+            std::uint64_t read_byte_count;
+        };
+
+        class FileDescriptorList
+        {
+        public:
+            explicit FileDescriptorList(std::size_t count)
+                : _file_descriptor_list(count, -1)
+            {
+            }
+
+            ~FileDescriptorList()
+            {
+                for (const auto file_descriptor: _file_descriptor_list)
+                {
+                    if (file_descriptor >= 0)
+                    {
+                        ::close(file_descriptor);
+                    }
+                }
+            }
+
+            int& operator[](std::size_t index)
+            {
+                return _file_descriptor_list[index];
+            }
+
+        private:
+            std::vector<int> _file_descriptor_list;
+        };
+
+        std::uint32_t load_acquire(const std::uint32_t* value)
+        {
+            return std::atomic_ref<const std::uint32_t>{*value}.load(std::memory_order_acquire);
+        }
+
+        void store_release(
+            std::uint32_t* target,
+            std::uint32_t value)
+        {
+            std::atomic_ref<std::uint32_t>{*target}.store(
+                value,
+                std::memory_order_release);
+        }
+
+        void* map_ring(
+            int ring_file_descriptor,
+            std::size_t byte_size,
+            off_t offset)
+        {
+            auto* const address = ::mmap(
+                nullptr,
+                byte_size,
+                PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE,
+                ring_file_descriptor,
+                offset);
+            XAR_THROW_IF(
+                address == MAP_FAILED,
+                error::XarException,
+                "Failed to map io_uring ring: {}",
+                std::strerror(errno));
+
+            return address;
+        }
+    }
+
+    struct IoUringFileReader::State
+    {
+    public:
+        State();
+
+        ~State();
+
+
+        void release();
+
+        void submit_read(
+            const FileReadRequest& request,
+            const ReadOperation& read_operation,
+            std::uint64_t user_data);
+
+        void enter(
+            std::uint32_t submit_count,
+            std::uint32_t min_complete_count) const;
+
+        void drain(std::uint32_t in_flight_count);
+
+    public:
+        int ring_file_descriptor;
+
+        void* sq_ring_address;
+        std::size_t sq_ring_byte_size;
+        void* cq_ring_address;
+        std::size_t cq_ring_byte_size;
+        io_uring_sqe* sqe_list;
+        std::size_t sqe_list_byte_size;
+
+        const std::uint32_t* sq_head;
+        std::uint32_t* sq_tail;
+        std::uint32_t sq_ring_mask;
+        std::uint32_t* sq_array;
+        std::uint32_t sq_entry_count;
+
+        std::uint32_t* cq_head;
+        const std::uint32_t* cq_tail;
+        std::uint32_t cq_ring_mask;
+        const io_uring_cqe* cqe_list;
+
+        std::mutex mutex;
+    };
+
+    IoUringFileReader::State::State()
+        : ring_file_descriptor(-1)
+        , sq_ring_address(MAP_FAILED)
+        , sq_ring_byte_size(0)
+        , cq_ring_address(MAP_FAILED)
+        , cq_ring_byte_size(0)
+        , sqe_list(static_cast<io_uring_sqe*>(MAP_FAILED))
+        , sqe_list_byte_size(0)
+        , sq_head(nullptr)
+        , sq_tail(nullptr)
+        , sq_ring_mask(0)
+        , sq_array(nullptr)
+        , sq_entry_count(0)
+        , cq_head(nullptr)
+        , cq_tail(nullptr)
+        , cq_ring_mask(0)
+        , cqe_list(nullptr)
+    {
+        auto io_uring_parameters = io_uring_params{};
+        ring_file_descriptor = static_cast<int>(::syscall(
+            __NR_io_uring_setup,
+            QUEUE_DEPTH,
+            &io_uring_parameters));
+        XAR_THROW_IF(
+            ring_file_descriptor < 0,
+            error::XarException,
+            "io_uring_setup failed: {}",
+            std::strerror(errno));
+
+        // IORING_OP_READ arrived in the same kernel release as this feature flag.
+        if ((io_uring_parameters.features & IORING_FEAT_RW_CUR_POS) == 0)
+        {
+            release();
+            XAR_THROW(
+                error::XarException,
+                "io_uring does not support IORING_OP_READ on this kernel");
+        }
+
+        sq_ring_byte_size = io_uring_parameters.sq_off.array + io_uring_parameters.sq_entries * sizeof(std::uint32_t);
+        cq_ring_byte_size = io_uring_parameters.cq_off.cqes + io_uring_parameters.cq_entries * sizeof(io_uring_cqe);
+        sqe_list_byte_size = io_uring_parameters.sq_entries * sizeof(io_uring_sqe);
+
+        try
+        {
+            const auto single_mmap = (io_uring_parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (single_mmap)
+            {
+                sq_ring_byte_size = std::max(
+                    sq_ring_byte_size,
+                    cq_ring_byte_size);
+            }
+
+            sq_ring_address = map_ring(
+                ring_file_descriptor,
+                sq_ring_byte_size,
+                IORING_OFF_SQ_RING);
+            cq_ring_address = single_mmap
+                              ? sq_ring_address
+                              : map_ring(
+                                  ring_file_descriptor,
+                                  cq_ring_byte_size,
+                                  IORING_OFF_CQ_RING);
+            sqe_list = static_cast<io_uring_sqe*>(map_ring(
+                ring_file_descriptor,
+                sqe_list_byte_size,
+                IORING_OFF_SQES));
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+
+        auto* const sq_ring_bytes = static_cast<std::uint8_t*>(sq_ring_address);
+        sq_head = reinterpret_cast<const std::uint32_t*>(sq_ring_bytes + io_uring_parameters.sq_off.head);
+        sq_tail = reinterpret_cast<std::uint32_t*>(sq_ring_bytes + io_uring_parameters.sq_off.tail);
+        sq_ring_mask = *reinterpret_cast<const std::uint32_t*>(sq_ring_bytes + io_uring_parameters.sq_off.ring_mask);
+        sq_array = reinterpret_cast<std::uint32_t*>(sq_ring_bytes + io_uring_parameters.sq_off.array);
+        sq_entry_count = io_uring_parameters.sq_entries;
+
+        auto* const cq_ring_bytes = static_cast<std::uint8_t*>(cq_ring_address);
+        cq_head = reinterpret_cast<std::uint32_t*>(cq_ring_bytes + io_uring_parameters.cq_off.head);
+        cq_tail = reinterpret_cast<const std::uint32_t*>(cq_ring_bytes + io_uring_parameters.cq_off.tail);
+        cq_ring_mask = *reinterpret_cast<const std::uint32_t*>(cq_ring_bytes + io_uring_parameters.cq_off.ring_mask);
+        cqe_list = reinterpret_cast<const io_uring_cqe*>(cq_ring_bytes + io_uring_parameters.cq_off.cqes);
+    }
+
+    IoUringFileReader::State::~State()
+    {
+        release();
+    }
+
+    void IoUringFileReader::State::release()
+    {
+        if (sqe_list != MAP_FAILED)
+        {
+            ::munmap(
+                sqe_list,
+                sqe_list_byte_size);
+        }
+        if (cq_ring_address != MAP_FAILED && cq_ring_address != sq_ring_address)
+        {
+            ::munmap(
+                cq_ring_address,
+                cq_ring_byte_size);
+        }
+        if (sq_ring_address != MAP_FAILED)
+        {
+            ::munmap(
+                sq_ring_address,
+                sq_ring_byte_size);
+        }
+        if (ring_file_descriptor >= 0)
+        {
+            ::close(ring_file_descriptor);
+        }
+
+        sqe_list = static_cast<io_uring_sqe*>(MAP_FAILED);
+        cq_ring_address = MAP_FAILED;
+        sq_ring_address = MAP_FAILED;
+        ring_file_descriptor = -1;
+    }
+
+    void IoUringFileReader::State::submit_read(
+        const FileReadRequest& request,
+        const ReadOperation& read_operation,
+        std::uint64_t user_data)
+    {
+        // Only this thread produces submissions, so the tail needs no acquire.
+        const auto tail = *sq_tail;
+        const auto sqe_index = tail & sq_ring_mask;
+
+        auto& sqe = sqe_list[sqe_index];
+        std::memset(
+            &sqe,
+            0,
+            sizeof(sqe));
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = read_operation.file_descriptor;
+        sqe.addr = reinterpret_cast<std::uint64_t>(request.buffer.data() + read_operation.read_byte_count);
+        sqe.len = static_cast<std::uint32_t>(std::min(
+            request.buffer.size() - read_operation.read_byte_count,
+            MAX_READ_BYTE_SIZE));
+        sqe.off = request.file_offset + read_operation.read_byte_count;
+        sqe.user_data = user_data;
+
+        sq_array[sqe_index] = sqe_index;
+        store_release(
+            sq_tail,
+            tail + 1);
+    }
+
+    void IoUringFileReader::State::enter(
+        std::uint32_t submit_count,
+        std::uint32_t min_complete_count) const
+    {
+        while (true)
+        {
+            const auto result = ::syscall(
+                __NR_io_uring_enter,
+                ring_file_descriptor,
+                submit_count,
+                min_complete_count,
+                IORING_ENTER_GETEVENTS,
+                nullptr,
+                0);
+            if (result >= 0)
+            {
+                XAR_THROW_IF(
+                    static_cast<std::uint32_t>(result) != submit_count,
+                    error::XarException,
+                    "io_uring_enter submitted {} of {} reads",
+                    result,
+                    submit_count);
+                return;
+            }
+
+            XAR_THROW_IF(
+                errno != EINTR,
+                error::XarException,
+                "io_uring_enter failed: {}",
+                std::strerror(errno));
+        }
+    }
+
+    // Leaves the ring empty after a failed enter. Reads the kernel already took still write into the caller's
+    // buffers, so this only returns once all of them completed. Submissions the kernel never consumed are
+    // taken back, which is safe because without SQPOLL the kernel only reads the queue inside io_uring_enter.
+    void IoUringFileReader::State::drain(std::uint32_t in_flight_count)
+    {
+        const auto kernel_sq_head = load_acquire(sq_head);
+        in_flight_count -= *sq_tail - kernel_sq_head;
+        store_release(
+            sq_tail,
+            kernel_sq_head);
+
+        auto head = *cq_head;
+        while (in_flight_count > 0)
+        {
+            const auto tail = load_acquire(cq_tail);
+            if (head == tail)
+            {
+                const auto result = ::syscall(
+                    __NR_io_uring_enter,
+                    ring_file_descriptor,
+                    0,
+                    1,
+                    IORING_ENTER_GETEVENTS,
+                    nullptr,
+                    0);
+                if (result < 0 && errno != EINTR)
+                {
+                    // The completions still arrive without waiting in the kernel, only more slowly.
+                    ::sched_yield();
+                }
+                continue;
+            }
+
+            in_flight_count -= tail - head;
+            head = tail;
+            store_release(
+                cq_head,
+                head);
+        }
+    }
+
+
+    IoUringFileReader::IoUringFileReader()
+        : _state(std::make_unique<State>())
+    {
+    }
+
+    IoUringFileReader::~IoUringFileReader() = default;
+
+    std::vector<std::uint64_t> IoUringFileReader::read_files(std::span<const FileReadRequest> request_list)
+    {
+        auto read_byte_count_list = std::vector<std::uint64_t>(request_list.size());
+
+        auto file_descriptor_list = FileDescriptorList{request_list.size()};
+        auto read_operation_list = std::vector<ReadOperation>{};
+        read_operation_list.reserve(request_list.size());
+        for (auto request_index = std::size_t{0}; request_index < request_list.size(); ++request_index)
+        {
+            file_descriptor_list[request_index] = ::open(
+                request_list[request_index].path.c_str(),
+                O_RDONLY | O_CLOEXEC);
+            XAR_THROW_IF(
+                file_descriptor_list[request_index] < 0,
+                error::XarException,
+                "Failed to open file {}: {}",
+                request_list[request_index].path.string(),
+                std::strerror(errno));
+
+            if (!request_list[request_index].buffer.empty())
+            {
+                read_operation_list.push_back(
+                    {
+                        request_index,
+                        file_descriptor_list[request_index],
+                        0
+                    });
+            }
+        }
+
+        auto lock = std::lock_guard{_state->mutex};
+
+        // Operations waiting for a submission slot, short reads are queued again for the remainder.
+        auto pending_operation_index_list = std::deque<std::size_t>(read_operation_list.size());
+        for (auto operation_index = std::size_t{0}; operation_index < read_operation_list.size(); ++operation_index)
+        {
+            pending_operation_index_list[operation_index] = operation_index;
+        }
+
+        auto in_flight_count = std::uint32_t{0};
+        auto first_error = std::string{};
+        while (in_flight_count > 0 || (!pending_operation_index_list.empty() && first_error.empty()))
+        {
+            auto submit_count = std::uint32_t{0};
+            while (in_flight_count < _state->sq_entry_count && !pending_operation_index_list.empty() && first_error.empty())
+            {
+                const auto operation_index = pending_operation_index_list.front();
+                pending_operation_index_list.pop_front();
+
+                const auto& read_operation = read_operation_list[operation_index];
+                _state->submit_read(
+                    request_list[read_operation.request_index],
+                    read_operation,
+                    operation_index);
+
+                ++submit_count;
+                ++in_flight_count;
+            }
+
+            try
+            {
+                _state->enter(
+                    submit_count,
+                    1);
+            }
+            catch (...)
+            {
+                _state->drain(in_flight_count);
+                throw;
+            }
+
+            auto head = *_state->cq_head;
+            const auto tail = load_acquire(_state->cq_tail);
+            for (; head != tail; ++head)
+            {
+                const auto& cqe = _state->cqe_list[head & _state->cq_ring_mask];
+                auto& read_operation = read_operation_list[cqe.user_data];
+                const auto& request = request_list[read_operation.request_index];
+                --in_flight_count;
+
+                if (cqe.res == -EINTR || cqe.res == -EAGAIN)
+                {
+                    pending_operation_index_list.push_back(cqe.user_data);
+                }
+                else if (cqe.res < 0)
+                {
+                    if (first_error.empty())
+                    {
+                        first_error = fmt::format(
+                            "Failed to read file {}: {}",
+                            request.path.string(),
+                            std::strerror(-cqe.res));
+                    }
+                }
+                else if (cqe.res > 0)
+                {
+                    read_operation.read_byte_count += static_cast<std::uint64_t>(cqe.res);
+                    if (read_operation.read_byte_count < request.buffer.size())
+                    {
+                        pending_operation_index_list.push_back(cqe.user_data);
+                    }
+                }
+            }
+            store_release(
+                _state->cq_head,
+                head);
+        }
+
+        XAR_THROW_IF(
+            !first_error.empty(),
+            error::XarException,
+            "{}",
+            first_error);
+
+        for (const auto& read_operation: read_operation_list)
+        {
+            read_byte_count_list[read_operation.request_index] = read_operation.read_byte_count;
+        }
+
+        return read_byte_count_list;
+    }
+}
+
+#endif
@@ -0,0 +1,37 @@
+#pragma once
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define XAR_ENGINE_HAS_IO_URING
+#endif
+
+#ifdef XAR_ENGINE_HAS_IO_URING
+
+#include <memory>
+
+#include <xar_engine/file/file_reader.hpp>
+
+
+namespace xar_engine::file
+{
+    // Submits a whole batch of reads through one io_uring ring, talking to the kernel directly so no
+    // liburing is needed. Construction throws when the kernel does not support io_uring reads.
+    class IoUringFileReader
+        : public IFileReader
+    {
+    public:
+        IoUringFileReader();
+
+        ~IoUringFileReader() override;
+
+
+        std::vector<std::uint64_t> read_files(std::span<const FileReadRequest> request_list) override;
+
+    private:
+        struct State;
+
+    private:
+        std::unique_ptr<State> _state;
+    };
+}
+
+#endif
@@ -0,0 +1,204 @@
+#include <xar_engine/file/memory_mapped_file.hpp>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::file
+{
+    struct MemoryMappedFile::State
+    {
+    public:
+        explicit State(const std::filesystem::path& filepath);
+
+        ~State();
+
+    public:
+        const std::uint8_t* data;
+        std::size_t byte_size;
+
+#ifdef _WIN32
+        HANDLE file_handle;
+        HANDLE file_mapping_handle;
+#endif
+    };
+
+#ifdef _WIN32
+    MemoryMappedFile::State::State(const std::filesystem::path& filepath)
+        : data(nullptr)
+        , byte_size(0)
+        , file_handle(INVALID_HANDLE_VALUE)
+        , file_mapping_handle(nullptr)
+    {
+        file_handle = CreateFileW(
+            filepath.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+            nullptr);
+        XAR_THROW_IF(
+            file_handle == INVALID_HANDLE_VALUE,
+            error::XarException,
+            "Failed to open file {}",
+            filepath.string());
+
+        auto file_byte_size = LARGE_INTEGER{};
+        if (!GetFileSizeEx(
+            file_handle,
+            &file_byte_size))
+        {
+            CloseHandle(file_handle);
+            XAR_THROW(
+                error::XarException,
+                "Failed to stat file {}",
+                filepath.string());
+        }
+
+        byte_size = static_cast<std::size_t>(file_byte_size.QuadPart);
+        if (byte_size == 0)
+        {
+            return;
+        }
+
+        file_mapping_handle = CreateFileMappingW(
+            file_handle,
+            nullptr,
+            PAGE_READONLY,
+            0,
+            0,
+            nullptr);
+        if (file_mapping_handle == nullptr)
+        {
+            CloseHandle(file_handle);
+            XAR_THROW(
+                error::XarException,
+                "Failed to map file {}",
+                filepath.string());
+        }
+
+        data = static_cast<const std::uint8_t*>(
+            MapViewOfFile(
+                file_mapping_handle,
+                FILE_MAP_READ,
+                0,
+                0,
+                0));
+        if (data == nullptr)
+        {
+            CloseHandle(file_mapping_handle);
+            CloseHandle(file_handle);
+            XAR_THROW(
+                error::XarException,
+                "Failed to map view of file {}",
+                filepath.string());
+        }
+    }
+
+    MemoryMappedFile::State::~State()
+    {
+        if (data != nullptr)
+        {
+            UnmapViewOfFile(data);
+        }
+        if (file_mapping_handle != nullptr)
+        {
+            CloseHandle(file_mapping_handle);
+        }
+        if (file_handle != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file_handle);
+        }
+    }
+#else
+    MemoryMappedFile::State::State(const std::filesystem::path& filepath)
+        : data(nullptr)
+        , byte_size(0)
+    {
+        const auto file_descriptor = open(
+            filepath.c_str(),
+            O_RDONLY);
+        XAR_THROW_IF(
+            file_descriptor == -1,
+            error::XarException,
+            "Failed to open file {}",
+            filepath.string());
+
+        struct stat file_stat = {};
+        if (fstat(file_descriptor, &file_stat) == -1)
+        {
+            close(file_descriptor);
+            XAR_THROW(
+                error::XarException,
+                "Failed to stat file {}",
+                filepath.string());
+        }
+
+        byte_size = static_cast<std::size_t>(file_stat.st_size);
+        if (byte_size != 0)
+        {
+            auto* const mapped_data = mmap(
+                nullptr,
+                byte_size,
+                PROT_READ,
+                MAP_PRIVATE,
+                file_descriptor,
+                0);
+            if (mapped_data != MAP_FAILED)
+            {
+                data = static_cast<const std::uint8_t*>(mapped_data);
+            }
+        }
+
+        close(file_descriptor);
+
+        XAR_THROW_IF(
+            byte_size != 0 && data == nullptr,
+            error::XarException,
+            "Failed to map file {}",
+            filepath.string());
+    }
+
+    MemoryMappedFile::State::~State()
+    {
+        if (data != nullptr)
+        {
+            munmap(
+                const_cast<std::uint8_t*>(data),
+                byte_size);
+        }
+    }
+#endif
+
+
+    MemoryMappedFile::MemoryMappedFile()
+        : _state(nullptr)
+    {
+    }
+
+    MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& filepath)
+        : _state(std::make_shared<State>(filepath))
+    {
+    }
+
+    MemoryMappedFile::~MemoryMappedFile() = default;
+
+    std::span<const std::uint8_t> MemoryMappedFile::get_bytes() const
+    {
+        return {
+            _state->data,
+            _state->byte_size
+        };
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+
+namespace xar_engine::file
+{
+    class MemoryMappedFile
+    {
+    public:
+        MemoryMappedFile();
+        explicit MemoryMappedFile(const std::filesystem::path& filepath);
+
+        ~MemoryMappedFile();
+
+
+        [[nodiscard]]
+        std::span<const std::uint8_t> get_bytes() const;
+
+    private:
+        struct State;
+
+    private:
+        std::shared_ptr<State> _state;
+    };
+}
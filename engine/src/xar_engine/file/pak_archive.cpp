@@ -0,0 +1,518 @@
+#include <xar_engine/file/pak_archive.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+#ifdef XAR_ENGINE_WITH_LZ4
+#include <lz4.h>
+#endif
+
+#ifdef XAR_ENGINE_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/file/memory_mapped_file.hpp>
+
+#include <xar_engine/meta/enum_impl.hpp>
+
+
+namespace xar_engine::file
+{
+    namespace
+    {
+        static_assert(std::endian::native == std::endian::little);
+
+        constexpr auto PAK_MAGIC = std::uint32_t{0x4B415058}; // "XPAK"
+        constexpr auto PAK_VERSION = std::uint32_t{1};
+        constexpr auto PAK_ENTRY_ALIGNMENT = std::uint64_t{64};
+
+        struct PakFileHeader
+        {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t entry_count;
+            std::uint32_t reserved;
+            std::uint64_t entry_table_offset;
+            std::uint64_t path_table_offset;
+        };
+
+        struct PakEntry
+        {
+            std::uint64_t path_offset;
+            std::uint32_t path_byte_size;
+            std::uint32_t compression;
+            std::uint64_t data_offset;
+            std::uint64_t stored_byte_size;
+            std::uint64_t byte_size;
+        };
+
+        std::uint64_t align_offset(std::uint64_t offset)
+        {
+            return (offset + PAK_ENTRY_ALIGNMENT - 1) & ~(PAK_ENTRY_ALIGNMENT - 1);
+        }
+
+        std::vector<std::uint8_t> compress(
+            EPakCompression compression,
+            std::span<const std::uint8_t> bytes)
+        {
+            switch (compression)
+            {
+                case EPakCompression::NONE:
+                {
+                    return {
+                        bytes.begin(),
+                        bytes.end()
+                    };
+                }
+#ifdef XAR_ENGINE_WITH_LZ4
+                case EPakCompression::LZ4:
+                {
+                    auto compressed_bytes = std::vector<std::uint8_t>(LZ4_compressBound(static_cast<int>(bytes.size())));
+                    const auto compressed_byte_size = LZ4_compress_default(
+                        reinterpret_cast<const char*>(bytes.data()),
+                        reinterpret_cast<char*>(compressed_bytes.data()),
+                        static_cast<int>(bytes.size()),
+                        static_cast<int>(compressed_bytes.size()));
+                    XAR_THROW_IF(
+                        compressed_byte_size <= 0,
+                        error::XarException,
+                        "LZ4 compression failed");
+
+                    compressed_bytes.resize(compressed_byte_size);
+                    return compressed_bytes;
+                }
+#endif
+#ifdef XAR_ENGINE_WITH_ZSTD
+                case EPakCompression::ZSTD:
+                {
+                    auto compressed_bytes = std::vector<std::uint8_t>(ZSTD_compressBound(bytes.size()));
+                    const auto compressed_byte_size = ZSTD_compress(
+                        compressed_bytes.data(),
+                        compressed_bytes.size(),
+                        bytes.data(),
+                        bytes.size(),
+                        ZSTD_CLEVEL_DEFAULT);
+                    XAR_THROW_IF(
+                        ZSTD_isError(compressed_byte_size),
+                        error::XarException,
+                        "Zstd compression failed: {}",
+                        ZSTD_getErrorName(compressed_byte_size));
+
+                    compressed_bytes.resize(compressed_byte_size);
+                    return compressed_bytes;
+                }
+#endif
+                default:
+                {
+                    XAR_THROW(
+                        error::XarException,
+                        "Pak compression {} is not supported by this build",
+                        meta::enum_to_string(compression));
+                }
+            }
+        }
+
+        void decompress(
+            EPakCompression compression,
+            std::span<const std::uint8_t> stored_bytes,
+            std::span<std::uint8_t> bytes)
+        {
+            switch (compression)
+            {
+                case EPakCompression::NONE:
+                {
+                    XAR_THROW_IF(
+                        stored_bytes.size() != bytes.size(),
+                        error::XarException,
+                        "Uncompressed pak entry has {} bytes but {} are expected",
+                        stored_bytes.size(),
+                        bytes.size());
+
+                    std::ranges::copy(
+                        stored_bytes,
+                        bytes.begin());
+                    return;
+                }
+#ifdef XAR_ENGINE_WITH_LZ4
+                case EPakCompression::LZ4:
+                {
+                    const auto byte_size = LZ4_decompress_safe(
+                        reinterpret_cast<const char*>(stored_bytes.data()),
+                        reinterpret_cast<char*>(bytes.data()),
+                        static_cast<int>(stored_bytes.size()),
+                        static_cast<int>(bytes.size()));
+                    XAR_THROW_IF(
+                        byte_size < 0 || static_cast<std::size_t>(byte_size) != bytes.size(),
+                        error::XarException,
+                        "LZ4 decompression failed");
+                    return;
+                }
+#endif
+#ifdef XAR_ENGINE_WITH_ZSTD
+                case EPakCompression::ZSTD:
+                {
+                    const auto byte_size = ZSTD_decompress(
+                        bytes.data(),
+                        bytes.size(),
+                        stored_bytes.data(),
+                        stored_bytes.size());
+                    XAR_THROW_IF(
+                        ZSTD_isError(byte_size) || byte_size != bytes.size(),
+                        error::XarException,
+                        "Zstd decompression failed");
+                    return;
+                }
+#endif
+                default:
+                {
+                    XAR_THROW(
+                        error::XarException,
+                        "Pak compression {} is not supported by this build",
+                        meta::enum_to_string(compression));
+                }
+            }
+        }
+    }
+
+
+    struct PakFileArchive::State
+    {
+    public:
+        explicit State(const std::filesystem::path& path);
+
+        [[nodiscard]]
+        const PakEntry* find_entry(const std::string& virtual_path) const;
+
+        [[nodiscard]]
+        std::string_view get_virtual_path(const PakEntry& entry) const;
+
+        [[nodiscard]]
+        std::span<const std::uint8_t> get_stored_bytes(const PakEntry& entry) const;
+
+    public:
+        std::filesystem::path path;
+        MemoryMappedFile memory_mapped_file;
+        std::vector<PakEntry> entry_list;
+    };
+
+    PakFileArchive::State::State(const std::filesystem::path& path)
+        : path(path)
+        , memory_mapped_file(path)
+    {
+        const auto bytes = memory_mapped_file.get_bytes();
+
+        auto file_header = PakFileHeader{};
+        XAR_THROW_IF(
+            bytes.size() < sizeof(PakFileHeader),
+            error::XarException,
+            "Pak archive '{}' is truncated",
+            path.string());
+        std::memcpy(
+            &file_header,
+            bytes.data(),
+            sizeof(PakFileHeader));
+
+        XAR_THROW_IF(
+            file_header.magic != PAK_MAGIC,
+            error::XarException,
+            "File '{}' is not a pak archive",
+            path.string());
+        XAR_THROW_IF(
+            file_header.version != PAK_VERSION,
+            error::XarException,
+            "Pak archive '{}' has version {} but version {} is required",
+            path.string(),
+            file_header.version,
+            PAK_VERSION);
+
+        const auto entry_table_byte_size = std::uint64_t{file_header.entry_count} * sizeof(PakEntry);
+        XAR_THROW_IF(
+            file_header.entry_table_offset > bytes.size() || entry_table_byte_size > bytes.size() - file_header.entry_table_offset,
+            error::XarException,
+            "Pak archive '{}' has a truncated table of contents",
+            path.string());
+
+        entry_list.resize(file_header.entry_count);
+        std::memcpy(
+            entry_list.data(),
+            bytes.data() + file_header.entry_table_offset,
+            entry_table_byte_size);
+
+        for (const auto& entry: entry_list)
+        {
+            XAR_THROW_IF(
+                entry.path_offset > bytes.size() || entry.path_byte_size > bytes.size() - entry.path_offset ||
+                entry.data_offset > bytes.size() || entry.stored_byte_size > bytes.size() - entry.data_offset,
+                error::XarException,
+                "Pak archive '{}' has an entry outside of the file",
+                path.string());
+        }
+    }
+
+    const PakEntry* PakFileArchive::State::find_entry(const std::string& virtual_path) const
+    {
+        const auto entry_it = std::ranges::lower_bound(
+            entry_list,
+            std::string_view{virtual_path},
+            std::less{},
+            [this](const PakEntry& entry)
+            {
+                return get_virtual_path(entry);
+            });
+
+        if (entry_it == entry_list.end() || get_virtual_path(*entry_it) != virtual_path)
+        {
+            return nullptr;
+        }
+
+        return &*entry_it;
+    }
+
+    std::string_view PakFileArchive::State::get_virtual_path(const PakEntry& entry) const
+    {
+        return {
+            reinterpret_cast<const char*>(memory_mapped_file.get_bytes().data() + entry.path_offset),
+            entry.path_byte_size
+        };
+    }
+
+    std::span<const std::uint8_t> PakFileArchive::State::get_stored_bytes(const PakEntry& entry) const
+    {
+        return memory_mapped_file.get_bytes().subspan(
+            entry.data_offset,
+            entry.stored_byte_size);
+    }
+
+
+    PakFileArchive::PakFileArchive(const std::filesystem::path& path)
+        : _state(std::make_shared<State>(path))
+    {
+    }
+
+    PakFileArchive::~PakFileArchive() = default;
+
+    bool PakFileArchive::contains(const std::string& virtual_path) const
+    {
+        return _state->find_entry(virtual_path) != nullptr;
+    }
+
+    std::vector<std::uint8_t> PakFileArchive::read_file(const std::string& virtual_path) const
+    {
+        const auto* entry = _state->find_entry(virtual_path);
+        XAR_THROW_IF(
+            entry == nullptr,
+            error::XarException,
+            "Pak archive '{}' does not contain '{}'",
+            _state->path.string(),
+            virtual_path);
+
+        auto bytes = std::vector<std::uint8_t>(entry->byte_size);
+        decompress(
+            static_cast<EPakCompression>(entry->compression),
+            _state->get_stored_bytes(*entry),
+            bytes);
+
+        return bytes;
+    }
+
+    std::optional<std::span<const std::uint8_t>> PakFileArchive::get_file_view(const std::string& virtual_path) const
+    {
+        const auto* entry = _state->find_entry(virtual_path);
+        if (entry == nullptr || static_cast<EPakCompression>(entry->compression) != EPakCompression::NONE)
+        {
+            return std::nullopt;
+        }
+
+        return _state->get_stored_bytes(*entry);
+    }
+
+    std::vector<std::string> PakFileArchive::get_virtual_path_list() const
+    {
+        auto virtual_path_list = std::vector<std::string>{};
+        virtual_path_list.reserve(_state->entry_list.size());
+        for (const auto& entry: _state->entry_list)
+        {
+            virtual_path_list.emplace_back(_state->get_virtual_path(entry));
+        }
+
+        return virtual_path_list;
+    }
+
+
+    void PakArchiveWriter::add_file(
+        std::string virtual_path,
+        std::vector<std::uint8_t> bytes,
+        EPakCompression compression)
+    {
+        _pending_file_list.push_back(
+            {
+                std::move(virtual_path),
+                std::move(bytes),
+                compression
+            });
+    }
+
+    void PakArchiveWriter::write_to_file(
+        const std::filesystem::path& path,
+        thread::ThreadPool& thread_pool) const
+    {
+        auto pending_file_order = std::vector<const PendingFile*>{};
+        for (const auto& pending_file: _pending_file_list)
+        {
+            pending_file_order.push_back(&pending_file);
+        }
+        std::ranges::sort(
+            pending_file_order,
+            std::less{},
+            &PendingFile::virtual_path);
+
+        const auto duplicate_it = std::ranges::adjacent_find(
+            pending_file_order,
+            std::equal_to{},
+            &PendingFile::virtual_path);
+        XAR_THROW_IF(
+            duplicate_it != pending_file_order.end(),
+            error::XarException,
+            "Pak archive '{}' would contain '{}' twice",
+            path.string(),
+            (*duplicate_it)->virtual_path);
+
+        auto stored_bytes_list = std::vector<std::vector<std::uint8_t>>(pending_file_order.size());
+        thread_pool.parallel_for(
+            pending_file_order.size(),
+            [&pending_file_order, &stored_bytes_list](std::size_t file_index)
+            {
+                stored_bytes_list[file_index] = compress(
+                    pending_file_order[file_index]->compression,
+                    pending_file_order[file_index]->bytes);
+            });
+
+        auto entry_list = std::vector<PakEntry>(pending_file_order.size());
+        auto path_table = std::string{};
+        for (auto file_index = std::size_t{0}; file_index < pending_file_order.size(); ++file_index)
+        {
+            entry_list[file_index].path_offset = path_table.size();
+            entry_list[file_index].path_byte_size = static_cast<std::uint32_t>(pending_file_order[file_index]->virtual_path.size());
+            path_table += pending_file_order[file_index]->virtual_path;
+        }
+
+        const auto entry_table_offset = sizeof(PakFileHeader);
+        const auto path_table_offset = entry_table_offset + entry_list.size() * sizeof(PakEntry);
+
+        auto data_offset = align_offset(path_table_offset + path_table.size());
+        for (auto file_index = std::size_t{0}; file_index < pending_file_order.size(); ++file_index)
+        {
+            auto& entry = entry_list[file_index];
+            entry.path_offset += path_table_offset;
+            entry.compression = static_cast<std::uint32_t>(pending_file_order[file_index]->compression);
+            entry.data_offset = data_offset;
+            entry.stored_byte_size = stored_bytes_list[file_index].size();
+            entry.byte_size = pending_file_order[file_index]->bytes.size();
+
+            data_offset = align_offset(data_offset + entry.stored_byte_size);
+        }
+
+        const auto file_header = PakFileHeader{
+            PAK_MAGIC,
+            PAK_VERSION,
+            static_cast<std::uint32_t>(entry_list.size()),
+            0,
+            entry_table_offset,
+            path_table_offset,
+        };
+
+        auto temporary_path = path;
+        temporary_path += ".tmp";
+        {
+            auto file = std::ofstream{
+                temporary_path,
+                std::ios::binary | std::ios::trunc
+            };
+            XAR_THROW_IF(
+                !file.is_open(),
+                error::XarException,
+                "Failed to open file '{}' for writing",
+                temporary_path.string());
+
+            const auto write_padding = [&file](std::uint64_t offset)
+            {
+                static constexpr auto PADDING = std::array<char, PAK_ENTRY_ALIGNMENT>{};
+                file.write(
+                    PADDING.data(),
+                    static_cast<std::streamsize>(align_offset(offset) - offset));
+            };
+
+            file.write(
+                reinterpret_cast<const char*>(&file_header),
+                sizeof(PakFileHeader));
+            file.write(
+                reinterpret_cast<const char*>(entry_list.data()),
+                static_cast<std::streamsize>(entry_list.size() * sizeof(PakEntry)));
+            file.write(
+                path_table.data(),
+                static_cast<std::streamsize>(path_table.size()));
+            write_padding(path_table_offset + path_table.size());
+
+            for (auto file_index = std::size_t{0}; file_index < entry_list.size(); ++file_index)
+            {
+                file.write(
+                    reinterpret_cast<const char*>(stored_bytes_list[file_index].data()),
+                    static_cast<std::streamsize>(stored_bytes_list[file_index].size()));
+                write_padding(entry_list[file_index].data_offset + entry_list[file_index].stored_byte_size);
+            }
+
+            XAR_THROW_IF(
+                !file.good(),
+                error::XarException,
+                "Failed to write file '{}'",
+                temporary_path.string());
+        }
+
+        std::filesystem::rename(
+            temporary_path,
+            path);
+    }
+
+
+    namespace pak
+    {
+        bool is_compression_supported(EPakCompression compression)
+        {
+            switch (compression)
+            {
+                case EPakCompression::NONE:
+                {
+                    return true;
+                }
+                case EPakCompression::LZ4:
+                {
+#ifdef XAR_ENGINE_WITH_LZ4
+                    return true;
+#else
+                    return false;
+#endif
+                }
+                case EPakCompression::ZSTD:
+                {
+#ifdef XAR_ENGINE_WITH_ZSTD
+                    return true;
+#else
+                    return false;
+#endif
+                }
+            }
+
+            return false;
+        }
+    }
+}
+
+ENUM_TO_STRING_IMPL(xar_engine::file::EPakCompression,
+                    xar_engine::file::EPakCompression::NONE,
+                    xar_engine::file::EPakCompression::LZ4,
+                    xar_engine::file::EPakCompression::ZSTD);
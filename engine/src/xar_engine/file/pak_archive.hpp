@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <xar_engine/file/file_archive.hpp>
+
+#include <xar_engine/meta/enum.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_engine::file
+{
+    enum class EPakCompression
+    {
+        NONE,
+        LZ4,
+        ZSTD,
+    };
+
+
+    // Read side of the .xpak format: a header, a table of contents sorted by virtual path and
+    // aligned file entries, optionally compressed one by one. The archive stays memory mapped.
+    class PakFileArchive
+        : public IFileArchive
+    {
+    public:
+        explicit PakFileArchive(const std::filesystem::path& path);
+
+        ~PakFileArchive() override;
+
+
+        [[nodiscard]]
+        bool contains(const std::string& virtual_path) const override;
+
+        [[nodiscard]]
+        std::vector<std::uint8_t> read_file(const std::string& virtual_path) const override;
+
+        [[nodiscard]]
+        std::optional<std::span<const std::uint8_t>> get_file_view(const std::string& virtual_path) const override;
+
+
+        [[nodiscard]]
+        std::vector<std::string> get_virtual_path_list() const;
+
+    private:
+        struct State;
+
+    private:
+        std::shared_ptr<State> _state;
+    };
+
+
+    class PakArchiveWriter
+    {
+    public:
+        void add_file(
+            std::string virtual_path,
+            std::vector<std::uint8_t> bytes,
+            EPakCompression compression);
+
+        // Compresses entries in parallel and writes the archive.
+        void write_to_file(
+            const std::filesystem::path& path,
+            thread::ThreadPool& thread_pool) const;
+
+    private:
+        struct PendingFile
+        {
+            std::string virtual_path;
+            std::vector<std::uint8_t> bytes;
+            EPakCompression compression;
+        };
+
+    private:
+        std::vector<PendingFile> _pending_file_list;
+    };
+
+
+    namespace pak
+    {
+        inline constexpr auto FILE_EXTENSION = ".xpak";
+
+        [[nodiscard]]
+        bool is_compression_supported(EPakCompression compression);
+    }
+}
+
+ENUM_TO_STRING(xar_engine::file::EPakCompression);
@@ -0,0 +1,68 @@
+#include <xar_engine/file/virtual_file_system.hpp>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::file
+{
+    void VirtualFileSystem::mount(std::unique_ptr<IFileArchive> file_archive)
+    {
+        _file_archive_list.push_back(std::move(file_archive));
+    }
+
+    bool VirtualFileSystem::contains(const std::string& virtual_path) const
+    {
+        return find_file_archive(virtual_path) != nullptr;
+    }
+
+    std::vector<std::uint8_t> VirtualFileSystem::read_file(const std::string& virtual_path) const
+    {
+        const auto* file_archive = find_file_archive(virtual_path);
+        XAR_THROW_IF(
+            file_archive == nullptr,
+            error::XarException,
+            "File '{}' is not in any mounted archive",
+            virtual_path);
+
+        return file_archive->read_file(virtual_path);
+    }
+
+    std::vector<std::vector<std::uint8_t>> VirtualFileSystem::read_file_list(
+        const std::vector<std::string>& virtual_path_list,
+        thread::ThreadPool& thread_pool) const
+    {
+        auto file_bytes_list = std::vector<std::vector<std::uint8_t>>(virtual_path_list.size());
+        thread_pool.parallel_for(
+            virtual_path_list.size(),
+            [this, &virtual_path_list, &file_bytes_list](std::size_t file_index)
+            {
+                file_bytes_list[file_index] = read_file(virtual_path_list[file_index]);
+            });
+
+        return file_bytes_list;
+    }
+
+    std::optional<std::span<const std::uint8_t>> VirtualFileSystem::get_file_view(const std::string& virtual_path) const
+    {
+        const auto* file_archive = find_file_archive(virtual_path);
+        if (file_archive == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        return file_archive->get_file_view(virtual_path);
+    }
+
+    const IFileArchive* VirtualFileSystem::find_file_archive(const std::string& virtual_path) const
+    {
+        for (auto file_archive_it = _file_archive_list.rbegin(); file_archive_it != _file_archive_list.rend(); ++file_archive_it)
+        {
+            if ((*file_archive_it)->contains(virtual_path))
+            {
+                return file_archive_it->get();
+            }
+        }
+
+        return nullptr;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <xar_engine/file/file_archive.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace xar_engine::file
+{
+    // Resolves virtual paths against mounted archives. Archives mounted later shadow earlier ones,
+    // so loose development files can be mounted on top of packed content.
+    class VirtualFileSystem
+    {
+    public:
+        void mount(std::unique_ptr<IFileArchive> file_archive);
+
+
+        [[nodiscard]]
+        bool contains(const std::string& virtual_path) const;
+
+        [[nodiscard]]
+        std::vector<std::uint8_t> read_file(const std::string& virtual_path) const;
+
+        // Reads and decompresses the files in parallel, results are in the order of the paths.
+        [[nodiscard]]
+        std::vector<std::vector<std::uint8_t>> read_file_list(
+            const std::vector<std::string>& virtual_path_list,
+            thread::ThreadPool& thread_pool) const;
+
+        [[nodiscard]]
+        std::optional<std::span<const std::uint8_t>> get_file_view(const std::string& virtual_path) const;
+
+    private:
+        [[nodiscard]]
+        const IFileArchive* find_file_archive(const std::string& virtual_path) const;
+
+    private:
+        std::vector<std::unique_ptr<IFileArchive>> _file_archive_list;
+    };
+}
@@ -0,0 +1,252 @@
+#include <xar_engine/graphics/api/command_list.hpp>
+
+#include <cstring>
+
+#include <xar_engine/meta/enum_impl.hpp>
+
+
+namespace xar_engine::graphics::api
+{
+    namespace
+    {
+        template <typename T>
+        std::span<const T> get_trailing_list(
+            const void* const command_end,
+            const std::size_t byte_offset,
+            const std::size_t count)
+        {
+            return {
+                reinterpret_cast<const T*>(static_cast<const std::byte*>(command_end) + byte_offset),
+                count};
+        }
+
+        constexpr std::size_t align_up(
+            const std::size_t byte_size,
+            const std::size_t alignment)
+        {
+            return (byte_size + alignment - 1) / alignment * alignment;
+        }
+    }
+
+
+    namespace command
+    {
+        std::span<const NativeHandle> SetDescriptorSetList::get_descriptor_set_list() const
+        {
+            return get_trailing_list<NativeHandle>(
+                this + 1,
+                0,
+                descriptor_set_counts);
+        }
+
+        std::span<const NativeHandle> SetVertexBufferList::get_vertex_buffer_list() const
+        {
+            return get_trailing_list<NativeHandle>(
+                this + 1,
+                0,
+                vertex_buffer_counts);
+        }
+
+        std::span<const std::uint64_t> SetVertexBufferList::get_vertex_buffer_offset_list() const
+        {
+            return get_trailing_list<std::uint64_t>(
+                this + 1,
+                vertex_buffer_counts * sizeof(NativeHandle),
+                vertex_buffer_counts);
+        }
+
+        std::span<const std::byte> PushConstants::get_data() const
+        {
+            return get_trailing_list<std::byte>(
+                this + 1,
+                0,
+                byte_size);
+        }
+    }
+
+
+    CommandList::CommandList()
+        : _byte_list{}
+        , _command_counts(0)
+    {
+    }
+
+    void CommandList::set_graphics_pipeline(
+        const NativeHandle pipeline,
+        const std::uint32_t extent_width,
+        const std::uint32_t extent_height)
+    {
+        append(
+            command::SetGraphicsPipeline{
+                pipeline,
+                extent_width,
+                extent_height,
+            },
+            {});
+    }
+
+    void CommandList::set_descriptor_set_list(
+        const NativeHandle pipeline_layout,
+        const std::uint32_t first_set,
+        const std::span<const NativeHandle> descriptor_set_list)
+    {
+        append(
+            command::SetDescriptorSetList{
+                pipeline_layout,
+                first_set,
+                static_cast<std::uint32_t>(descriptor_set_list.size()),
+            },
+            {std::as_bytes(descriptor_set_list)});
+    }
+
+    void CommandList::set_vertex_buffer_list(
+        const std::uint32_t first_slot,
+        const std::span<const NativeHandle> vertex_buffer_list,
+        const std::span<const std::uint64_t> vertex_buffer_offset_list)
+    {
+        XAR_THROW_IF(
+            vertex_buffer_list.size() != vertex_buffer_offset_list.size(),
+            error::XarException,
+            "Number of buffers {} is different than number of offsets {}",
+            vertex_buffer_list.size(),
+            vertex_buffer_offset_list.size());
+
+        append(
+            command::SetVertexBufferList{
+                first_slot,
+                static_cast<std::uint32_t>(vertex_buffer_list.size()),
+            },
+            {
+                std::as_bytes(vertex_buffer_list),
+                std::as_bytes(vertex_buffer_offset_list),
+            });
+    }
+
+    void CommandList::set_index_buffer(
+        const NativeHandle index_buffer,
+        const std::uint64_t byte_offset)
+    {
+        append(
+            command::SetIndexBuffer{
+                index_buffer,
+                byte_offset,
+            },
+            {});
+    }
+
+    void CommandList::push_constants(
+        const NativeHandle pipeline_layout,
+        const EShaderType shader_type,
+        const std::uint32_t byte_offset,
+        const std::span<const std::byte> data)
+    {
+        append(
+            command::PushConstants{
+                pipeline_layout,
+                shader_type,
+                byte_offset,
+                static_cast<std::uint32_t>(data.size()),
+            },
+            {data});
+    }
+
+    void CommandList::draw_indexed(
+        const std::uint32_t index_counts,
+        const std::uint32_t instance_counts,
+        const std::uint32_t first_index,
+        const std::int32_t vertex_offset,
+        const std::uint32_t first_instance)
+    {
+        append(
+            command::DrawIndexed{
+                index_counts,
+                instance_counts,
+                first_index,
+                vertex_offset,
+                first_instance,
+            },
+            {});
+    }
+
+    void CommandList::clear()
+    {
+        _byte_list.clear();
+        _command_counts = 0;
+    }
+
+    std::size_t CommandList::get_command_counts() const
+    {
+        return _command_counts;
+    }
+
+    std::size_t CommandList::get_byte_size() const
+    {
+        return _byte_list.size();
+    }
+
+    // Writes header, command and payload back to back, padded so the next header stays aligned. The payload
+    // parts are multiples of their element size, and every command is as aligned as NativeHandle, so each
+    // payload part is aligned as well.
+    template <typename TCommand>
+    void CommandList::append(
+        const TCommand& command,
+        const std::initializer_list<std::span<const std::byte>> payload_list)
+    {
+        static_assert(std::is_trivially_copyable_v<TCommand>);
+        static_assert(alignof(TCommand) <= RECORD_ALIGNMENT);
+        static_assert(sizeof(command::Header) % RECORD_ALIGNMENT == 0);
+
+        auto payload_byte_size = std::size_t{0};
+        for (const auto& payload: payload_list)
+        {
+            payload_byte_size += payload.size();
+        }
+
+        const auto record_byte_size = align_up(
+            sizeof(command::Header) + sizeof(TCommand) + payload_byte_size,
+            RECORD_ALIGNMENT);
+
+        const auto record_byte_offset = _byte_list.size();
+        _byte_list.resize(record_byte_offset + record_byte_size);
+        auto* data = _byte_list.data() + record_byte_offset;
+
+        const auto header = command::Header{
+            TCommand::TYPE,
+            static_cast<std::uint32_t>(record_byte_size),
+        };
+        std::memcpy(
+            data,
+            &header,
+            sizeof(header));
+        data += sizeof(header);
+
+        std::memcpy(
+            data,
+            &command,
+            sizeof(command));
+        data += sizeof(command);
+
+        for (const auto& payload: payload_list)
+        {
+            if (!payload.empty())
+            {
+                std::memcpy(
+                    data,
+                    payload.data(),
+                    payload.size());
+                data += payload.size();
+            }
+        }
+
+        ++_command_counts;
+    }
+}
+
+
+ENUM_TO_STRING_IMPL(xar_engine::graphics::api::ECommandType,
+                    xar_engine::graphics::api::ECommandType::SET_GRAPHICS_PIPELINE,
+                    xar_engine::graphics::api::ECommandType::SET_DESCRIPTOR_SET_LIST,
+                    xar_engine::graphics::api::ECommandType::SET_VERTEX_BUFFER_LIST,
+                    xar_engine::graphics::api::ECommandType::SET_INDEX_BUFFER,
+                    xar_engine::graphics::api::ECommandType::PUSH_CONSTANTS,
+                    xar_engine::graphics::api::ECommandType::DRAW_INDEXED);
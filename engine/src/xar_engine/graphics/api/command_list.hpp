@@ -0,0 +1,258 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/graphics/api/shader_reference.hpp>
+
+#include <xar_engine/meta/enum.hpp>
+
+
+namespace xar_engine::graphics::api
+{
+    // Native object of the backend, e.g. a VkBuffer. Valid as long as a reference to its resource is held.
+    using NativeHandle = std::uint64_t;
+
+    struct NativeGraphicsPipeline
+    {
+        NativeHandle pipeline;
+        NativeHandle pipeline_layout;
+    };
+
+
+    enum class ECommandType : std::uint32_t
+    {
+        SET_GRAPHICS_PIPELINE,
+        SET_DESCRIPTOR_SET_LIST,
+        SET_VERTEX_BUFFER_LIST,
+        SET_INDEX_BUFFER,
+        PUSH_CONSTANTS,
+        DRAW_INDEXED,
+    };
+
+
+    // Commands as they are stored in a CommandList. Variable-length data directly follows its command in the
+    // list, so the accessors for it only work on commands visited by CommandList::for_each_command().
+    namespace command
+    {
+        struct Header
+        {
+            ECommandType type;
+            std::uint32_t byte_size;
+        };
+
+        // Binds the pipeline and sets a viewport and scissor covering the whole extent.
+        struct SetGraphicsPipeline
+        {
+            static constexpr auto TYPE = ECommandType::SET_GRAPHICS_PIPELINE;
+
+            NativeHandle pipeline;
+            std::uint32_t extent_width;
+            std::uint32_t extent_height;
+        };
+
+        struct SetDescriptorSetList
+        {
+            static constexpr auto TYPE = ECommandType::SET_DESCRIPTOR_SET_LIST;
+
+            NativeHandle pipeline_layout;
+            std::uint32_t first_set;
+            std::uint32_t descriptor_set_counts;
+
+            [[nodiscard]]
+            std::span<const NativeHandle> get_descriptor_set_list() const;
+        };
+
+        struct SetVertexBufferList
+        {
+            static constexpr auto TYPE = ECommandType::SET_VERTEX_BUFFER_LIST;
+
+            std::uint32_t first_slot;
+            std::uint32_t vertex_buffer_counts;
+
+            [[nodiscard]]
+            std::span<const NativeHandle> get_vertex_buffer_list() const;
+            [[nodiscard]]
+            std::span<const std::uint64_t> get_vertex_buffer_offset_list() const;
+        };
+
+        struct SetIndexBuffer
+        {
+            static constexpr auto TYPE = ECommandType::SET_INDEX_BUFFER;
+
+            NativeHandle index_buffer;
+            std::uint64_t byte_offset;
+        };
+
+        struct PushConstants
+        {
+            static constexpr auto TYPE = ECommandType::PUSH_CONSTANTS;
+
+            NativeHandle pipeline_layout;
+            EShaderType shader_type;
+            std::uint32_t byte_offset;
+            std::uint32_t byte_size;
+
+            [[nodiscard]]
+            std::span<const std::byte> get_data() const;
+        };
+
+        struct DrawIndexed
+        {
+            static constexpr auto TYPE = ECommandType::DRAW_INDEXED;
+
+            std::uint32_t index_counts;
+            std::uint32_t instance_counts;
+            std::uint32_t first_index;
+            std::int32_t vertex_offset;
+            std::uint32_t first_instance;
+        };
+    }
+
+
+    // Backend-agnostic draw commands with pre-resolved native handles, appended into one linear buffer. Recording
+    // does no resource lookups and clear() keeps the memory, so a list reused every frame stops allocating once
+    // it has grown to the frame size. The backend replays a list in a single loop.
+    class CommandList
+    {
+    public:
+        CommandList();
+
+
+        void set_graphics_pipeline(
+            NativeHandle pipeline,
+            std::uint32_t extent_width,
+            std::uint32_t extent_height);
+
+        void set_descriptor_set_list(
+            NativeHandle pipeline_layout,
+            std::uint32_t first_set,
+            std::span<const NativeHandle> descriptor_set_list);
+
+        void set_vertex_buffer_list(
+            std::uint32_t first_slot,
+            std::span<const NativeHandle> vertex_buffer_list,
+            std::span<const std::uint64_t> vertex_buffer_offset_list);
+
+        void set_index_buffer(
+            NativeHandle index_buffer,
+            std::uint64_t byte_offset);
+
+        // The data is copied into the list.
+        void push_constants(
+            NativeHandle pipeline_layout,
+            EShaderType shader_type,
+            std::uint32_t byte_offset,
+            std::span<const std::byte> data);
+
+        void draw_indexed(
+            std::uint32_t index_counts,
+            std::uint32_t instance_counts,
+            std::uint32_t first_index,
+            std::int32_t vertex_offset,
+            std::uint32_t first_instance);
+
+        void clear();
+
+
+        // Calls visitor(command) for every command in recording order, command is one of the structs of
+        // namespace command.
+        template <typename TVisitor>
+        void for_each_command(TVisitor&& visitor) const;
+
+        [[nodiscard]]
+        std::size_t get_command_counts() const;
+
+        [[nodiscard]]
+        std::size_t get_byte_size() const;
+
+    private:
+        static constexpr auto RECORD_ALIGNMENT = alignof(NativeHandle);
+
+    private:
+        template <typename TCommand>
+        void append(
+            const TCommand& command,
+            std::initializer_list<std::span<const std::byte>> payload_list);
+
+        template <typename TCommand>
+        static const TCommand& read(const std::byte* data);
+
+    private:
+        std::vector<std::byte> _byte_list;
+        std::size_t _command_counts;
+    };
+
+
+    template <typename TVisitor>
+    void CommandList::for_each_command(TVisitor&& visitor) const
+    {
+        const auto* const data = _byte_list.data();
+        for (auto byte_offset = std::size_t{0}; byte_offset < _byte_list.size();)
+        {
+            const auto& header = read<command::Header>(data + byte_offset);
+            const auto* const command_data = data + byte_offset + sizeof(command::Header);
+
+            switch (header.type)
+            {
+                case ECommandType::SET_GRAPHICS_PIPELINE:
+                {
+                    visitor(read<command::SetGraphicsPipeline>(command_data));
+                    break;
+                }
+                case ECommandType::SET_DESCRIPTOR_SET_LIST:
+                {
+                    visitor(read<command::SetDescriptorSetList>(command_data));
+                    break;
+                }
+                case ECommandType::SET_VERTEX_BUFFER_LIST:
+                {
+                    visitor(read<command::SetVertexBufferList>(command_data));
+                    break;
+                }
+                case ECommandType::SET_INDEX_BUFFER:
+                {
+                    visitor(read<command::SetIndexBuffer>(command_data));
+                    break;
+                }
+                case ECommandType::PUSH_CONSTANTS:
+                {
+                    visitor(read<command::PushConstants>(command_data));
+                    break;
+                }
+                case ECommandType::DRAW_INDEXED:
+                {
+                    visitor(read<command::DrawIndexed>(command_data));
+                    break;
+                }
+                default:
+                {
+                    XAR_THROW(
+                        error::XarException,
+                        "Invalid command type {}",
+                        static_cast<std::uint32_t>(header.type));
+                }
+            }
+
+            byte_offset += header.byte_size;
+        }
+    }
+
+    template <typename TCommand>
+    const TCommand& CommandList::read(const std::byte* const data)
+    {
+        static_assert(std::is_trivially_copyable_v<TCommand>);
+        static_assert(alignof(TCommand) <= RECORD_ALIGNMENT);
+
+        return *reinterpret_cast<const TCommand*>(data);
+    }
+}
+
+
+ENUM_TO_STRING(xar_engine::graphics::api::ECommandType);
@@ -5,6 +5,7 @@
 
 ENUM_TO_STRING_IMPL(xar_engine::graphics::api::EFormat,
                     xar_engine::graphics::api::EFormat::D32_SIGNED_FLOAT,
+                    xar_engine::graphics::api::EFormat::R16G16B16A16_SIGNED_FLOAT,
                     xar_engine::graphics::api::EFormat::R32G32_SIGNED_FLOAT,
                     xar_engine::graphics::api::EFormat::R32G32B32_SIGNED_FLOAT,
                     xar_engine::graphics::api::EFormat::R8G8B8A8_SRGB);
\ No newline at end of file
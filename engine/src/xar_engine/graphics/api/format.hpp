@@ -8,6 +8,7 @@ namespace xar_engine::graphics::api
     enum class EFormat
     {
         D32_SIGNED_FLOAT,
+        R16G16B16A16_SIGNED_FLOAT,
         R32G32_SIGNED_FLOAT,
         R32G32B32_SIGNED_FLOAT,
         R8G8B8A8_SRGB,
@@ -10,6 +10,7 @@ ENUM_TO_STRING_IMPL(xar_engine::graphics::api::EImageType,
 
 ENUM_TO_STRING_IMPL(xar_engine::graphics::api::EImageLayout,
                     xar_engine::graphics::api::EImageLayout::DEPTH_STENCIL_ATTACHMENT,
+                    xar_engine::graphics::api::EImageLayout::SHADER_READ_ONLY,
                     xar_engine::graphics::api::EImageLayout::TRANSFER_DESTINATION);
 
 ENUM_TO_STRING_IMPL(xar_engine::graphics::api::EImageAspect,
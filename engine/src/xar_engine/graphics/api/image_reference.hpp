@@ -20,6 +20,7 @@ namespace xar_engine::graphics::api
     enum class EImageLayout
     {
         DEPTH_STENCIL_ATTACHMENT,
+        SHADER_READ_ONLY,
         TRANSFER_DESTINATION,
     };
 
@@ -0,0 +1,18 @@
+#include <xar_engine/graphics/api/sampler_reference.hpp>
+
+#include <xar_engine/meta/enum_impl.hpp>
+
+
+ENUM_TO_STRING_IMPL(xar_engine::graphics::api::ESamplerFilter,
+                    xar_engine::graphics::api::ESamplerFilter::NEAREST,
+                    xar_engine::graphics::api::ESamplerFilter::LINEAR);
+
+ENUM_TO_STRING_IMPL(xar_engine::graphics::api::ESamplerMipMapMode,
+                    xar_engine::graphics::api::ESamplerMipMapMode::NEAREST,
+                    xar_engine::graphics::api::ESamplerMipMapMode::LINEAR);
+
+ENUM_TO_STRING_IMPL(xar_engine::graphics::api::ESamplerAddressMode,
+                    xar_engine::graphics::api::ESamplerAddressMode::REPEAT,
+                    xar_engine::graphics::api::ESamplerAddressMode::MIRRORED_REPEAT,
+                    xar_engine::graphics::api::ESamplerAddressMode::CLAMP_TO_EDGE,
+                    xar_engine::graphics::api::ESamplerAddressMode::CLAMP_TO_BORDER);
\ No newline at end of file
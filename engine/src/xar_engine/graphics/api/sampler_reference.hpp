@@ -1,5 +1,6 @@
 #pragma once
 
+#include <xar_engine/meta/enum.hpp>
 #include <xar_engine/meta/resource_reference.hpp>
 
 
@@ -7,4 +8,32 @@ namespace xar_engine::graphics::api
 {
     enum class SamplerTag;
     using SamplerReference = meta::TResourceReference<SamplerTag>;
-}
\ No newline at end of file
+
+
+    constexpr float SAMPLER_LOD_CLAMP_NONE = 1000.0f;
+
+    enum class ESamplerFilter
+    {
+        NEAREST,
+        LINEAR,
+    };
+
+    enum class ESamplerMipMapMode
+    {
+        NEAREST,
+        LINEAR,
+    };
+
+    enum class ESamplerAddressMode
+    {
+        REPEAT,
+        MIRRORED_REPEAT,
+        CLAMP_TO_EDGE,
+        CLAMP_TO_BORDER,
+    };
+}
+
+
+ENUM_TO_STRING(xar_engine::graphics::api::ESamplerFilter);
+ENUM_TO_STRING(xar_engine::graphics::api::ESamplerMipMapMode);
+ENUM_TO_STRING(xar_engine::graphics::api::ESamplerAddressMode);
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
 #include <xar_engine/graphics/api/buffer_reference.hpp>
 #include <xar_engine/graphics/api/command_buffer_reference.hpp>
+#include <xar_engine/graphics/api/command_list.hpp>
 #include <xar_engine/graphics/api/image_reference.hpp>
 
+#include <xar_engine/math/vector.hpp>
+
 
 namespace xar_engine::graphics::backend::unit
 {
@@ -12,6 +18,7 @@ namespace xar_engine::graphics::backend::unit
     public:
         struct MakeBufferParameters;
         struct UpdateBufferParameters;
+        struct MapStagingBufferParameters;
         struct CopyBufferParameters;
         struct CopyBufferToImageParameters;
 
@@ -25,8 +32,14 @@ namespace xar_engine::graphics::backend::unit
         virtual api::BufferReference make_uniform_buffer(const MakeBufferParameters& parameters) = 0;
 
         virtual void update_buffer(const UpdateBufferParameters& parameters) = 0;
+        // The returned memory stays mapped for the lifetime of the staging buffer, so file data can be
+        // read or decompressed straight into it.
+        virtual std::span<std::uint8_t> map_staging_buffer(const MapStagingBufferParameters& parameters) = 0;
         virtual void copy_buffer(const CopyBufferParameters& parameters) = 0;
         virtual void copy_buffer_to_image(const CopyBufferToImageParameters& parameters) = 0;
+
+        [[nodiscard]]
+        virtual api::NativeHandle get_native_buffer(const api::BufferReference& buffer) const = 0;
     };
 
 
@@ -41,6 +54,11 @@ namespace xar_engine::graphics::backend::unit
         std::vector<api::BufferUpdate> data;
     };
 
+    struct IBufferUnit::MapStagingBufferParameters
+    {
+        api::BufferReference buffer;
+    };
+
     struct IBufferUnit::CopyBufferParameters
     {
         api::CommandBufferReference command_buffer;
@@ -53,5 +71,8 @@ namespace xar_engine::graphics::backend::unit
         api::CommandBufferReference command_buffer;
         api::BufferReference source_buffer;
         api::ImageReference target_image;
+        math::Vector2u32 image_offset;
+        math::Vector2u32 image_extent;
+        std::uint64_t source_byte_offset;
     };
 }
\ No newline at end of file
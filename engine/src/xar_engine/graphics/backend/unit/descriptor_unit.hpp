@@ -3,6 +3,7 @@
 #include <set>
 
 #include <xar_engine/graphics/api/buffer_reference.hpp>
+#include <xar_engine/graphics/api/command_list.hpp>
 #include <xar_engine/graphics/api/descriptor_pool_reference.hpp>
 #include <xar_engine/graphics/api/descriptor_set_layout_reference.hpp>
 #include <xar_engine/graphics/api/descriptor_set_reference.hpp>
@@ -29,6 +30,12 @@ namespace xar_engine::graphics::backend::unit
         virtual std::vector<api::DescriptorSetReference> make_descriptor_set_list(const MakeDescriptorSetParameters& parameters) = 0;
 
         virtual void write_descriptor_set(const WriteDescriptorSetParameters& parameters) = 0;
+
+        [[nodiscard]]
+        virtual std::uint32_t get_sampled_image_capacity() const = 0;
+
+        [[nodiscard]]
+        virtual api::NativeHandle get_native_descriptor_set(const api::DescriptorSetReference& descriptor_set) const = 0;
     };
 
 
@@ -2,6 +2,7 @@
 
 #include <xar_engine/graphics/api/buffer_reference.hpp>
 #include <xar_engine/graphics/api/command_buffer_reference.hpp>
+#include <xar_engine/graphics/api/command_list.hpp>
 #include <xar_engine/graphics/api/descriptor_set_layout_reference.hpp>
 #include <xar_engine/graphics/api/descriptor_set_reference.hpp>
 #include <xar_engine/graphics/api/graphics_pipeline_reference.hpp>
@@ -21,6 +22,7 @@ namespace xar_engine::graphics::backend::unit
         struct SetIndexBufferParameters;
         struct PushConstantsParameters;
         struct DrawIndexedParameters;
+        struct ExecuteCommandListParameters;
 
     public:
         virtual ~IGraphicsPipelineUnit();
@@ -33,6 +35,12 @@ namespace xar_engine::graphics::backend::unit
         virtual void set_index_buffer(const SetIndexBufferParameters& parameters) = 0;
         virtual void push_constants(const PushConstantsParameters& parameters) = 0;
         virtual void draw_indexed(const DrawIndexedParameters& parameters) = 0;
+
+        // Replays a command list into the command buffer, the handles in it are not validated.
+        virtual void execute_command_list(const ExecuteCommandListParameters& parameters) = 0;
+
+        [[nodiscard]]
+        virtual api::NativeGraphicsPipeline get_native_graphics_pipeline(const api::GraphicsPipelineReference& graphics_pipeline) const = 0;
     };
 
 
@@ -91,4 +99,10 @@ namespace xar_engine::graphics::backend::unit
         std::uint32_t vertex_offset;
         std::uint32_t first_instance;
     };
+
+    struct IGraphicsPipelineUnit::ExecuteCommandListParameters
+    {
+        api::CommandBufferReference command_buffer;
+        const api::CommandList* command_list;
+    };
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ namespace xar_engine::graphics::backend::unit
         struct MakeImageParameters;
         struct MakeImageViewParameters;
         struct MakeSamplerParameters;
+        struct ClearImageParameters;
         struct GenerateImageMipMapsParameters;
         struct TransitImageLayoutParameters;
 
@@ -28,6 +29,7 @@ namespace xar_engine::graphics::backend::unit
         virtual api::ImageViewReference make_image_view(const MakeImageViewParameters& parameters) = 0;
         virtual api::SamplerReference make_sampler(const MakeSamplerParameters& parameters) = 0;
 
+        virtual void clear_image(const ClearImageParameters& parameters) = 0;
         virtual void generate_image_mip_maps(const GenerateImageMipMapsParameters& parameters) = 0;
         virtual void transit_image_layout(const TransitImageLayoutParameters& parameters) = 0;
     };
@@ -51,13 +53,32 @@ namespace xar_engine::graphics::backend::unit
 
     struct IImageUnit::MakeSamplerParameters
     {
-        float mip_levels;
+        api::ESamplerFilter magnification_filter;
+        api::ESamplerFilter minification_filter;
+        api::ESamplerMipMapMode mip_map_mode;
+        api::ESamplerAddressMode address_mode_u;
+        api::ESamplerAddressMode address_mode_v;
+        api::ESamplerAddressMode address_mode_w;
+        bool anisotropy_enabled;
+        float max_anisotropy;
+        float min_lod;
+        float max_lod;
+
+        bool operator==(const MakeSamplerParameters& other) const = default;
+    };
+
+    struct IImageUnit::ClearImageParameters
+    {
+        api::CommandBufferReference& command_buffer;
+        api::ImageReference& image;
     };
 
     struct IImageUnit::GenerateImageMipMapsParameters
     {
         api::CommandBufferReference command_buffer;
         api::ImageReference image;
+        math::Vector2u32 region_offset;
+        math::Vector2u32 region_extent;
     };
 
     struct IImageUnit::TransitImageLayoutParameters
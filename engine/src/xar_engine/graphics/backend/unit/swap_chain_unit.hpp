@@ -6,6 +6,8 @@
 
 #include <xar_engine/graphics/context/window_surface.hpp>
 
+#include <xar_engine/math/vector.hpp>
+
 
 namespace xar_engine::graphics::backend::unit
 {
@@ -28,6 +30,9 @@ namespace xar_engine::graphics::backend::unit
         virtual void begin_rendering(const BeginRenderingParameters& parameters) = 0;
         virtual void end_rendering(const EndRenderingParameters& parameters) = 0;
         virtual api::ESwapChainResult end_frame(const EndFrameParameters& parameters) = 0;
+
+        [[nodiscard]]
+        virtual math::Vector2u32 get_swap_chain_extent(const api::SwapChainReference& swap_chain) const = 0;
     };
 
 
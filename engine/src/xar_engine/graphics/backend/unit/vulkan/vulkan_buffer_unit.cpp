@@ -1,5 +1,7 @@
 #include <xar_engine/graphics/backend/unit/vulkan/vulkan_buffer_unit.hpp>
 
+#include <xar_engine/graphics/backend/vulkan/vulkan_type_converters.hpp>
+
 
 namespace xar_engine::graphics::backend::unit::vulkan
 {
@@ -50,6 +52,11 @@ namespace xar_engine::graphics::backend::unit::vulkan
         vulkan_buffer.unmap();
     }
 
+    std::span<std::uint8_t> IVulkanBufferUnit::map_staging_buffer(const MapStagingBufferParameters& parameters)
+    {
+        return get_state().vulkan_resource_storage.get(parameters.buffer).map_persistently();
+    }
+
     void IVulkanBufferUnit::copy_buffer(const CopyBufferParameters& parameters)
     {
         auto& vulkan_resource_storage = get_state().vulkan_resource_storage;
@@ -80,7 +87,7 @@ namespace xar_engine::graphics::backend::unit::vulkan
         const auto& vulkan_target_image = vulkan_resource_storage.get(parameters.target_image);
 
         VkBufferImageCopy region{};
-        region.bufferOffset = 0;
+        region.bufferOffset = parameters.source_byte_offset;
         region.bufferRowLength = 0;
         region.bufferImageHeight = 0;
 
@@ -89,11 +96,15 @@ namespace xar_engine::graphics::backend::unit::vulkan
         region.imageSubresource.baseArrayLayer = 0;
         region.imageSubresource.layerCount = 1;
 
-        region.imageOffset = {0, 0, 0};
+        region.imageOffset = {
+            static_cast<std::int32_t>(parameters.image_offset.x),
+            static_cast<std::int32_t>(parameters.image_offset.y),
+            0,
+        };
         region.imageExtent = {
-            static_cast<std::uint32_t>(vulkan_target_image.get_dimension().x),
-            static_cast<std::uint32_t>(vulkan_target_image.get_dimension().y),
-            static_cast<std::uint32_t>(vulkan_target_image.get_dimension().z),
+            parameters.image_extent.x,
+            parameters.image_extent.y,
+            1,
         };
 
         vkCmdCopyBufferToImage(
@@ -106,6 +117,11 @@ namespace xar_engine::graphics::backend::unit::vulkan
         );
     }
 
+    api::NativeHandle IVulkanBufferUnit::get_native_buffer(const api::BufferReference& buffer) const
+    {
+        return backend::vulkan::to_native_handle(get_state().vulkan_resource_storage.get(buffer).get_native());
+    }
+
     api::BufferReference IVulkanBufferUnit::make_buffer(
         const IVulkanBufferUnit::MakeBufferParameters& parameters,
         const VkBufferUsageFlags vk_buffer_usage_flag_bits,
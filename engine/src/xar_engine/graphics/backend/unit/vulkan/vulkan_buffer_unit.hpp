@@ -22,9 +22,13 @@ namespace xar_engine::graphics::backend::unit::vulkan
         api::BufferReference make_uniform_buffer(const MakeBufferParameters& parameters) override;
 
         void update_buffer(const UpdateBufferParameters& parameters) override;
+        std::span<std::uint8_t> map_staging_buffer(const MapStagingBufferParameters& parameters) override;
         void copy_buffer(const CopyBufferParameters& parameters) override;
         void copy_buffer_to_image(const CopyBufferToImageParameters& parameters) override;
 
+        [[nodiscard]]
+        api::NativeHandle get_native_buffer(const api::BufferReference& buffer) const override;
+
     private:
         api::BufferReference make_buffer(
             const IVulkanBufferUnit::MakeBufferParameters& parameters,
@@ -1,6 +1,10 @@
 #include <xar_engine/graphics/backend/unit/descriptor_unit.hpp>
 #include "vulkan_descriptor_unit.hpp"
 
+#include <algorithm>
+
+#include <xar_engine/graphics/backend/vulkan/vulkan_type_converters.hpp>
+
 
 namespace xar_engine::graphics::backend::unit::vulkan
 {
@@ -13,11 +17,21 @@ namespace xar_engine::graphics::backend::unit::vulkan
                 vulkan_device.get_native_physical_device().get_vk_device_properties().limits.maxDescriptorSetUniformBuffers);
         }
 
+        constexpr auto MAX_COMBINED_IMAGE_SAMPLER_COUNT = std::uint32_t{1} << 16;
+
         std::uint32_t get_combined_image_sampler_count(const native::vulkan::VulkanDevice& vulkan_device)
         {
+            const auto& vk_descriptor_indexing_properties =
+                vulkan_device.get_native_physical_device().get_vk_descriptor_indexing_properties();
+
             return std::min(
-                std::uint32_t{1024},
-                vulkan_device.get_native_physical_device().get_vk_device_properties().limits.maxDescriptorSetSampledImages);
+                {
+                    MAX_COMBINED_IMAGE_SAMPLER_COUNT,
+                    vk_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSampledImages,
+                    vk_descriptor_indexing_properties.maxDescriptorSetUpdateAfterBindSamplers,
+                    vk_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSampledImages,
+                    vk_descriptor_indexing_properties.maxPerStageDescriptorUpdateAfterBindSamplers,
+                });
         }
     }
 
@@ -46,6 +60,7 @@ namespace xar_engine::graphics::backend::unit::vulkan
     api::DescriptorSetLayoutReference IVulkanDescriptorUnit::make_descriptor_set_layout(const MakeDescriptorSetLayoutParameters& parameters)
     {
         std::vector<VkDescriptorSetLayoutBinding> vk_descriptor_set_layout_binding_list;
+        std::vector<VkDescriptorBindingFlags> vk_descriptor_binding_flags_list;
         if (parameters.descriptor_pool_type_list.count(api::EDescriptorType::UNIFORM_BUFFER) != 0)
         {
             VkDescriptorSetLayoutBinding uboLayoutBinding{};
@@ -56,6 +71,7 @@ namespace xar_engine::graphics::backend::unit::vulkan
             uboLayoutBinding.pImmutableSamplers = nullptr;
 
             vk_descriptor_set_layout_binding_list.push_back(uboLayoutBinding);
+            vk_descriptor_binding_flags_list.push_back(0);
         }
 
         if (parameters.descriptor_pool_type_list.count(api::EDescriptorType::SAMPLED_IMAGE) != 0)
@@ -68,6 +84,10 @@ namespace xar_engine::graphics::backend::unit::vulkan
             samplerLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
 
             vk_descriptor_set_layout_binding_list.push_back(samplerLayoutBinding);
+            vk_descriptor_binding_flags_list.push_back(
+                VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+                VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT);
         }
 
         return get_state().vulkan_resource_storage.add(
@@ -75,6 +95,7 @@ namespace xar_engine::graphics::backend::unit::vulkan
                 {
                     get_state().vulkan_device,
                     vk_descriptor_set_layout_binding_list,
+                    vk_descriptor_binding_flags_list,
                 }});
     }
 
@@ -141,16 +162,21 @@ namespace xar_engine::graphics::backend::unit::vulkan
         auto imageInfoList = std::vector<VkDescriptorImageInfo>{};
         if (!parameters.texture_image_view_list.empty())
         {
-            const auto combined_image_sampler_count =
-                get_combined_image_sampler_count(get_state().vulkan_device) - parameters.texture_image_first_index;
-            for (auto texture_index = 0; texture_index < combined_image_sampler_count; ++texture_index)
+            XAR_THROW_IF(
+                parameters.texture_image_first_index + parameters.texture_image_view_list.size() > get_combined_image_sampler_count(get_state().vulkan_device),
+                error::XarException,
+                "Texture range [{}, {}) exceeds combined image sampler count {}",
+                parameters.texture_image_first_index,
+                parameters.texture_image_first_index + parameters.texture_image_view_list.size(),
+                get_combined_image_sampler_count(get_state().vulkan_device));
+
+            imageInfoList.reserve(parameters.texture_image_view_list.size());
+            for (auto texture_index = std::size_t{0}; texture_index < parameters.texture_image_view_list.size(); ++texture_index)
             {
-                const auto object_index = texture_index < parameters.texture_image_view_list.size() ? texture_index : 0;
-
                 VkDescriptorImageInfo imageInfo{};
                 imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-                imageInfo.imageView = get_state().vulkan_resource_storage.get(parameters.texture_image_view_list[object_index]).get_native();
-                imageInfo.sampler = get_state().vulkan_resource_storage.get(parameters.sampler_list[object_index]).get_native();
+                imageInfo.imageView = get_state().vulkan_resource_storage.get(parameters.texture_image_view_list[texture_index]).get_native();
+                imageInfo.sampler = get_state().vulkan_resource_storage.get(parameters.sampler_list[texture_index]).get_native();
 
                 imageInfoList.push_back(imageInfo);
             }
@@ -171,4 +197,14 @@ namespace xar_engine::graphics::backend::unit::vulkan
 
         get_state().vulkan_resource_storage.get(parameters.descriptor_set).write(descriptorWrites);
     }
+
+    std::uint32_t IVulkanDescriptorUnit::get_sampled_image_capacity() const
+    {
+        return get_combined_image_sampler_count(get_state().vulkan_device);
+    }
+
+    api::NativeHandle IVulkanDescriptorUnit::get_native_descriptor_set(const api::DescriptorSetReference& descriptor_set) const
+    {
+        return backend::vulkan::to_native_handle(get_state().vulkan_resource_storage.get(descriptor_set).get_native());
+    }
 }
\ No newline at end of file
@@ -19,5 +19,11 @@ namespace xar_engine::graphics::backend::unit::vulkan
         std::vector<api::DescriptorSetReference> make_descriptor_set_list(const MakeDescriptorSetParameters& parameters) override;
 
         void write_descriptor_set(const WriteDescriptorSetParameters& parameters) override;
+
+        [[nodiscard]]
+        std::uint32_t get_sampled_image_capacity() const override;
+
+        [[nodiscard]]
+        api::NativeHandle get_native_descriptor_set(const api::DescriptorSetReference& descriptor_set) const override;
     };
 }
\ No newline at end of file
@@ -1,16 +1,34 @@
 #include <xar_engine/graphics/backend/unit/vulkan/vulkan_graphics_pipeline_unit.hpp>
 
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
 #include <xar_engine/graphics/backend/vulkan/vulkan_type_converters.hpp>
 
+#include <xar_engine/math/vector.hpp>
+
+#include <xar_engine/meta/overloaded.hpp>
+
 
 namespace xar_engine::graphics::backend::unit::vulkan
 {
+    namespace
+    {
+        // Upper bound of descriptor sets and vertex buffers bound by a single command, so the native handles can
+        // be converted on the stack while a command list is replayed.
+        constexpr auto MAX_BOUND_LIST_SIZE = std::size_t{16};
+    }
+
+
     api::GraphicsPipelineReference IVulkanGraphicsPipelineUnit::make_graphics_pipeline(const MakeGraphicsPipelineParameters& parameters)
     {
         struct Constants
         {
             float time;
             std::int32_t material_index;
+            math::Vector2f uv_offset;
+            math::Vector2f uv_scale;
         } pc;
 
         VkPushConstantRange pushConstantRange{};
@@ -157,4 +175,133 @@ namespace xar_engine::graphics::backend::unit::vulkan
             static_cast<std::int32_t>(parameters.vertex_offset),
             static_cast<std::uint32_t>(parameters.first_instance));
     }
-}
\ No newline at end of file
+
+    void IVulkanGraphicsPipelineUnit::execute_command_list(const ExecuteCommandListParameters& parameters)
+    {
+        using backend::vulkan::from_native_handle;
+
+        const auto vk_command_buffer = get_state().vulkan_resource_storage.get(parameters.command_buffer).get_native();
+
+        parameters.command_list->for_each_command(
+            meta::TOverloaded{
+                [vk_command_buffer](const api::command::SetGraphicsPipeline& command)
+                {
+                    vkCmdBindPipeline(
+                        vk_command_buffer,
+                        VK_PIPELINE_BIND_POINT_GRAPHICS,
+                        from_native_handle<VkPipeline>(command.pipeline));
+
+                    auto vk_viewport = VkViewport{};
+                    vk_viewport.x = 0.0f;
+                    vk_viewport.y = 0.0f;
+                    vk_viewport.width = static_cast<float>(command.extent_width);
+                    vk_viewport.height = static_cast<float>(command.extent_height);
+                    vk_viewport.minDepth = 0.0f;
+                    vk_viewport.maxDepth = 1.0f;
+                    vkCmdSetViewport(
+                        vk_command_buffer,
+                        0,
+                        1,
+                        &vk_viewport);
+
+                    auto scissor_vk_rect_2d = VkRect2D{};
+                    scissor_vk_rect_2d.offset = {0, 0};
+                    scissor_vk_rect_2d.extent = {
+                        command.extent_width,
+                        command.extent_height,
+                    };
+                    vkCmdSetScissor(
+                        vk_command_buffer,
+                        0,
+                        1,
+                        &scissor_vk_rect_2d);
+                },
+                [vk_command_buffer](const api::command::SetDescriptorSetList& command)
+                {
+                    const auto descriptor_set_list = command.get_descriptor_set_list();
+                    auto vk_descriptor_set_list = std::array<VkDescriptorSet, MAX_BOUND_LIST_SIZE>{};
+                    XAR_THROW_IF(
+                        descriptor_set_list.size() > vk_descriptor_set_list.size(),
+                        error::XarException,
+                        "Number of descriptor sets {} exceeds the limit {}",
+                        descriptor_set_list.size(),
+                        vk_descriptor_set_list.size());
+                    std::ranges::transform(
+                        descriptor_set_list,
+                        vk_descriptor_set_list.begin(),
+                        from_native_handle<VkDescriptorSet>);
+
+                    vkCmdBindDescriptorSets(
+                        vk_command_buffer,
+                        VK_PIPELINE_BIND_POINT_GRAPHICS,
+                        from_native_handle<VkPipelineLayout>(command.pipeline_layout),
+                        command.first_set,
+                        command.descriptor_set_counts,
+                        vk_descriptor_set_list.data(),
+                        0,
+                        nullptr);
+                },
+                [vk_command_buffer](const api::command::SetVertexBufferList& command)
+                {
+                    const auto vertex_buffer_list = command.get_vertex_buffer_list();
+                    auto vk_buffer_list = std::array<VkBuffer, MAX_BOUND_LIST_SIZE>{};
+                    XAR_THROW_IF(
+                        vertex_buffer_list.size() > vk_buffer_list.size(),
+                        error::XarException,
+                        "Number of vertex buffers {} exceeds the limit {}",
+                        vertex_buffer_list.size(),
+                        vk_buffer_list.size());
+                    std::ranges::transform(
+                        vertex_buffer_list,
+                        vk_buffer_list.begin(),
+                        from_native_handle<VkBuffer>);
+
+                    static_assert(std::is_same_v<VkDeviceSize, std::uint64_t>);
+                    vkCmdBindVertexBuffers(
+                        vk_command_buffer,
+                        command.first_slot,
+                        command.vertex_buffer_counts,
+                        vk_buffer_list.data(),
+                        command.get_vertex_buffer_offset_list().data());
+                },
+                [vk_command_buffer](const api::command::SetIndexBuffer& command)
+                {
+                    vkCmdBindIndexBuffer(
+                        vk_command_buffer,
+                        from_native_handle<VkBuffer>(command.index_buffer),
+                        command.byte_offset,
+                        VK_INDEX_TYPE_UINT32);
+                },
+                [vk_command_buffer](const api::command::PushConstants& command)
+                {
+                    vkCmdPushConstants(
+                        vk_command_buffer,
+                        from_native_handle<VkPipelineLayout>(command.pipeline_layout),
+                        backend::vulkan::to_vk_shader_stage(command.shader_type),
+                        command.byte_offset,
+                        command.byte_size,
+                        command.get_data().data());
+                },
+                [vk_command_buffer](const api::command::DrawIndexed& command)
+                {
+                    vkCmdDrawIndexed(
+                        vk_command_buffer,
+                        command.index_counts,
+                        command.instance_counts,
+                        command.first_index,
+                        command.vertex_offset,
+                        command.first_instance);
+                },
+            });
+    }
+
+    api::NativeGraphicsPipeline IVulkanGraphicsPipelineUnit::get_native_graphics_pipeline(const api::GraphicsPipelineReference& graphics_pipeline) const
+    {
+        const auto& vulkan_graphics_pipeline = get_state().vulkan_resource_storage.get(graphics_pipeline);
+
+        return api::NativeGraphicsPipeline{
+            backend::vulkan::to_native_handle(vulkan_graphics_pipeline.get_native()),
+            backend::vulkan::to_native_handle(vulkan_graphics_pipeline.get_native_pipeline_layout()),
+        };
+    }
+}
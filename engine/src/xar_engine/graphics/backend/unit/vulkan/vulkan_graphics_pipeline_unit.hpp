@@ -22,5 +22,10 @@ namespace xar_engine::graphics::backend::unit::vulkan
         void set_index_buffer(const SetIndexBufferParameters& parameters) override;
         void push_constants(const PushConstantsParameters& parameters) override;
         void draw_indexed(const DrawIndexedParameters& parameters) override;
+
+        void execute_command_list(const ExecuteCommandListParameters& parameters) override;
+
+        [[nodiscard]]
+        api::NativeGraphicsPipeline get_native_graphics_pipeline(const api::GraphicsPipelineReference& graphics_pipeline) const override;
     };
 }
\ No newline at end of file
@@ -1,10 +1,26 @@
 #include <xar_engine/graphics/backend/unit/vulkan/vulkan_image_unit.hpp>
 
+#include <algorithm>
+#include <functional>
+
 #include <xar_engine/graphics/backend/vulkan/vulkan_type_converters.hpp>
 
 
 namespace xar_engine::graphics::backend::unit::vulkan
 {
+    namespace
+    {
+        template <typename... Ts>
+        std::size_t hash_values(const Ts& ... values)
+        {
+            auto seed = std::size_t{0};
+            ((seed ^= std::hash<Ts>{}(values) + 0x9e3779b9 + (seed << 6) + (seed >> 2)), ...);
+
+            return seed;
+        }
+    }
+
+
     api::ImageReference IVulkanImageUnit::make_image(const MakeImageParameters& parameters)
     {
         auto vk_image_usage = 0;
@@ -61,19 +77,55 @@ namespace xar_engine::graphics::backend::unit::vulkan
 
     api::SamplerReference IVulkanImageUnit::make_sampler(const MakeSamplerParameters& parameters)
     {
-        return get_state().vulkan_resource_storage.add(
+        auto lock = std::lock_guard{_sampler_cache_mutex};
+
+        const auto cached_sampler_iter = _sampler_cache.find(parameters);
+        if (cached_sampler_iter != _sampler_cache.end())
+        {
+            return cached_sampler_iter->second;
+        }
+
+        const auto max_device_anisotropy =
+            get_state().vulkan_device.get_native_physical_device().get_vk_device_properties().limits.maxSamplerAnisotropy;
+
+        auto sampler_ref = get_state().vulkan_resource_storage.add(
             native::vulkan::VulkanSampler{
                 {
                     get_state().vulkan_device,
-                    get_state().vulkan_device.get_native_physical_device().get_vk_device_properties().limits.maxSamplerAnisotropy,
-                    parameters.mip_levels,
+                    backend::vulkan::to_vk_filter(parameters.magnification_filter),
+                    backend::vulkan::to_vk_filter(parameters.minification_filter),
+                    backend::vulkan::to_vk_sampler_mipmap_mode(parameters.mip_map_mode),
+                    backend::vulkan::to_vk_sampler_address_mode(parameters.address_mode_u),
+                    backend::vulkan::to_vk_sampler_address_mode(parameters.address_mode_v),
+                    backend::vulkan::to_vk_sampler_address_mode(parameters.address_mode_w),
+                    parameters.anisotropy_enabled,
+                    std::clamp(
+                        parameters.max_anisotropy,
+                        1.0f,
+                        max_device_anisotropy),
+                    parameters.min_lod,
+                    parameters.max_lod,
                 }
             });
+
+        _sampler_cache.emplace(
+            parameters,
+            sampler_ref);
+
+        return sampler_ref;
+    }
+
+    void IVulkanImageUnit::clear_image(const ClearImageParameters& parameters)
+    {
+        get_state().vulkan_resource_storage.get(parameters.image).clear(get_state().vulkan_resource_storage.get(parameters.command_buffer).get_native());
     }
 
     void IVulkanImageUnit::generate_image_mip_maps(const GenerateImageMipMapsParameters& parameters)
     {
-        get_state().vulkan_resource_storage.get(parameters.image).generate_mipmaps(get_state().vulkan_resource_storage.get(parameters.command_buffer).get_native());
+        get_state().vulkan_resource_storage.get(parameters.image).generate_mipmaps(
+            get_state().vulkan_resource_storage.get(parameters.command_buffer).get_native(),
+            parameters.region_offset,
+            parameters.region_extent);
     }
 
     void IVulkanImageUnit::transit_image_layout(const TransitImageLayoutParameters& parameters)
@@ -91,6 +143,11 @@ namespace xar_engine::graphics::backend::unit::vulkan
                 new_vk_image_layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
                 break;
             }
+            case api::EImageLayout::SHADER_READ_ONLY:
+            {
+                new_vk_image_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                break;
+            }
             default:
             {
                 new_vk_image_layout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -102,4 +159,19 @@ namespace xar_engine::graphics::backend::unit::vulkan
             get_state().vulkan_resource_storage.get(parameters.command_buffer).get_native(),
             new_vk_image_layout);
     }
+
+    std::size_t IVulkanImageUnit::MakeSamplerParametersHash::operator()(const MakeSamplerParameters& parameters) const
+    {
+        return hash_values(
+            parameters.magnification_filter,
+            parameters.minification_filter,
+            parameters.mip_map_mode,
+            parameters.address_mode_u,
+            parameters.address_mode_v,
+            parameters.address_mode_w,
+            parameters.anisotropy_enabled,
+            parameters.max_anisotropy,
+            parameters.min_lod,
+            parameters.max_lod);
+    }
 }
\ No newline at end of file
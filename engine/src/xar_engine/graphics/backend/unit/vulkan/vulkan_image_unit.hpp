@@ -1,5 +1,8 @@
 #pragma once
 
+#include <mutex>
+#include <unordered_map>
+
 #include <xar_engine/graphics/backend/unit/image_unit.hpp>
 
 #include <xar_engine/graphics/backend/vulkan/vulkan_graphics_backend_state.hpp>
@@ -18,7 +21,18 @@ namespace xar_engine::graphics::backend::unit::vulkan
         api::ImageViewReference make_image_view(const MakeImageViewParameters& parameters) override;
         api::SamplerReference make_sampler(const MakeSamplerParameters& parameters) override;
 
+        void clear_image(const ClearImageParameters& parameters) override;
         void generate_image_mip_maps(const GenerateImageMipMapsParameters& parameters) override;
         void transit_image_layout(const TransitImageLayoutParameters& parameters) override;
+
+    private:
+        struct MakeSamplerParametersHash
+        {
+            std::size_t operator()(const MakeSamplerParameters& parameters) const;
+        };
+
+    private:
+        std::mutex _sampler_cache_mutex;
+        std::unordered_map<MakeSamplerParameters, api::SamplerReference, MakeSamplerParametersHash> _sampler_cache;
     };
 }
\ No newline at end of file
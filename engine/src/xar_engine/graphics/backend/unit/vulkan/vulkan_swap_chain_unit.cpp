@@ -172,4 +172,14 @@ namespace xar_engine::graphics::backend::unit::vulkan
 
         return backend::vulkan::to_swap_chain_result(result.vk_result);
     }
+
+    math::Vector2u32 IVulkanSwapChainUnit::get_swap_chain_extent(const api::SwapChainReference& swap_chain) const
+    {
+        const auto vk_extent = get_state().vulkan_resource_storage.get(swap_chain).get_vk_extent();
+
+        return math::Vector2u32{
+            vk_extent.width,
+            vk_extent.height,
+        };
+    }
 }
\ No newline at end of file
@@ -20,5 +20,8 @@ namespace xar_engine::graphics::backend::unit::vulkan
         void begin_rendering(const BeginRenderingParameters& parameters) override;
         void end_rendering(const EndRenderingParameters& parameters) override;
         api::ESwapChainResult end_frame(const EndFrameParameters& parameters) override;
+
+        [[nodiscard]]
+        math::Vector2u32 get_swap_chain_extent(const api::SwapChainReference& swap_chain) const override;
     };
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <xar_engine/meta/resource_map.hpp>
+#include <xar_engine/meta/concurrent_resource_map.hpp>
 
 #include <xar_engine/graphics/api/buffer_reference.hpp>
 #include <xar_engine/graphics/api/command_buffer_reference.hpp>
@@ -34,45 +34,46 @@
 
 namespace xar_engine::graphics::backend::vulkan
 {
+    // Backend units create, look up and release resources from any thread, see TConcurrentResourceMap.
     class VulkanResourceStorage
-        : public meta::TResourceMap<api::BufferTag, native::vulkan::VulkanBuffer>
-          , public meta::TResourceMap<api::CommandBufferTag, native::vulkan::VulkanCommandBuffer>
-          , public meta::TResourceMap<api::DescriptorPoolTag, native::vulkan::VulkanDescriptorPool>
-          , public meta::TResourceMap<api::DescriptorSetTag, native::vulkan::VulkanDescriptorSet>
-          , public meta::TResourceMap<api::DescriptorSetLayoutTag, native::vulkan::VulkanDescriptorSetLayout>
-          , public meta::TResourceMap<api::GrahicsPipelineTag, native::vulkan::VulkanGraphicsPipeline>
-          , public meta::TResourceMap<api::ImageTag, native::vulkan::VulkanImage>
-          , public meta::TResourceMap<api::ImageViewTag, native::vulkan::VulkanImageView>
-          , public meta::TResourceMap<api::QueueTag, native::vulkan::VulkanQueue>
-          , public meta::TResourceMap<api::SamplerTag, native::vulkan::VulkanSampler>
-          , public meta::TResourceMap<api::ShaderTag, native::vulkan::VulkanShader>
-          , public meta::TResourceMap<api::SwapChainTag, native::vulkan::VulkanSwapChain>
+        : public meta::TConcurrentResourceMap<api::BufferTag, native::vulkan::VulkanBuffer>
+          , public meta::TConcurrentResourceMap<api::CommandBufferTag, native::vulkan::VulkanCommandBuffer>
+          , public meta::TConcurrentResourceMap<api::DescriptorPoolTag, native::vulkan::VulkanDescriptorPool>
+          , public meta::TConcurrentResourceMap<api::DescriptorSetTag, native::vulkan::VulkanDescriptorSet>
+          , public meta::TConcurrentResourceMap<api::DescriptorSetLayoutTag, native::vulkan::VulkanDescriptorSetLayout>
+          , public meta::TConcurrentResourceMap<api::GrahicsPipelineTag, native::vulkan::VulkanGraphicsPipeline>
+          , public meta::TConcurrentResourceMap<api::ImageTag, native::vulkan::VulkanImage>
+          , public meta::TConcurrentResourceMap<api::ImageViewTag, native::vulkan::VulkanImageView>
+          , public meta::TConcurrentResourceMap<api::QueueTag, native::vulkan::VulkanQueue>
+          , public meta::TConcurrentResourceMap<api::SamplerTag, native::vulkan::VulkanSampler>
+          , public meta::TConcurrentResourceMap<api::ShaderTag, native::vulkan::VulkanShader>
+          , public meta::TConcurrentResourceMap<api::SwapChainTag, native::vulkan::VulkanSwapChain>
     {
     public:
-        using meta::TResourceMap<api::BufferTag, native::vulkan::VulkanBuffer>::get;
-        using meta::TResourceMap<api::CommandBufferTag, native::vulkan::VulkanCommandBuffer>::get;
-        using meta::TResourceMap<api::DescriptorPoolTag, native::vulkan::VulkanDescriptorPool>::get;
-        using meta::TResourceMap<api::DescriptorSetTag, native::vulkan::VulkanDescriptorSet>::get;
-        using meta::TResourceMap<api::DescriptorSetLayoutTag, native::vulkan::VulkanDescriptorSetLayout>::get;
-        using meta::TResourceMap<api::GrahicsPipelineTag, native::vulkan::VulkanGraphicsPipeline>::get;
-        using meta::TResourceMap<api::ImageTag, native::vulkan::VulkanImage>::get;
-        using meta::TResourceMap<api::ImageViewTag, native::vulkan::VulkanImageView>::get;
-        using meta::TResourceMap<api::QueueTag, native::vulkan::VulkanQueue>::get;
-        using meta::TResourceMap<api::SamplerTag, native::vulkan::VulkanSampler>::get;
-        using meta::TResourceMap<api::ShaderTag, native::vulkan::VulkanShader>::get;
-        using meta::TResourceMap<api::SwapChainTag, native::vulkan::VulkanSwapChain>::get;
+        using meta::TConcurrentResourceMap<api::BufferTag, native::vulkan::VulkanBuffer>::get;
+        using meta::TConcurrentResourceMap<api::CommandBufferTag, native::vulkan::VulkanCommandBuffer>::get;
+        using meta::TConcurrentResourceMap<api::DescriptorPoolTag, native::vulkan::VulkanDescriptorPool>::get;
+        using meta::TConcurrentResourceMap<api::DescriptorSetTag, native::vulkan::VulkanDescriptorSet>::get;
+        using meta::TConcurrentResourceMap<api::DescriptorSetLayoutTag, native::vulkan::VulkanDescriptorSetLayout>::get;
+        using meta::TConcurrentResourceMap<api::GrahicsPipelineTag, native::vulkan::VulkanGraphicsPipeline>::get;
+        using meta::TConcurrentResourceMap<api::ImageTag, native::vulkan::VulkanImage>::get;
+        using meta::TConcurrentResourceMap<api::ImageViewTag, native::vulkan::VulkanImageView>::get;
+        using meta::TConcurrentResourceMap<api::QueueTag, native::vulkan::VulkanQueue>::get;
+        using meta::TConcurrentResourceMap<api::SamplerTag, native::vulkan::VulkanSampler>::get;
+        using meta::TConcurrentResourceMap<api::ShaderTag, native::vulkan::VulkanShader>::get;
+        using meta::TConcurrentResourceMap<api::SwapChainTag, native::vulkan::VulkanSwapChain>::get;
 
-        using meta::TResourceMap<api::BufferTag, native::vulkan::VulkanBuffer>::add;
-        using meta::TResourceMap<api::CommandBufferTag, native::vulkan::VulkanCommandBuffer>::add;
-        using meta::TResourceMap<api::DescriptorPoolTag, native::vulkan::VulkanDescriptorPool>::add;
-        using meta::TResourceMap<api::DescriptorSetTag, native::vulkan::VulkanDescriptorSet>::add;
-        using meta::TResourceMap<api::DescriptorSetLayoutTag, native::vulkan::VulkanDescriptorSetLayout>::add;
-        using meta::TResourceMap<api::GrahicsPipelineTag, native::vulkan::VulkanGraphicsPipeline>::add;
-        using meta::TResourceMap<api::ImageTag, native::vulkan::VulkanImage>::add;
-        using meta::TResourceMap<api::ImageViewTag, native::vulkan::VulkanImageView>::add;
-        using meta::TResourceMap<api::QueueTag, native::vulkan::VulkanQueue>::add;
-        using meta::TResourceMap<api::SamplerTag, native::vulkan::VulkanSampler>::add;
-        using meta::TResourceMap<api::ShaderTag, native::vulkan::VulkanShader>::add;
-        using meta::TResourceMap<api::SwapChainTag, native::vulkan::VulkanSwapChain>::add;
+        using meta::TConcurrentResourceMap<api::BufferTag, native::vulkan::VulkanBuffer>::add;
+        using meta::TConcurrentResourceMap<api::CommandBufferTag, native::vulkan::VulkanCommandBuffer>::add;
+        using meta::TConcurrentResourceMap<api::DescriptorPoolTag, native::vulkan::VulkanDescriptorPool>::add;
+        using meta::TConcurrentResourceMap<api::DescriptorSetTag, native::vulkan::VulkanDescriptorSet>::add;
+        using meta::TConcurrentResourceMap<api::DescriptorSetLayoutTag, native::vulkan::VulkanDescriptorSetLayout>::add;
+        using meta::TConcurrentResourceMap<api::GrahicsPipelineTag, native::vulkan::VulkanGraphicsPipeline>::add;
+        using meta::TConcurrentResourceMap<api::ImageTag, native::vulkan::VulkanImage>::add;
+        using meta::TConcurrentResourceMap<api::ImageViewTag, native::vulkan::VulkanImageView>::add;
+        using meta::TConcurrentResourceMap<api::QueueTag, native::vulkan::VulkanQueue>::add;
+        using meta::TConcurrentResourceMap<api::SamplerTag, native::vulkan::VulkanSampler>::add;
+        using meta::TConcurrentResourceMap<api::ShaderTag, native::vulkan::VulkanShader>::add;
+        using meta::TConcurrentResourceMap<api::SwapChainTag, native::vulkan::VulkanSwapChain>::add;
     };
 }
\ No newline at end of file
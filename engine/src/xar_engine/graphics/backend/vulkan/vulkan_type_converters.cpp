@@ -13,6 +13,10 @@ namespace xar_engine::graphics::backend::vulkan
             {
                 return VK_FORMAT_D32_SFLOAT;
             }
+            case api::EFormat::R16G16B16A16_SIGNED_FLOAT:
+            {
+                return VK_FORMAT_R16G16B16A16_SFLOAT;
+            }
             case api::EFormat::R32G32_SIGNED_FLOAT:
             {
                 return VK_FORMAT_R32G32_SFLOAT;
@@ -53,6 +57,74 @@ namespace xar_engine::graphics::backend::vulkan
             static_cast<std::uint32_t>(image_aspect));
     }
 
+    VkFilter to_vk_filter(const api::ESamplerFilter sampler_filter)
+    {
+        switch (sampler_filter)
+        {
+            case api::ESamplerFilter::NEAREST:
+            {
+                return VK_FILTER_NEAREST;
+            }
+            case api::ESamplerFilter::LINEAR:
+            {
+                return VK_FILTER_LINEAR;
+            }
+        }
+
+        XAR_THROW(
+            error::XarException,
+            "ESamplerFilter value {} is not supported",
+            static_cast<std::uint32_t>(sampler_filter));
+    }
+
+    VkSamplerMipmapMode to_vk_sampler_mipmap_mode(const api::ESamplerMipMapMode sampler_mip_map_mode)
+    {
+        switch (sampler_mip_map_mode)
+        {
+            case api::ESamplerMipMapMode::NEAREST:
+            {
+                return VK_SAMPLER_MIPMAP_MODE_NEAREST;
+            }
+            case api::ESamplerMipMapMode::LINEAR:
+            {
+                return VK_SAMPLER_MIPMAP_MODE_LINEAR;
+            }
+        }
+
+        XAR_THROW(
+            error::XarException,
+            "ESamplerMipMapMode value {} is not supported",
+            static_cast<std::uint32_t>(sampler_mip_map_mode));
+    }
+
+    VkSamplerAddressMode to_vk_sampler_address_mode(const api::ESamplerAddressMode sampler_address_mode)
+    {
+        switch (sampler_address_mode)
+        {
+            case api::ESamplerAddressMode::REPEAT:
+            {
+                return VK_SAMPLER_ADDRESS_MODE_REPEAT;
+            }
+            case api::ESamplerAddressMode::MIRRORED_REPEAT:
+            {
+                return VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+            }
+            case api::ESamplerAddressMode::CLAMP_TO_EDGE:
+            {
+                return VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+            }
+            case api::ESamplerAddressMode::CLAMP_TO_BORDER:
+            {
+                return VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+            }
+        }
+
+        XAR_THROW(
+            error::XarException,
+            "ESamplerAddressMode value {} is not supported",
+            static_cast<std::uint32_t>(sampler_address_mode));
+    }
+
     std::vector<VkVertexInputBindingDescription> to_vk_vertex_input_binding_description(const std::vector<api::VertexInputBinding>& vertex_input_binding_list)
     {
         auto vk_vertex_input_binding_list = std::vector<VkVertexInputBindingDescription>(vertex_input_binding_list.size());
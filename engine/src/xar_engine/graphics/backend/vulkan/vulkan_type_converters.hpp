@@ -1,12 +1,16 @@
 #pragma once
 
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 #include <volk.h>
 
+#include <xar_engine/graphics/api/command_list.hpp>
 #include <xar_engine/graphics/api/format.hpp>
 #include <xar_engine/graphics/api/graphics_pipeline_reference.hpp>
 #include <xar_engine/graphics/api/image_reference.hpp>
+#include <xar_engine/graphics/api/sampler_reference.hpp>
 #include <xar_engine/graphics/api/shader_reference.hpp>
 #include <xar_engine/graphics/api/swap_chain_reference.hpp>
 
@@ -17,6 +21,12 @@ namespace xar_engine::graphics::backend::vulkan
 
     VkImageAspectFlagBits to_vk_image_aspec(api::EImageAspect image_aspect);
 
+    VkFilter to_vk_filter(api::ESamplerFilter sampler_filter);
+
+    VkSamplerMipmapMode to_vk_sampler_mipmap_mode(api::ESamplerMipMapMode sampler_mip_map_mode);
+
+    VkSamplerAddressMode to_vk_sampler_address_mode(api::ESamplerAddressMode sampler_address_mode);
+
     std::vector<VkVertexInputBindingDescription> to_vk_vertex_input_binding_description(const std::vector<api::VertexInputBinding>& vertex_input_binding_list);
 
     std::vector<VkVertexInputAttributeDescription> to_vk_vertex_input_attribute_description(const std::vector<api::VertexInputAttribute>& vertex_input_attribute_list);
@@ -25,4 +35,32 @@ namespace xar_engine::graphics::backend::vulkan
 
 
     api::ESwapChainResult to_swap_chain_result(VkResult vk_result);
+
+
+    // Non-dispatchable handles are pointers on 64-bit targets and uint64_t on 32-bit ones.
+    template <typename TVkHandle>
+    api::NativeHandle to_native_handle(const TVkHandle vk_handle)
+    {
+        if constexpr (std::is_pointer_v<TVkHandle>)
+        {
+            return static_cast<api::NativeHandle>(reinterpret_cast<std::uintptr_t>(vk_handle));
+        }
+        else
+        {
+            return static_cast<api::NativeHandle>(vk_handle);
+        }
+    }
+
+    template <typename TVkHandle>
+    TVkHandle from_native_handle(const api::NativeHandle native_handle)
+    {
+        if constexpr (std::is_pointer_v<TVkHandle>)
+        {
+            return reinterpret_cast<TVkHandle>(static_cast<std::uintptr_t>(native_handle));
+        }
+        else
+        {
+            return static_cast<TVkHandle>(native_handle);
+        }
+    }
 }
\ No newline at end of file
@@ -19,6 +19,8 @@ namespace xar_engine::graphics::native::vulkan
         VkDeviceMemory vk_device_memory;
         VkDeviceSize vk_byte_size;
 
+        void* persistent_mapped_data;
+
     private:
         void cleanup();
     };
@@ -28,6 +30,7 @@ namespace xar_engine::graphics::native::vulkan
         , vk_buffer{nullptr}
         , vk_device_memory{nullptr}
         , vk_byte_size{parameters.vk_byte_size}
+        , persistent_mapped_data{nullptr}
     {
         try
         {
@@ -90,6 +93,14 @@ namespace xar_engine::graphics::native::vulkan
 
     void VulkanBuffer::State::cleanup()
     {
+        if (persistent_mapped_data)
+        {
+            vkUnmapMemory(
+                vulkan_device.get_native(),
+                vk_device_memory);
+            persistent_mapped_data = nullptr;
+        }
+
         if (vk_buffer)
         {
             vkDestroyBuffer(
@@ -124,6 +135,11 @@ namespace xar_engine::graphics::native::vulkan
 
     void* VulkanBuffer::map()
     {
+        if (_state->persistent_mapped_data)
+        {
+            return _state->persistent_mapped_data;
+        }
+
         void* data_pointer = nullptr;
 
         vkMapMemory(
@@ -139,11 +155,39 @@ namespace xar_engine::graphics::native::vulkan
 
     void VulkanBuffer::unmap()
     {
+        if (_state->persistent_mapped_data)
+        {
+            return;
+        }
+
         vkUnmapMemory(
             _state->vulkan_device.get_native(),
             _state->vk_device_memory);
     }
 
+    std::span<std::uint8_t> VulkanBuffer::map_persistently()
+    {
+        if (!_state->persistent_mapped_data)
+        {
+            const auto vk_map_memory_result = vkMapMemory(
+                _state->vulkan_device.get_native(),
+                _state->vk_device_memory,
+                0,
+                _state->vk_byte_size,
+                0,
+                &_state->persistent_mapped_data);
+            XAR_THROW_IF(
+                vk_map_memory_result != VK_SUCCESS,
+                error::XarException,
+                "vkMapMemory failed");
+        }
+
+        return {
+            static_cast<std::uint8_t*>(_state->persistent_mapped_data),
+            static_cast<std::size_t>(_state->vk_byte_size)
+        };
+    }
+
     VkBuffer VulkanBuffer::get_native() const
     {
         return _state->vk_buffer;
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 #include <volk.h>
 
@@ -25,6 +26,10 @@ namespace xar_engine::graphics::native::vulkan
         void* map();
         void unmap();
 
+        // Keeps the memory mapped until the buffer is destroyed, map() and unmap() then reuse this mapping.
+        [[nodiscard]]
+        std::span<std::uint8_t> map_persistently();
+
 
         [[nodiscard]]
         VkBuffer get_native() const;
@@ -22,11 +22,24 @@ namespace xar_engine::graphics::native::vulkan
         : vulkan_device(parameters.vulkan_device)
         , vk_descriptor_set_layout(nullptr)
     {
+        XAR_THROW_IF(
+            parameters.vk_descriptor_binding_flags_list.size() != parameters.vk_descriptor_set_layout_binding_list.size(),
+            error::XarException,
+            "Descriptor binding flags counts {} differs from binding counts {}",
+            parameters.vk_descriptor_binding_flags_list.size(),
+            parameters.vk_descriptor_set_layout_binding_list.size());
+
+        auto vk_descriptor_set_layout_binding_flags_create_info = VkDescriptorSetLayoutBindingFlagsCreateInfo{};
+        vk_descriptor_set_layout_binding_flags_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        vk_descriptor_set_layout_binding_flags_create_info.bindingCount = static_cast<std::uint32_t>(parameters.vk_descriptor_binding_flags_list.size());
+        vk_descriptor_set_layout_binding_flags_create_info.pBindingFlags = parameters.vk_descriptor_binding_flags_list.data();
+
         auto vk_descriptor_set_layout_create_info = VkDescriptorSetLayoutCreateInfo{};
         vk_descriptor_set_layout_create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
         vk_descriptor_set_layout_create_info.bindingCount = static_cast<std::uint32_t>(parameters.vk_descriptor_set_layout_binding_list.size());
         vk_descriptor_set_layout_create_info.pBindings = parameters.vk_descriptor_set_layout_binding_list.data();
         vk_descriptor_set_layout_create_info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+        vk_descriptor_set_layout_create_info.pNext = &vk_descriptor_set_layout_binding_flags_create_info;
 
         const auto vk_create_descriptor_set_layout_result = vkCreateDescriptorSetLayout(
             vulkan_device.get_native(),
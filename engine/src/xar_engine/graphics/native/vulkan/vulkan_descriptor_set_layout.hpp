@@ -36,5 +36,6 @@ namespace xar_engine::graphics::native::vulkan
     {
         VulkanDevice vulkan_device;
         std::vector<VkDescriptorSetLayoutBinding> vk_descriptor_set_layout_binding_list;
+        std::vector<VkDescriptorBindingFlags> vk_descriptor_binding_flags_list;
     };
 }
\ No newline at end of file
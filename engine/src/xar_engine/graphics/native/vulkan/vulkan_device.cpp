@@ -55,6 +55,9 @@ namespace xar_engine::graphics::native::vulkan
         features12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
         features12.runtimeDescriptorArray = VK_TRUE;
         features12.descriptorIndexing = VK_TRUE;
+        features12.descriptorBindingPartiallyBound = VK_TRUE;
+        features12.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        features12.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
 
         auto vk_physical_device_dynamic_rendering_features_khr = VkPhysicalDeviceDynamicRenderingFeaturesKHR{};
         vk_physical_device_dynamic_rendering_features_khr.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
@@ -178,6 +178,15 @@ namespace xar_engine::graphics::native::vulkan
             vk_source_pipeline_stage_flags = VK_PIPELINE_STAGE_TRANSFER_BIT;
             vk_destination_pipeline_stage_flags = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
         }
+        else if (_state->vk_image_layout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL &&
+                 new_vk_image_layout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+        {
+            vk_image_memory_barrier.srcAccessMask = 0;
+            vk_image_memory_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+            vk_source_pipeline_stage_flags = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            vk_destination_pipeline_stage_flags = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        }
         else if (_state->vk_image_layout == VK_IMAGE_LAYOUT_UNDEFINED &&
                  new_vk_image_layout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL)
         {
@@ -212,8 +221,50 @@ namespace xar_engine::graphics::native::vulkan
             &vk_image_memory_barrier);
     }
 
-    void VulkanImage::generate_mipmaps(VkCommandBuffer vk_command_buffer)
+    void VulkanImage::clear(VkCommandBuffer vk_command_buffer)
+    {
+        XAR_THROW_IF(
+            _state->vk_image_layout != VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            error::XarException,
+            "Image must be in transfer destination layout to be cleared but is in {}",
+            static_cast<std::uint32_t>(_state->vk_image_layout));
+
+        const auto vk_clear_color_value = VkClearColorValue{};
+
+        auto vk_image_subresource_range = VkImageSubresourceRange{};
+        vk_image_subresource_range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        vk_image_subresource_range.baseMipLevel = 0;
+        vk_image_subresource_range.levelCount = _state->mip_levels;
+        vk_image_subresource_range.baseArrayLayer = 0;
+        vk_image_subresource_range.layerCount = 1;
+
+        vkCmdClearColorImage(
+            vk_command_buffer,
+            _state->vk_image,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            &vk_clear_color_value,
+            1,
+            &vk_image_subresource_range);
+    }
+
+    // Only the region of every mip level is regenerated, the rest of the image keeps its content.
+    void VulkanImage::generate_mipmaps(
+        VkCommandBuffer vk_command_buffer,
+        const math::Vector2u32 region_offset,
+        const math::Vector2u32 region_extent)
     {
+        XAR_THROW_IF(
+            region_offset.x + region_extent.x > _state->dimension.x ||
+            region_offset.y + region_extent.y > _state->dimension.y,
+            error::XarException,
+            "Mip map region {}x{} at {}x{} is outside of image {}x{}",
+            region_extent.x,
+            region_extent.y,
+            region_offset.x,
+            region_offset.y,
+            _state->dimension.x,
+            _state->dimension.y);
+
         const auto vk_format_properties = _state->device.get_native_physical_device().get_vk_format_properties(_state->vk_format);
         XAR_THROW_IF(
             !(vk_format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT),
@@ -231,8 +282,10 @@ namespace xar_engine::graphics::native::vulkan
         vk_image_memory_barrier.subresourceRange.layerCount = 1;
         vk_image_memory_barrier.subresourceRange.levelCount = 1;
 
-        auto mip_width = static_cast<std::int32_t>(_state->dimension.x);
-        auto mip_height = static_cast<std::int32_t>(_state->dimension.y);
+        auto mip_x = static_cast<std::int32_t>(region_offset.x);
+        auto mip_y = static_cast<std::int32_t>(region_offset.y);
+        auto mip_width = static_cast<std::int32_t>(region_extent.x);
+        auto mip_height = static_cast<std::int32_t>(region_extent.y);
 
         for (auto mip_level = std::uint32_t{1}; mip_level < _state->mip_levels; mip_level++)
         {
@@ -254,15 +307,20 @@ namespace xar_engine::graphics::native::vulkan
                 1,
                 &vk_image_memory_barrier);
 
+            const auto next_mip_x = mip_x / 2;
+            const auto next_mip_y = mip_y / 2;
+            const auto next_mip_width = mip_width > 1 ? mip_width / 2 : 1;
+            const auto next_mip_height = mip_height > 1 ? mip_height / 2 : 1;
+
             auto vk_image_blit = VkImageBlit{};
-            vk_image_blit.srcOffsets[0] = {0, 0, 0};
-            vk_image_blit.srcOffsets[1] = {mip_width, mip_height, 1};
+            vk_image_blit.srcOffsets[0] = {mip_x, mip_y, 0};
+            vk_image_blit.srcOffsets[1] = {mip_x + mip_width, mip_y + mip_height, 1};
             vk_image_blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             vk_image_blit.srcSubresource.mipLevel = mip_level - 1;
             vk_image_blit.srcSubresource.baseArrayLayer = 0;
             vk_image_blit.srcSubresource.layerCount = 1;
-            vk_image_blit.dstOffsets[0] = {0, 0, 0};
-            vk_image_blit.dstOffsets[1] = {mip_width > 1 ? mip_width / 2 : 1, mip_height > 1 ? mip_height / 2 : 1, 1};
+            vk_image_blit.dstOffsets[0] = {next_mip_x, next_mip_y, 0};
+            vk_image_blit.dstOffsets[1] = {next_mip_x + next_mip_width, next_mip_y + next_mip_height, 1};
             vk_image_blit.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             vk_image_blit.dstSubresource.mipLevel = mip_level;
             vk_image_blit.dstSubresource.baseArrayLayer = 0;
@@ -295,14 +353,10 @@ namespace xar_engine::graphics::native::vulkan
                 1,
                 &vk_image_memory_barrier);
 
-            if (mip_width > 1)
-            {
-                mip_width /= 2;
-            }
-            if (mip_height > 1)
-            {
-                mip_height /= 2;
-            }
+            mip_x = next_mip_x;
+            mip_y = next_mip_y;
+            mip_width = next_mip_width;
+            mip_height = next_mip_height;
         }
 
         vk_image_memory_barrier.subresourceRange.baseMipLevel = _state->mip_levels - 1;
@@ -322,6 +376,8 @@ namespace xar_engine::graphics::native::vulkan
             nullptr,
             1,
             &vk_image_memory_barrier);
+
+        _state->vk_image_layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     }
 
     VkImage VulkanImage::get_native() const
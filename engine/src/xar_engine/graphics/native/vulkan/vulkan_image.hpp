@@ -27,7 +27,12 @@ namespace xar_engine::graphics::native::vulkan
             VkCommandBuffer vk_command_buffer,
             VkImageLayout new_vk_image_layout);
 
-        void generate_mipmaps(VkCommandBuffer vk_command_buffer);
+        void clear(VkCommandBuffer vk_command_buffer);
+
+        void generate_mipmaps(
+            VkCommandBuffer vk_command_buffer,
+            math::Vector2u32 region_offset,
+            math::Vector2u32 region_extent);
 
 
         [[nodiscard]]
@@ -21,6 +21,7 @@ namespace xar_engine::graphics::native::vulkan
     public:
         VkPhysicalDevice vk_physical_device;
         VkPhysicalDeviceProperties vk_physical_device_properties;
+        VkPhysicalDeviceDescriptorIndexingProperties vk_physical_device_descriptor_indexing_properties;
         VkPhysicalDeviceFeatures vk_physical_device_features;
         std::vector<VkQueueFamilyProperties> vk_queue_family_properties_list;
         std::vector<VkExtensionProperties> vk_device_extension_properties_list;
@@ -29,6 +30,7 @@ namespace xar_engine::graphics::native::vulkan
     VulkanPhysicalDevice::State::State(const Parameters& parameters)
         : vk_physical_device{parameters.vk_physical_device}
         , vk_physical_device_properties{}
+        , vk_physical_device_descriptor_indexing_properties{}
         , vk_physical_device_features{}
         , vk_queue_family_properties_list{}
         , vk_device_extension_properties_list{}
@@ -37,6 +39,15 @@ namespace xar_engine::graphics::native::vulkan
             vk_physical_device,
             &vk_physical_device_properties);
 
+        vk_physical_device_descriptor_indexing_properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+
+        auto vk_physical_device_properties_2 = VkPhysicalDeviceProperties2{};
+        vk_physical_device_properties_2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        vk_physical_device_properties_2.pNext = &vk_physical_device_descriptor_indexing_properties;
+        vkGetPhysicalDeviceProperties2(
+            vk_physical_device,
+            &vk_physical_device_properties_2);
+
         vkGetPhysicalDeviceFeatures(
             vk_physical_device,
             &vk_physical_device_features);
@@ -134,6 +145,11 @@ namespace xar_engine::graphics::native::vulkan
         return _state->vk_physical_device_properties;
     }
 
+    const VkPhysicalDeviceDescriptorIndexingProperties& VulkanPhysicalDevice::get_vk_descriptor_indexing_properties() const
+    {
+        return _state->vk_physical_device_descriptor_indexing_properties;
+    }
+
     const VkPhysicalDeviceFeatures& VulkanPhysicalDevice::get_vk_device_features() const
     {
         return _state->vk_physical_device_features;
@@ -25,6 +25,9 @@ namespace xar_engine::graphics::native::vulkan
         [[nodiscard]]
         const VkPhysicalDeviceProperties& get_vk_device_properties() const;
 
+        [[nodiscard]]
+        const VkPhysicalDeviceDescriptorIndexingProperties& get_vk_descriptor_indexing_properties() const;
+
         [[nodiscard]]
         const VkPhysicalDeviceFeatures& get_vk_device_features() const;
 
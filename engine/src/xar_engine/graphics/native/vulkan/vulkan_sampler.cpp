@@ -24,21 +24,21 @@ namespace xar_engine::graphics::native::vulkan
     {
         auto vk_sampler_create_info = VkSamplerCreateInfo{};
         vk_sampler_create_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-        vk_sampler_create_info.magFilter = VK_FILTER_LINEAR;
-        vk_sampler_create_info.minFilter = VK_FILTER_LINEAR;
-        vk_sampler_create_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        vk_sampler_create_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        vk_sampler_create_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-        vk_sampler_create_info.anisotropyEnable = VK_TRUE;
+        vk_sampler_create_info.magFilter = parameters.vk_magnification_filter;
+        vk_sampler_create_info.minFilter = parameters.vk_minification_filter;
+        vk_sampler_create_info.addressModeU = parameters.vk_sampler_address_mode_u;
+        vk_sampler_create_info.addressModeV = parameters.vk_sampler_address_mode_v;
+        vk_sampler_create_info.addressModeW = parameters.vk_sampler_address_mode_w;
+        vk_sampler_create_info.anisotropyEnable = parameters.anisotropy_enabled ? VK_TRUE : VK_FALSE;
         vk_sampler_create_info.maxAnisotropy = parameters.max_anisotropy;
         vk_sampler_create_info.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
         vk_sampler_create_info.unnormalizedCoordinates = VK_FALSE;
         vk_sampler_create_info.compareEnable = VK_FALSE;
         vk_sampler_create_info.compareOp = VK_COMPARE_OP_ALWAYS;
-        vk_sampler_create_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+        vk_sampler_create_info.mipmapMode = parameters.vk_sampler_mipmap_mode;
         vk_sampler_create_info.mipLodBias = 0.0f;
-        vk_sampler_create_info.minLod = 0;
-        vk_sampler_create_info.maxLod = static_cast<float>(parameters.max_lod);
+        vk_sampler_create_info.minLod = parameters.min_lod;
+        vk_sampler_create_info.maxLod = parameters.max_lod;
 
         const auto vk_create_sampler_result = vkCreateSampler(
             vulkan_device.get_native(),
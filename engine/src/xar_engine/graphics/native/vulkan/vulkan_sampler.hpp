@@ -34,7 +34,15 @@ namespace xar_engine::graphics::native::vulkan
     struct VulkanSampler::Parameters
     {
         VulkanDevice vulkan_device;
+        VkFilter vk_magnification_filter;
+        VkFilter vk_minification_filter;
+        VkSamplerMipmapMode vk_sampler_mipmap_mode;
+        VkSamplerAddressMode vk_sampler_address_mode_u;
+        VkSamplerAddressMode vk_sampler_address_mode_v;
+        VkSamplerAddressMode vk_sampler_address_mode_w;
+        bool anisotropy_enabled;
         float max_anisotropy;
+        float min_lod;
         float max_lod;
     };
 }
\ No newline at end of file
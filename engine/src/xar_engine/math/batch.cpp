@@ -0,0 +1,1052 @@
+#include <xar_engine/math/batch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <span>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/math/simd.hpp>
+
+#include <xar_engine/os/cpu_features.hpp>
+
+
+// Code between a push and the matching pop is built for the given instruction set whatever the build flags are,
+// so one binary carries every kernel copy. MSVC accepts every intrinsic without target flags.
+#define XAR_ENGINE_MATH_PRAGMA(text) _Pragma(#text)
+
+#if defined(__clang__)
+    #define XAR_ENGINE_MATH_PUSH_TARGET(instruction_set) \
+        XAR_ENGINE_MATH_PRAGMA(clang attribute push(__attribute__((target(instruction_set))), apply_to = function))
+    #define XAR_ENGINE_MATH_POP_TARGET() XAR_ENGINE_MATH_PRAGMA(clang attribute pop)
+#elif defined(__GNUC__)
+    #define XAR_ENGINE_MATH_PUSH_TARGET(instruction_set) \
+        XAR_ENGINE_MATH_PRAGMA(GCC push_options) XAR_ENGINE_MATH_PRAGMA(GCC target(instruction_set))
+    #define XAR_ENGINE_MATH_POP_TARGET() XAR_ENGINE_MATH_PRAGMA(GCC pop_options)
+#else
+    #define XAR_ENGINE_MATH_PUSH_TARGET(instruction_set)
+    #define XAR_ENGINE_MATH_POP_TARGET()
+#endif
+
+
+namespace xar_engine::math
+{
+    namespace
+    {
+        // Smallest chunk worth a task, smaller inputs run on the calling thread.
+        constexpr auto PARALLEL_CHUNK_ELEMENT_COUNT = std::size_t{16 * 1024};
+
+        template <typename TFunction>
+        void run_in_chunks(
+            thread::ThreadPool& thread_pool,
+            const std::size_t element_count,
+            const TFunction& function)
+        {
+            const auto chunk_count = (element_count + PARALLEL_CHUNK_ELEMENT_COUNT - 1) / PARALLEL_CHUNK_ELEMENT_COUNT;
+            if (chunk_count <= 1)
+            {
+                function(
+                    0,
+                    element_count);
+                return;
+            }
+
+            thread_pool.parallel_for(
+                chunk_count,
+                [&](const std::size_t chunk_index)
+                {
+                    const auto begin = chunk_index * PARALLEL_CHUNK_ELEMENT_COUNT;
+                    function(
+                        begin,
+                        std::min(
+                            begin + PARALLEL_CHUNK_ELEMENT_COUNT,
+                            element_count));
+                });
+        }
+
+        // Lane types run one kernel body at different widths: the lane type of each instruction set covers full
+        // groups of elements and ScalarLane finishes the tail, so every kernel is written once.
+        struct ScalarLane
+        {
+            using Value = float;
+            using Mask = bool;
+
+            static constexpr auto WIDTH = std::size_t{1};
+
+            static Value load(const float* data) { return *data; }
+            static void store(float* data, const Value value) { *data = value; }
+            static Value broadcast(const float value) { return value; }
+            static void load_interleaved(const float* data, Value& x, Value& y, Value& z) { x = data[0]; y = data[1]; z = data[2]; }
+
+            static Value add(const Value left, const Value right) { return left + right; }
+            static Value subtract(const Value left, const Value right) { return left - right; }
+            static Value multiply(const Value left, const Value right) { return left * right; }
+            static Value divide(const Value left, const Value right) { return left / right; }
+            static Value min(const Value left, const Value right) { return std::min(left, right); }
+            static Value max(const Value left, const Value right) { return std::max(left, right); }
+            static Value absolute(const Value value) { return std::abs(value); }
+
+            static Mask less(const Value left, const Value right) { return left < right; }
+            static Mask less_equal(const Value left, const Value right) { return left <= right; }
+            static Mask logical_and(const Mask left, const Mask right) { return left && right; }
+            static Value select(const Mask mask, const Value if_true, const Value if_false) { return mask ? if_true : if_false; }
+            static std::uint32_t get_mask_bits(const Mask mask) { return mask ? 1u : 0u; }
+        };
+
+
+        void validate_sizes(
+            const ConstVector3fSoaSpan& input_list,
+            const Vector3fSoaSpan& result_list)
+        {
+            const auto size = input_list.x.size();
+            XAR_THROW_IF(
+                input_list.y.size() != size || input_list.z.size() != size ||
+                result_list.x.size() != size || result_list.y.size() != size || result_list.z.size() != size,
+                error::XarException,
+                "Structure-of-arrays spans have different sizes");
+        }
+
+        template <typename TSpan>
+        void validate_sizes(
+            std::initializer_list<TSpan> span_list,
+            const std::size_t result_size)
+        {
+            for (const auto& span: span_list)
+            {
+                XAR_THROW_IF(
+                    span.size() != result_size,
+                    error::XarException,
+                    "Structure-of-arrays span has {} elements but result list has {}",
+                    span.size(),
+                    result_size);
+            }
+        }
+
+        void validate_sizes(
+            const AabbSoaSpan& aabb_list,
+            const std::size_t result_size)
+        {
+            validate_sizes(
+                {aabb_list.min_x, aabb_list.min_y, aabb_list.min_z, aabb_list.max_x, aabb_list.max_y, aabb_list.max_z},
+                result_size);
+        }
+
+        void validate_sizes(
+            const BoundingSphereSoaSpan& sphere_list,
+            const std::size_t result_size)
+        {
+            validate_sizes(
+                {sphere_list.center_x, sphere_list.center_y, sphere_list.center_z, sphere_list.radius},
+                result_size);
+        }
+
+        void validate_sizes(
+            const TriangleSoaSpan& triangle_list,
+            const std::size_t result_size)
+        {
+            validate_sizes(
+                {
+                    triangle_list.vertex_0_x, triangle_list.vertex_0_y, triangle_list.vertex_0_z,
+                    triangle_list.vertex_1_x, triangle_list.vertex_1_y, triangle_list.vertex_1_z,
+                    triangle_list.vertex_2_x, triangle_list.vertex_2_y, triangle_list.vertex_2_z,
+                },
+                result_size);
+        }
+
+
+        // Range kernels of one instruction set, every batch call goes through the table of the batch instruction set.
+        struct BatchKernelTable
+        {
+            kernel::EInstructionSet instruction_set;
+
+            void (*transform_points)(
+                const ConstVector3fSoaSpan& point_list,
+                const Matrix4x4f& matrix,
+                const Vector3fSoaSpan& result_list,
+                std::size_t begin,
+                std::size_t end);
+            void (*transform_vectors)(
+                const ConstVector3fSoaSpan& vector_list,
+                const Matrix4x4f& matrix,
+                const Vector3fSoaSpan& result_list,
+                std::size_t begin,
+                std::size_t end);
+            void (*cull_aabbs)(
+                const Frustum& frustum,
+                const AabbSoaSpan& aabb_list,
+                std::span<std::uint8_t> visible_list,
+                std::size_t begin,
+                std::size_t end);
+            void (*cull_spheres)(
+                const Frustum& frustum,
+                const BoundingSphereSoaSpan& sphere_list,
+                std::span<std::uint8_t> visible_list,
+                std::size_t begin,
+                std::size_t end);
+            void (*intersect_aabbs)(
+                const Aabb& aabb,
+                const AabbSoaSpan& aabb_list,
+                std::span<std::uint8_t> overlap_list,
+                std::size_t begin,
+                std::size_t end);
+            void (*intersect_ray_aabbs)(
+                const Ray& ray,
+                const AabbSoaSpan& aabb_list,
+                std::span<float> distance_list,
+                std::size_t begin,
+                std::size_t end);
+            void (*intersect_ray_triangles)(
+                const Ray& ray,
+                const TriangleSoaSpan& triangle_list,
+                std::span<float> distance_list,
+                std::size_t begin,
+                std::size_t end);
+            Aabb (*compute_aabb)(std::span<const Vector3f> point_list);
+            float (*compute_max_distance_squared)(
+                std::span<const Vector3f> point_list,
+                const Vector3f& point);
+        };
+    }
+}
+
+
+// One copy of the range kernels per instruction set, a copy only runs after get_cpu_features reported its
+// instruction set.
+namespace xar_engine::math::batch_scalar
+{
+    namespace
+    {
+        constexpr auto INSTRUCTION_SET = kernel::EInstructionSet::SCALAR;
+
+        using WideLane = ScalarLane;
+    }
+}
+
+#define XAR_ENGINE_MATH_BATCH_NAMESPACE batch_scalar
+#include <xar_engine/math/batch_kernels.hpp>
+#undef XAR_ENGINE_MATH_BATCH_NAMESPACE
+
+#if defined(XAR_ENGINE_MATH_SSE)
+XAR_ENGINE_MATH_PUSH_TARGET("sse4.2")
+namespace xar_engine::math::batch_sse4_2
+{
+    namespace
+    {
+        constexpr auto INSTRUCTION_SET = kernel::EInstructionSet::SSE4_2;
+
+        struct SseLane
+        {
+            using Value = __m128;
+            using Mask = __m128;
+
+            static constexpr auto WIDTH = std::size_t{4};
+
+            static Value load(const float* data) { return _mm_loadu_ps(data); }
+            static void store(float* data, const Value value) { _mm_storeu_ps(data, value); }
+            static Value broadcast(const float value) { return _mm_set1_ps(value); }
+            static void load_interleaved(const float* data, Value& x, Value& y, Value& z)
+            {
+                x = _mm_setr_ps(data[0], data[3], data[6], data[9]);
+                y = _mm_setr_ps(data[1], data[4], data[7], data[10]);
+                z = _mm_setr_ps(data[2], data[5], data[8], data[11]);
+            }
+
+            static Value add(const Value left, const Value right) { return _mm_add_ps(left, right); }
+            static Value subtract(const Value left, const Value right) { return _mm_sub_ps(left, right); }
+            static Value multiply(const Value left, const Value right) { return _mm_mul_ps(left, right); }
+            static Value divide(const Value left, const Value right) { return _mm_div_ps(left, right); }
+            static Value min(const Value left, const Value right) { return _mm_min_ps(left, right); }
+            static Value max(const Value left, const Value right) { return _mm_max_ps(left, right); }
+            static Value absolute(const Value value) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), value); }
+
+            static Mask less(const Value left, const Value right) { return _mm_cmplt_ps(left, right); }
+            static Mask less_equal(const Value left, const Value right) { return _mm_cmple_ps(left, right); }
+            static Mask logical_and(const Mask left, const Mask right) { return _mm_and_ps(left, right); }
+            static Value select(const Mask mask, const Value if_true, const Value if_false)
+            {
+                return _mm_blendv_ps(if_false, if_true, mask);
+            }
+            static std::uint32_t get_mask_bits(const Mask mask)
+            {
+                return static_cast<std::uint32_t>(_mm_movemask_ps(mask));
+            }
+        };
+
+        using WideLane = SseLane;
+    }
+}
+
+#define XAR_ENGINE_MATH_BATCH_NAMESPACE batch_sse4_2
+#include <xar_engine/math/batch_kernels.hpp>
+#undef XAR_ENGINE_MATH_BATCH_NAMESPACE
+XAR_ENGINE_MATH_POP_TARGET()
+
+XAR_ENGINE_MATH_PUSH_TARGET("avx2")
+namespace xar_engine::math::batch_avx2
+{
+    namespace
+    {
+        constexpr auto INSTRUCTION_SET = kernel::EInstructionSet::AVX2;
+
+        struct Avx2Lane
+        {
+            using Value = __m256;
+            using Mask = __m256;
+
+            static constexpr auto WIDTH = std::size_t{8};
+
+            static Value load(const float* data) { return _mm256_loadu_ps(data); }
+            static void store(float* data, const Value value) { _mm256_storeu_ps(data, value); }
+            static Value broadcast(const float value) { return _mm256_set1_ps(value); }
+            static void load_interleaved(const float* data, Value& x, Value& y, Value& z)
+            {
+                const auto index = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+                x = _mm256_i32gather_ps(data, index, sizeof(float));
+                y = _mm256_i32gather_ps(data + 1, index, sizeof(float));
+                z = _mm256_i32gather_ps(data + 2, index, sizeof(float));
+            }
+
+            static Value add(const Value left, const Value right) { return _mm256_add_ps(left, right); }
+            static Value subtract(const Value left, const Value right) { return _mm256_sub_ps(left, right); }
+            static Value multiply(const Value left, const Value right) { return _mm256_mul_ps(left, right); }
+            static Value divide(const Value left, const Value right) { return _mm256_div_ps(left, right); }
+            static Value min(const Value left, const Value right) { return _mm256_min_ps(left, right); }
+            static Value max(const Value left, const Value right) { return _mm256_max_ps(left, right); }
+            static Value absolute(const Value value) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value); }
+
+            static Mask less(const Value left, const Value right) { return _mm256_cmp_ps(left, right, _CMP_LT_OQ); }
+            static Mask less_equal(const Value left, const Value right) { return _mm256_cmp_ps(left, right, _CMP_LE_OQ); }
+            static Mask logical_and(const Mask left, const Mask right) { return _mm256_and_ps(left, right); }
+            static Value select(const Mask mask, const Value if_true, const Value if_false)
+            {
+                return _mm256_blendv_ps(if_false, if_true, mask);
+            }
+            static std::uint32_t get_mask_bits(const Mask mask)
+            {
+                return static_cast<std::uint32_t>(_mm256_movemask_ps(mask));
+            }
+        };
+
+        using WideLane = Avx2Lane;
+    }
+}
+
+#define XAR_ENGINE_MATH_BATCH_NAMESPACE batch_avx2
+#include <xar_engine/math/batch_kernels.hpp>
+#undef XAR_ENGINE_MATH_BATCH_NAMESPACE
+XAR_ENGINE_MATH_POP_TARGET()
+
+XAR_ENGINE_MATH_PUSH_TARGET("avx512f")
+namespace xar_engine::math::batch_avx512
+{
+    namespace
+    {
+        constexpr auto INSTRUCTION_SET = kernel::EInstructionSet::AVX512;
+
+        // Comparisons produce a bit per lane in an opmask register instead of a full vector.
+        struct Avx512Lane
+        {
+            using Value = __m512;
+            using Mask = __mmask16;
+
+            static constexpr auto WIDTH = std::size_t{16};
+            // The masked forms of gather, min and max avoid the undefined source operand GCC 12 warns about.
+            static constexpr auto ALL_LANES = Mask{0xffff};
+
+            static Value load(const float* data) { return _mm512_loadu_ps(data); }
+            static void store(float* data, const Value value) { _mm512_storeu_ps(data, value); }
+            static Value broadcast(const float value) { return _mm512_set1_ps(value); }
+            static void load_interleaved(const float* data, Value& x, Value& y, Value& z)
+            {
+                const auto index = _mm512_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45);
+                x = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), ALL_LANES, index, data, sizeof(float));
+                y = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), ALL_LANES, index, data + 1, sizeof(float));
+                z = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), ALL_LANES, index, data + 2, sizeof(float));
+            }
+
+            static Value add(const Value left, const Value right) { return _mm512_add_ps(left, right); }
+            static Value subtract(const Value left, const Value right) { return _mm512_sub_ps(left, right); }
+            static Value multiply(const Value left, const Value right) { return _mm512_mul_ps(left, right); }
+            static Value divide(const Value left, const Value right) { return _mm512_div_ps(left, right); }
+            static Value min(const Value left, const Value right) { return _mm512_maskz_min_ps(ALL_LANES, left, right); }
+            static Value max(const Value left, const Value right) { return _mm512_maskz_max_ps(ALL_LANES, left, right); }
+            static Value absolute(const Value value) { return _mm512_abs_ps(value); }
+
+            static Mask less(const Value left, const Value right) { return _mm512_cmp_ps_mask(left, right, _CMP_LT_OQ); }
+            static Mask less_equal(const Value left, const Value right) { return _mm512_cmp_ps_mask(left, right, _CMP_LE_OQ); }
+            static Mask logical_and(const Mask left, const Mask right) { return static_cast<Mask>(left & right); }
+            static Value select(const Mask mask, const Value if_true, const Value if_false)
+            {
+                return _mm512_mask_blend_ps(mask, if_false, if_true);
+            }
+            static std::uint32_t get_mask_bits(const Mask mask) { return mask; }
+        };
+
+        using WideLane = Avx512Lane;
+    }
+}
+
+#define XAR_ENGINE_MATH_BATCH_NAMESPACE batch_avx512
+#include <xar_engine/math/batch_kernels.hpp>
+#undef XAR_ENGINE_MATH_BATCH_NAMESPACE
+XAR_ENGINE_MATH_POP_TARGET()
+#elif defined(XAR_ENGINE_MATH_NEON)
+namespace xar_engine::math::batch_neon
+{
+    namespace
+    {
+        constexpr auto INSTRUCTION_SET = kernel::EInstructionSet::NEON;
+
+        struct NeonLane
+        {
+            using Value = float32x4_t;
+            using Mask = uint32x4_t;
+
+            static constexpr auto WIDTH = std::size_t{4};
+
+            static Value load(const float* data) { return vld1q_f32(data); }
+            static void store(float* data, const Value value) { vst1q_f32(data, value); }
+            static Value broadcast(const float value) { return vdupq_n_f32(value); }
+            static void load_interleaved(const float* data, Value& x, Value& y, Value& z)
+            {
+                const auto value = vld3q_f32(data);
+                x = value.val[0];
+                y = value.val[1];
+                z = value.val[2];
+            }
+
+            static Value add(const Value left, const Value right) { return vaddq_f32(left, right); }
+            static Value subtract(const Value left, const Value right) { return vsubq_f32(left, right); }
+            static Value multiply(const Value left, const Value right) { return vmulq_f32(left, right); }
+            static Value divide(const Value left, const Value right) { return vdivq_f32(left, right); }
+            static Value min(const Value left, const Value right) { return vminq_f32(left, right); }
+            static Value max(const Value left, const Value right) { return vmaxq_f32(left, right); }
+            static Value absolute(const Value value) { return vabsq_f32(value); }
+
+            static Mask less(const Value left, const Value right) { return vcltq_f32(left, right); }
+            static Mask less_equal(const Value left, const Value right) { return vcleq_f32(left, right); }
+            static Mask logical_and(const Mask left, const Mask right) { return vandq_u32(left, right); }
+            static Value select(const Mask mask, const Value if_true, const Value if_false) { return vbslq_f32(mask, if_true, if_false); }
+            static std::uint32_t get_mask_bits(const Mask mask)
+            {
+                const auto bit_list = uint32x4_t{1u, 2u, 4u, 8u};
+                return vaddvq_u32(vandq_u32(mask, bit_list));
+            }
+        };
+
+        using WideLane = NeonLane;
+    }
+}
+
+#define XAR_ENGINE_MATH_BATCH_NAMESPACE batch_neon
+#include <xar_engine/math/batch_kernels.hpp>
+#undef XAR_ENGINE_MATH_BATCH_NAMESPACE
+#endif
+
+
+namespace xar_engine::math
+{
+    namespace
+    {
+        // Returns nullptr when the build or the processor lacks the instruction set.
+        const BatchKernelTable* find_kernel_table(const kernel::EInstructionSet instruction_set)
+        {
+            [[maybe_unused]] const auto& cpu_features = os::get_cpu_features();
+
+            switch (instruction_set)
+            {
+                case kernel::EInstructionSet::SCALAR:
+                {
+                    return &batch_scalar::KERNEL_TABLE;
+                }
+            #if defined(XAR_ENGINE_MATH_SSE)
+                case kernel::EInstructionSet::SSE4_2:
+                {
+                    return cpu_features.has_sse4_2 ? &batch_sse4_2::KERNEL_TABLE : nullptr;
+                }
+                case kernel::EInstructionSet::AVX2:
+                {
+                    return cpu_features.has_avx2 ? &batch_avx2::KERNEL_TABLE : nullptr;
+                }
+                case kernel::EInstructionSet::AVX512:
+                {
+                    return cpu_features.has_avx512f ? &batch_avx512::KERNEL_TABLE : nullptr;
+                }
+            #elif defined(XAR_ENGINE_MATH_NEON)
+                case kernel::EInstructionSet::NEON:
+                {
+                    return cpu_features.has_neon ? &batch_neon::KERNEL_TABLE : nullptr;
+                }
+            #endif
+                default:
+                {
+                    return nullptr;
+                }
+            }
+        }
+
+        const BatchKernelTable* find_widest_kernel_table()
+        {
+            for (const auto instruction_set: {
+                     kernel::EInstructionSet::AVX512,
+                     kernel::EInstructionSet::AVX2,
+                     kernel::EInstructionSet::SSE4_2,
+                     kernel::EInstructionSet::NEON,
+                 })
+            {
+                if (const auto* const kernel_table = find_kernel_table(instruction_set))
+                {
+                    return kernel_table;
+                }
+            }
+
+            return &batch_scalar::KERNEL_TABLE;
+        }
+
+        std::atomic<const BatchKernelTable*>& get_kernel_table_slot()
+        {
+            static auto kernel_table = std::atomic<const BatchKernelTable*>{find_widest_kernel_table()};
+            return kernel_table;
+        }
+
+        const BatchKernelTable& get_kernel_table()
+        {
+            return *get_kernel_table_slot().load(std::memory_order_relaxed);
+        }
+
+
+        void multiply_matrix_range(
+            const Matrix4x4f& left,
+            std::span<const Matrix4x4f> right_list,
+            std::span<Matrix4x4f> result_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            for (auto index = begin; index < end; ++index)
+            {
+                result_list[index] = kernel::simd::multiply_matrix(
+                    left,
+                    right_list[index]);
+            }
+        }
+
+        // Arvo's method: every result axis starts at the translation and adds, for each source axis, the smaller
+        // and the larger of the matrix column scaled by the box min and max.
+        void transform_aabb_range(
+            std::span<const Aabb> aabb_list,
+            const Matrix4x4f& matrix,
+            std::span<Aabb> result_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            const auto& column_list = matrix.as_column_list;
+
+        #if defined(XAR_ENGINE_MATH_SSE)
+            const __m128 sse_column_list[4] = {
+                kernel::simd::detail::load(column_list[0]),
+                kernel::simd::detail::load(column_list[1]),
+                kernel::simd::detail::load(column_list[2]),
+                kernel::simd::detail::load(column_list[3]),
+            };
+
+            for (auto index = begin; index < end; ++index)
+            {
+                const auto& aabb = aabb_list[index];
+                const float source_min_list[3] = {aabb.min.x, aabb.min.y, aabb.min.z};
+                const float source_max_list[3] = {aabb.max.x, aabb.max.y, aabb.max.z};
+
+                auto result_min = sse_column_list[3];
+                auto result_max = sse_column_list[3];
+                for (auto axis = 0; axis < 3; ++axis)
+                {
+                    const auto from_min = _mm_mul_ps(
+                        sse_column_list[axis],
+                        _mm_set1_ps(source_min_list[axis]));
+                    const auto from_max = _mm_mul_ps(
+                        sse_column_list[axis],
+                        _mm_set1_ps(source_max_list[axis]));
+
+                    result_min = _mm_add_ps(
+                        result_min,
+                        _mm_min_ps(
+                            from_min,
+                            from_max));
+                    result_max = _mm_add_ps(
+                        result_max,
+                        _mm_max_ps(
+                            from_min,
+                            from_max));
+                }
+
+                const auto min = kernel::simd::detail::store(result_min);
+                const auto max = kernel::simd::detail::store(result_max);
+                result_list[index] = {
+                    {min.x, min.y, min.z},
+                    {max.x, max.y, max.z},
+                };
+            }
+        #else
+            for (auto index = begin; index < end; ++index)
+            {
+                const auto& aabb = aabb_list[index];
+                const float source_min_list[3] = {aabb.min.x, aabb.min.y, aabb.min.z};
+                const float source_max_list[3] = {aabb.max.x, aabb.max.y, aabb.max.z};
+
+                float result_min_list[3] = {column_list[3].x, column_list[3].y, column_list[3].z};
+                float result_max_list[3] = {column_list[3].x, column_list[3].y, column_list[3].z};
+                for (auto axis = 0; axis < 3; ++axis)
+                {
+                    for (auto row = 0; row < 3; ++row)
+                    {
+                        const auto from_min = column_list[axis][row] * source_min_list[axis];
+                        const auto from_max = column_list[axis][row] * source_max_list[axis];
+
+                        result_min_list[row] += std::min(
+                            from_min,
+                            from_max);
+                        result_max_list[row] += std::max(
+                            from_min,
+                            from_max);
+                    }
+                }
+
+                result_list[index] = {
+                    {result_min_list[0], result_min_list[1], result_min_list[2]},
+                    {result_max_list[0], result_max_list[1], result_max_list[2]},
+                };
+            }
+        #endif
+        }
+    }
+
+
+    kernel::EInstructionSet get_batch_instruction_set()
+    {
+        return get_kernel_table().instruction_set;
+    }
+
+    bool is_batch_instruction_set_supported(const kernel::EInstructionSet instruction_set)
+    {
+        return find_kernel_table(instruction_set) != nullptr;
+    }
+
+    void set_batch_instruction_set(const kernel::EInstructionSet instruction_set)
+    {
+        const auto* const kernel_table = find_kernel_table(instruction_set);
+        XAR_THROW_IF(
+            kernel_table == nullptr,
+            error::XarException,
+            "Batch instruction set {} is not supported by this build or processor",
+            meta::enum_to_string(instruction_set));
+
+        get_kernel_table_slot().store(
+            kernel_table,
+            std::memory_order_relaxed);
+    }
+
+
+    void transform_points(
+        std::span<const Vector3f> point_list,
+        const Matrix4x4f& matrix,
+        std::span<Vector3f> result_list)
+    {
+        XAR_THROW_IF(
+            point_list.size() != result_list.size(),
+            error::XarException,
+            "Point list has {} elements but result list has {}",
+            point_list.size(),
+            result_list.size());
+
+        for (auto index = std::size_t{0}; index < point_list.size(); ++index)
+        {
+            result_list[index] = transform_point(
+                matrix,
+                point_list[index]);
+        }
+    }
+
+    void transform_points(
+        const ConstVector3fSoaSpan& point_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list)
+    {
+        validate_sizes(
+            point_list,
+            result_list);
+
+        get_kernel_table().transform_points(
+            point_list,
+            matrix,
+            result_list,
+            0,
+            point_list.x.size());
+    }
+
+    void transform_points(
+        const ConstVector3fSoaSpan& point_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list,
+        thread::ThreadPool& thread_pool)
+    {
+        validate_sizes(
+            point_list,
+            result_list);
+
+        const auto& kernel_table = get_kernel_table();
+        run_in_chunks(
+            thread_pool,
+            point_list.x.size(),
+            [&](const std::size_t begin, const std::size_t end)
+            {
+                kernel_table.transform_points(
+                    point_list,
+                    matrix,
+                    result_list,
+                    begin,
+                    end);
+            });
+    }
+
+
+    void transform_vectors(
+        std::span<const Vector3f> vector_list,
+        const Matrix4x4f& matrix,
+        std::span<Vector3f> result_list)
+    {
+        XAR_THROW_IF(
+            vector_list.size() != result_list.size(),
+            error::XarException,
+            "Vector list has {} elements but result list has {}",
+            vector_list.size(),
+            result_list.size());
+
+        for (auto index = std::size_t{0}; index < vector_list.size(); ++index)
+        {
+            result_list[index] = transform_vector(
+                matrix,
+                vector_list[index]);
+        }
+    }
+
+    void transform_vectors(
+        const ConstVector3fSoaSpan& vector_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list)
+    {
+        validate_sizes(
+            vector_list,
+            result_list);
+
+        get_kernel_table().transform_vectors(
+            vector_list,
+            matrix,
+            result_list,
+            0,
+            vector_list.x.size());
+    }
+
+    void transform_vectors(
+        const ConstVector3fSoaSpan& vector_list,
+        const Matrix4x4f& matrix,
+        const Vector3fSoaSpan& result_list,
+        thread::ThreadPool& thread_pool)
+    {
+        validate_sizes(
+            vector_list,
+            result_list);
+
+        const auto& kernel_table = get_kernel_table();
+        run_in_chunks(
+            thread_pool,
+            vector_list.x.size(),
+            [&](const std::size_t begin, const std::size_t end)
+            {
+                kernel_table.transform_vectors(
+                    vector_list,
+                    matrix,
+                    result_list,
+                    begin,
+                    end);
+            });
+    }
+
+
+    void multiply_matrices(
+        std::span<const Matrix4x4f> left_list,
+        std::span<const Matrix4x4f> right_list,
+        std::span<Matrix4x4f> result_list)
+    {
+        XAR_THROW_IF(
+            left_list.size() != right_list.size() || left_list.size() != result_list.size(),
+            error::XarException,
+            "Matrix lists have different sizes: {}, {} and {}",
+            left_list.size(),
+            right_list.size(),
+            result_list.size());
+
+        for (auto index = std::size_t{0}; index < left_list.size(); ++index)
+        {
+            result_list[index] = kernel::simd::multiply_matrix(
+                left_list[index],
+                right_list[index]);
+        }
+    }
+
+    void multiply_matrices(
+        const Matrix4x4f& left,
+        std::span<const Matrix4x4f> right_list,
+        std::span<Matrix4x4f> result_list)
+    {
+        XAR_THROW_IF(
+            right_list.size() != result_list.size(),
+            error::XarException,
+            "Matrix list has {} elements but result list has {}",
+            right_list.size(),
+            result_list.size());
+
+        multiply_matrix_range(
+            left,
+            right_list,
+            result_list,
+            0,
+            right_list.size());
+    }
+
+    void multiply_matrices(
+        const Matrix4x4f& left,
+        std::span<const Matrix4x4f> right_list,
+        std::span<Matrix4x4f> result_list,
+        thread::ThreadPool& thread_pool)
+    {
+        XAR_THROW_IF(
+            right_list.size() != result_list.size(),
+            error::XarException,
+            "Matrix list has {} elements but result list has {}",
+            right_list.size(),
+            result_list.size());
+
+        run_in_chunks(
+            thread_pool,
+            right_list.size(),
+            [&](const std::size_t begin, const std::size_t end)
+            {
+                multiply_matrix_range(
+                    left,
+                    right_list,
+                    result_list,
+                    begin,
+                    end);
+            });
+    }
+
+
+    void transform_aabbs(
+        std::span<const Aabb> aabb_list,
+        const Matrix4x4f& matrix,
+        std::span<Aabb> result_list)
+    {
+        XAR_THROW_IF(
+            aabb_list.size() != result_list.size(),
+            error::XarException,
+            "Box list has {} elements but result list has {}",
+            aabb_list.size(),
+            result_list.size());
+
+        transform_aabb_range(
+            aabb_list,
+            matrix,
+            result_list,
+            0,
+            aabb_list.size());
+    }
+
+    void transform_aabbs(
+        std::span<const Aabb> aabb_list,
+        const Matrix4x4f& matrix,
+        std::span<Aabb> result_list,
+        thread::ThreadPool& thread_pool)
+    {
+        XAR_THROW_IF(
+            aabb_list.size() != result_list.size(),
+            error::XarException,
+            "Box list has {} elements but result list has {}",
+            aabb_list.size(),
+            result_list.size());
+
+        run_in_chunks(
+            thread_pool,
+            aabb_list.size(),
+            [&](const std::size_t begin, const std::size_t end)
+            {
+                transform_aabb_range(
+                    aabb_list,
+                    matrix,
+                    result_list,
+                    begin,
+                    end);
+            });
+    }
+
+
+    Aabb compute_aabb(std::span<const Vector3f> point_list)
+    {
+        XAR_THROW_IF(
+            point_list.empty(),
+            error::XarException,
+            "Point list is empty");
+
+        return get_kernel_table().compute_aabb(point_list);
+    }
+
+    float compute_max_distance_squared(
+        std::span<const Vector3f> point_list,
+        const Vector3f& point)
+    {
+        return get_kernel_table().compute_max_distance_squared(
+            point_list,
+            point);
+    }
+
+
+    void cull_aabbs(
+        const Frustum& frustum,
+        const AabbSoaSpan& aabb_list,
+        std::span<std::uint8_t> visible_list)
+    {
+        validate_sizes(
+            aabb_list,
+            visible_list.size());
+
+        get_kernel_table().cull_aabbs(
+            frustum,
+            aabb_list,
+            visible_list,
+            0,
+            visible_list.size());
+    }
+
+    void cull_aabbs(
+        const Frustum& frustum,
+        const AabbSoaSpan& aabb_list,
+        std::span<std::uint8_t> visible_list,
+        thread::ThreadPool& thread_pool)
+    {
+        validate_sizes(
+            aabb_list,
+            visible_list.size());
+
+        const auto& kernel_table = get_kernel_table();
+        run_in_chunks(
+            thread_pool,
+            visible_list.size(),
+            [&](const std::size_t begin, const std::size_t end)
+            {
+                kernel_table.cull_aabbs(
+                    frustum,
+                    aabb_list,
+                    visible_list,
+                    begin,
+                    end);
+            });
+    }
+
+
+    void cull_spheres(
+        const Frustum& frustum,
+        const BoundingSphereSoaSpan& sphere_list,
+        std::span<std::uint8_t> visible_list)
+    {
+        validate_sizes(
+            sphere_list,
+            visible_list.size());
+
+        get_kernel_table().cull_spheres(
+            frustum,
+            sphere_list,
+            visible_list,
+            0,
+            visible_list.size());
+    }
+
+    void cull_spheres(
+        const Frustum& frustum,
+        const BoundingSphereSoaSpan& sphere_list,
+        std::span<std::uint8_t> visible_list,
+        thread::ThreadPool& thread_pool)
+    {
+        validate_sizes(
+            sphere_list,
+            visible_list.size());
+
+        const auto& kernel_table = get_kernel_table();
+        run_in_chunks(
+            thread_pool,
+            visible_list.size(),
+            [&](const std::size_t begin, const std::size_t end)
+            {
+                kernel_table.cull_spheres(
+                    frustum,
+                    sphere_list,
+                    visible_list,
+                    begin,
+                    end);
+            });
+    }
+
+
+    void intersect_aabbs(
+        const Aabb& aabb,
+        const AabbSoaSpan& aabb_list,
+        std::span<std::uint8_t> overlap_list)
+    {
+        validate_sizes(
+            aabb_list,
+            overlap_list.size());
+
+        get_kernel_table().intersect_aabbs(
+            aabb,
+            aabb_list,
+            overlap_list,
+            0,
+            overlap_list.size());
+    }
+
+
+    void intersect_ray(
+        const Ray& ray,
+        const AabbSoaSpan& aabb_list,
+        std::span<float> distance_list)
+    {
+        validate_sizes(
+            aabb_list,
+            distance_list.size());
+
+        get_kernel_table().intersect_ray_aabbs(
+            ray,
+            aabb_list,
+            distance_list,
+            0,
+            distance_list.size());
+    }
+
+    void intersect_ray(
+        const Ray& ray,
+        const TriangleSoaSpan& triangle_list,
+        std::span<float> distance_list)
+    {
+        validate_sizes(
+            triangle_list,
+            distance_list.size());
+
+        get_kernel_table().intersect_ray_triangles(
+            ray,
+            triangle_list,
+            distance_list,
+            0,
+            distance_list.size());
+    }
+}
@@ -0,0 +1,629 @@
+// Range kernels of the batch functions, written once against WideLane. batch.cpp includes this file once per
+// instruction set, each time inside the target of that instruction set and after defining WideLane and
+// INSTRUCTION_SET in namespace XAR_ENGINE_MATH_BATCH_NAMESPACE, so there is deliberately no include guard.
+// The helpers are marked inline, GCC otherwise keeps the ScalarLane ones out of line and the scalar table pays a
+// call per point.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include <xar_engine/math/batch.hpp>
+#include <xar_engine/math/geometry.hpp>
+
+
+namespace xar_engine::math::XAR_ENGINE_MATH_BATCH_NAMESPACE
+{
+    namespace
+    {
+        // Calls function.template operator()<TLane>(index) for consecutive lane groups covering [begin, end), with
+        // TLane = WideLane for full groups and ScalarLane for the tail.
+        template <typename TFunction>
+        inline void for_each_lane_group(
+            const std::size_t begin,
+            const std::size_t end,
+            const TFunction& function)
+        {
+            auto index = begin;
+            for (; index + WideLane::WIDTH <= end; index += WideLane::WIDTH)
+            {
+                function.template operator()<WideLane>(index);
+            }
+
+            for (; index < end; ++index)
+            {
+                function.template operator()<ScalarLane>(index);
+            }
+        }
+
+        template <typename TLane>
+        inline void store_mask(
+            const typename TLane::Mask mask,
+            std::uint8_t* const data)
+        {
+            const auto mask_bits = TLane::get_mask_bits(mask);
+            for (auto lane = std::size_t{0}; lane < TLane::WIDTH; ++lane)
+            {
+                data[lane] = static_cast<std::uint8_t>((mask_bits >> lane) & 1u);
+            }
+        }
+
+        template <typename TLane>
+        struct LaneVector3
+        {
+            typename TLane::Value x;
+            typename TLane::Value y;
+            typename TLane::Value z;
+        };
+
+        template <typename TLane>
+        inline LaneVector3<TLane> subtract(
+            const LaneVector3<TLane>& left,
+            const LaneVector3<TLane>& right)
+        {
+            return {
+                TLane::subtract(left.x, right.x),
+                TLane::subtract(left.y, right.y),
+                TLane::subtract(left.z, right.z),
+            };
+        }
+
+        template <typename TLane>
+        inline typename TLane::Value dot_product(
+            const LaneVector3<TLane>& left,
+            const LaneVector3<TLane>& right)
+        {
+            return TLane::add(
+                TLane::multiply(left.x, right.x),
+                TLane::add(
+                    TLane::multiply(left.y, right.y),
+                    TLane::multiply(left.z, right.z)));
+        }
+
+        template <typename TLane>
+        inline LaneVector3<TLane> cross_product(
+            const LaneVector3<TLane>& left,
+            const LaneVector3<TLane>& right)
+        {
+            return {
+                TLane::subtract(TLane::multiply(left.y, right.z), TLane::multiply(left.z, right.y)),
+                TLane::subtract(TLane::multiply(left.z, right.x), TLane::multiply(left.x, right.z)),
+                TLane::subtract(TLane::multiply(left.x, right.y), TLane::multiply(left.y, right.x)),
+            };
+        }
+
+        template <typename TLane>
+        inline LaneVector3<TLane> broadcast(const Vector3f& vector)
+        {
+            return {
+                TLane::broadcast(vector.x),
+                TLane::broadcast(vector.y),
+                TLane::broadcast(vector.z),
+            };
+        }
+
+        template <typename TLane>
+        inline LaneVector3<TLane> load(
+            std::span<const float> x_list,
+            std::span<const float> y_list,
+            std::span<const float> z_list,
+            const std::size_t index)
+        {
+            return {
+                TLane::load(x_list.data() + index),
+                TLane::load(y_list.data() + index),
+                TLane::load(z_list.data() + index),
+            };
+        }
+
+        template <typename TLane>
+        inline LaneVector3<TLane> load(
+            std::span<const Vector3f> vector_list,
+            const std::size_t index)
+        {
+            auto vector = LaneVector3<TLane>{};
+            TLane::load_interleaved(
+                &vector_list[index].x,
+                vector.x,
+                vector.y,
+                vector.z);
+
+            return vector;
+        }
+
+        template <typename TLane>
+        inline LaneVector3<TLane> min(
+            const LaneVector3<TLane>& left,
+            const LaneVector3<TLane>& right)
+        {
+            return {
+                TLane::min(left.x, right.x),
+                TLane::min(left.y, right.y),
+                TLane::min(left.z, right.z),
+            };
+        }
+
+        template <typename TLane>
+        inline LaneVector3<TLane> max(
+            const LaneVector3<TLane>& left,
+            const LaneVector3<TLane>& right)
+        {
+            return {
+                TLane::max(left.x, right.x),
+                TLane::max(left.y, right.y),
+                TLane::max(left.z, right.z),
+            };
+        }
+
+        // Folds the lanes of value into one float with function.
+        template <typename TLane, typename TFunction>
+        inline float reduce_lanes(
+            const typename TLane::Value value,
+            const TFunction& function)
+        {
+            float lane_list[TLane::WIDTH];
+            TLane::store(
+                lane_list,
+                value);
+
+            auto result = lane_list[0];
+            for (auto lane = std::size_t{1}; lane < TLane::WIDTH; ++lane)
+            {
+                result = function(
+                    result,
+                    lane_list[lane]);
+            }
+
+            return result;
+        }
+
+
+        // Transforms elements [begin, end) with w = 1 when TTranslate is set and w = 0 otherwise.
+        template <bool TTranslate>
+        void transform_soa(
+            const ConstVector3fSoaSpan& input_list,
+            const Matrix4x4f& matrix,
+            const Vector3fSoaSpan& result_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            const auto& column_list = matrix.as_column_list;
+            float* const result_data_list[3] = {result_list.x.data(), result_list.y.data(), result_list.z.data()};
+
+            for_each_lane_group(
+                begin,
+                end,
+                [&]<typename TLane>(const std::size_t index)
+                {
+                    const auto vector = load<TLane>(
+                        input_list.x,
+                        input_list.y,
+                        input_list.z,
+                        index);
+
+                    for (auto row = 0u; row < 3u; ++row)
+                    {
+                        auto result = TLane::add(
+                            TLane::multiply(
+                                TLane::broadcast(column_list[0][row]),
+                                vector.x),
+                            TLane::add(
+                                TLane::multiply(
+                                    TLane::broadcast(column_list[1][row]),
+                                    vector.y),
+                                TLane::multiply(
+                                    TLane::broadcast(column_list[2][row]),
+                                    vector.z)));
+                        if constexpr (TTranslate)
+                        {
+                            result = TLane::add(
+                                result,
+                                TLane::broadcast(column_list[3][row]));
+                        }
+
+                        TLane::store(
+                            result_data_list[row] + index,
+                            result);
+                    }
+                });
+        }
+
+        // The corner furthest along each plane normal is picked per plane, so no lane needs a select.
+        void cull_aabb_range(
+            const Frustum& frustum,
+            const AabbSoaSpan& aabb_list,
+            std::span<std::uint8_t> visible_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            for_each_lane_group(
+                begin,
+                end,
+                [&]<typename TLane>(const std::size_t index)
+                {
+                    auto visible = TLane::less_equal(
+                        TLane::broadcast(0.0f),
+                        TLane::broadcast(0.0f));
+                    for (const auto& plane: frustum.plane_list)
+                    {
+                        const auto corner = load<TLane>(
+                            plane.normal.x >= 0.0f ? aabb_list.max_x : aabb_list.min_x,
+                            plane.normal.y >= 0.0f ? aabb_list.max_y : aabb_list.min_y,
+                            plane.normal.z >= 0.0f ? aabb_list.max_z : aabb_list.min_z,
+                            index);
+                        const auto distance = TLane::add(
+                            dot_product<TLane>(
+                                broadcast<TLane>(plane.normal),
+                                corner),
+                            TLane::broadcast(plane.distance));
+
+                        visible = TLane::logical_and(
+                            visible,
+                            TLane::less_equal(
+                                TLane::broadcast(0.0f),
+                                distance));
+                    }
+
+                    store_mask<TLane>(
+                        visible,
+                        visible_list.data() + index);
+                });
+        }
+
+        void cull_sphere_range(
+            const Frustum& frustum,
+            const BoundingSphereSoaSpan& sphere_list,
+            std::span<std::uint8_t> visible_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            for_each_lane_group(
+                begin,
+                end,
+                [&]<typename TLane>(const std::size_t index)
+                {
+                    const auto center = load<TLane>(
+                        sphere_list.center_x,
+                        sphere_list.center_y,
+                        sphere_list.center_z,
+                        index);
+                    const auto negative_radius = TLane::subtract(
+                        TLane::broadcast(0.0f),
+                        TLane::load(sphere_list.radius.data() + index));
+
+                    auto visible = TLane::less_equal(
+                        TLane::broadcast(0.0f),
+                        TLane::broadcast(0.0f));
+                    for (const auto& plane: frustum.plane_list)
+                    {
+                        const auto distance = TLane::add(
+                            dot_product<TLane>(
+                                broadcast<TLane>(plane.normal),
+                                center),
+                            TLane::broadcast(plane.distance));
+
+                        visible = TLane::logical_and(
+                            visible,
+                            TLane::less_equal(
+                                negative_radius,
+                                distance));
+                    }
+
+                    store_mask<TLane>(
+                        visible,
+                        visible_list.data() + index);
+                });
+        }
+
+        void intersect_aabb_range(
+            const Aabb& aabb,
+            const AabbSoaSpan& aabb_list,
+            std::span<std::uint8_t> overlap_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            for_each_lane_group(
+                begin,
+                end,
+                [&]<typename TLane>(const std::size_t index)
+                {
+                    const auto min = load<TLane>(
+                        aabb_list.min_x,
+                        aabb_list.min_y,
+                        aabb_list.min_z,
+                        index);
+                    const auto max = load<TLane>(
+                        aabb_list.max_x,
+                        aabb_list.max_y,
+                        aabb_list.max_z,
+                        index);
+                    const auto query_min = broadcast<TLane>(aabb.min);
+                    const auto query_max = broadcast<TLane>(aabb.max);
+
+                    auto overlap = TLane::logical_and(
+                        TLane::less_equal(min.x, query_max.x),
+                        TLane::less_equal(query_min.x, max.x));
+                    overlap = TLane::logical_and(
+                        overlap,
+                        TLane::logical_and(
+                            TLane::less_equal(min.y, query_max.y),
+                            TLane::less_equal(query_min.y, max.y)));
+                    overlap = TLane::logical_and(
+                        overlap,
+                        TLane::logical_and(
+                            TLane::less_equal(min.z, query_max.z),
+                            TLane::less_equal(query_min.z, max.z)));
+
+                    store_mask<TLane>(
+                        overlap,
+                        overlap_list.data() + index);
+                });
+        }
+
+        void intersect_ray_aabb_range(
+            const Ray& ray,
+            const AabbSoaSpan& aabb_list,
+            std::span<float> distance_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            const float origin[3] = {ray.origin.x, ray.origin.y, ray.origin.z};
+            const float inverse_direction[3] = {1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z};
+            const std::span<const float> min_list[3] = {aabb_list.min_x, aabb_list.min_y, aabb_list.min_z};
+            const std::span<const float> max_list[3] = {aabb_list.max_x, aabb_list.max_y, aabb_list.max_z};
+
+            for_each_lane_group(
+                begin,
+                end,
+                [&]<typename TLane>(const std::size_t index)
+                {
+                    const auto infinity = TLane::broadcast(std::numeric_limits<float>::infinity());
+
+                    auto near_distance = TLane::broadcast(0.0f);
+                    auto far_distance = infinity;
+                    for (auto axis = 0; axis < 3; ++axis)
+                    {
+                        const auto axis_origin = TLane::broadcast(origin[axis]);
+                        const auto axis_inverse_direction = TLane::broadcast(inverse_direction[axis]);
+                        const auto first_distance = TLane::multiply(
+                            TLane::subtract(
+                                TLane::load(min_list[axis].data() + index),
+                                axis_origin),
+                            axis_inverse_direction);
+                        const auto second_distance = TLane::multiply(
+                            TLane::subtract(
+                                TLane::load(max_list[axis].data() + index),
+                                axis_origin),
+                            axis_inverse_direction);
+
+                        near_distance = TLane::max(
+                            near_distance,
+                            TLane::min(
+                                first_distance,
+                                second_distance));
+                        far_distance = TLane::min(
+                            far_distance,
+                            TLane::max(
+                                first_distance,
+                                second_distance));
+                    }
+
+                    TLane::store(
+                        distance_list.data() + index,
+                        TLane::select(
+                            TLane::less_equal(
+                                near_distance,
+                                far_distance),
+                            near_distance,
+                            infinity));
+                });
+        }
+
+        void intersect_ray_triangle_range(
+            const Ray& ray,
+            const TriangleSoaSpan& triangle_list,
+            std::span<float> distance_list,
+            const std::size_t begin,
+            const std::size_t end)
+        {
+            constexpr auto DETERMINANT_EPSILON = 1e-8f;
+
+            for_each_lane_group(
+                begin,
+                end,
+                [&]<typename TLane>(const std::size_t index)
+                {
+                    const auto zero = TLane::broadcast(0.0f);
+                    const auto one = TLane::broadcast(1.0f);
+
+                    const auto vertex_0 = load<TLane>(
+                        triangle_list.vertex_0_x,
+                        triangle_list.vertex_0_y,
+                        triangle_list.vertex_0_z,
+                        index);
+                    const auto edge_1 = subtract<TLane>(
+                        load<TLane>(
+                            triangle_list.vertex_1_x,
+                            triangle_list.vertex_1_y,
+                            triangle_list.vertex_1_z,
+                            index),
+                        vertex_0);
+                    const auto edge_2 = subtract<TLane>(
+                        load<TLane>(
+                            triangle_list.vertex_2_x,
+                            triangle_list.vertex_2_y,
+                            triangle_list.vertex_2_z,
+                            index),
+                        vertex_0);
+                    const auto direction = broadcast<TLane>(ray.direction);
+
+                    const auto p = cross_product<TLane>(
+                        direction,
+                        edge_2);
+                    const auto determinant = dot_product<TLane>(
+                        edge_1,
+                        p);
+                    const auto inverse_determinant = TLane::divide(
+                        one,
+                        determinant);
+
+                    const auto s = subtract<TLane>(
+                        broadcast<TLane>(ray.origin),
+                        vertex_0);
+                    const auto u = TLane::multiply(
+                        dot_product<TLane>(
+                            s,
+                            p),
+                        inverse_determinant);
+
+                    const auto q = cross_product<TLane>(
+                        s,
+                        edge_1);
+                    const auto v = TLane::multiply(
+                        dot_product<TLane>(
+                            direction,
+                            q),
+                        inverse_determinant);
+                    const auto distance = TLane::multiply(
+                        dot_product<TLane>(
+                            edge_2,
+                            q),
+                        inverse_determinant);
+
+                    auto hit = TLane::less_equal(
+                        TLane::broadcast(DETERMINANT_EPSILON),
+                        TLane::absolute(determinant));
+                    hit = TLane::logical_and(
+                        hit,
+                        TLane::logical_and(
+                            TLane::less_equal(zero, u),
+                            TLane::less_equal(u, one)));
+                    hit = TLane::logical_and(
+                        hit,
+                        TLane::logical_and(
+                            TLane::less_equal(zero, v),
+                            TLane::less_equal(TLane::add(u, v), one)));
+                    hit = TLane::logical_and(
+                        hit,
+                        TLane::less_equal(zero, distance));
+
+                    TLane::store(
+                        distance_list.data() + index,
+                        TLane::select(
+                            hit,
+                            distance,
+                            TLane::broadcast(std::numeric_limits<float>::infinity())));
+                });
+        }
+
+        Aabb compute_aabb_range(std::span<const Vector3f> point_list)
+        {
+            auto min_point = broadcast<WideLane>(point_list[0]);
+            auto max_point = min_point;
+
+            auto index = std::size_t{0};
+            for (; index + WideLane::WIDTH <= point_list.size(); index += WideLane::WIDTH)
+            {
+                const auto point = load<WideLane>(
+                    point_list,
+                    index);
+                min_point = min<WideLane>(
+                    min_point,
+                    point);
+                max_point = max<WideLane>(
+                    max_point,
+                    point);
+            }
+
+            const auto min_of = [](const float left, const float right) { return std::min(left, right); };
+            const auto max_of = [](const float left, const float right) { return std::max(left, right); };
+            auto result = LaneVector3<ScalarLane>{
+                reduce_lanes<WideLane>(min_point.x, min_of),
+                reduce_lanes<WideLane>(min_point.y, min_of),
+                reduce_lanes<WideLane>(min_point.z, min_of),
+            };
+            auto result_max = LaneVector3<ScalarLane>{
+                reduce_lanes<WideLane>(max_point.x, max_of),
+                reduce_lanes<WideLane>(max_point.y, max_of),
+                reduce_lanes<WideLane>(max_point.z, max_of),
+            };
+
+            for (; index < point_list.size(); ++index)
+            {
+                const auto point = load<ScalarLane>(
+                    point_list,
+                    index);
+                result = min<ScalarLane>(
+                    result,
+                    point);
+                result_max = max<ScalarLane>(
+                    result_max,
+                    point);
+            }
+
+            return {
+                {result.x, result.y, result.z},
+                {result_max.x, result_max.y, result_max.z},
+            };
+        }
+
+        float compute_max_distance_squared_range(
+            std::span<const Vector3f> point_list,
+            const Vector3f& point)
+        {
+            const auto center = broadcast<WideLane>(point);
+            auto max_distance_squared = WideLane::broadcast(0.0f);
+
+            auto index = std::size_t{0};
+            for (; index + WideLane::WIDTH <= point_list.size(); index += WideLane::WIDTH)
+            {
+                const auto offset = subtract<WideLane>(
+                    load<WideLane>(
+                        point_list,
+                        index),
+                    center);
+                max_distance_squared = WideLane::max(
+                    max_distance_squared,
+                    dot_product<WideLane>(
+                        offset,
+                        offset));
+            }
+
+            auto result = reduce_lanes<WideLane>(
+                max_distance_squared,
+                [](const float left, const float right) { return std::max(left, right); });
+
+            const auto scalar_center = broadcast<ScalarLane>(point);
+            for (; index < point_list.size(); ++index)
+            {
+                const auto offset = subtract<ScalarLane>(
+                    load<ScalarLane>(
+                        point_list,
+                        index),
+                    scalar_center);
+                result = std::max(
+                    result,
+                    dot_product<ScalarLane>(
+                        offset,
+                        offset));
+            }
+
+            return result;
+        }
+
+        constexpr auto KERNEL_TABLE = BatchKernelTable{
+            INSTRUCTION_SET,
+            &transform_soa<true>,
+            &transform_soa<false>,
+            &cull_aabb_range,
+            &cull_sphere_range,
+            &intersect_aabb_range,
+            &intersect_ray_aabb_range,
+            &intersect_ray_triangle_range,
+            &compute_aabb_range,
+            &compute_max_distance_squared_range,
+        };
+    }
+}
@@ -0,0 +1,13 @@
+#include <xar_engine/math/simd.hpp>
+
+#include <xar_engine/meta/enum_impl.hpp>
+
+
+ENUM_TO_STRING_IMPL(xar_engine::math::kernel::EInstructionSet,
+                    xar_engine::math::kernel::EInstructionSet::SCALAR,
+                    xar_engine::math::kernel::EInstructionSet::SSE,
+                    xar_engine::math::kernel::EInstructionSet::SSE4_2,
+                    xar_engine::math::kernel::EInstructionSet::AVX,
+                    xar_engine::math::kernel::EInstructionSet::AVX2,
+                    xar_engine::math::kernel::EInstructionSet::AVX512,
+                    xar_engine::math::kernel::EInstructionSet::NEON);
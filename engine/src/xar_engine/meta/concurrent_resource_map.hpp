@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include <xar_engine/algorithm/concurrent_slot_map.hpp>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/meta/resource_reference.hpp>
+
+
+namespace xar_engine::meta
+{
+    // TResourceMap that resources can be added to, looked up in and released from on any thread. get() is
+    // lock-free and the reference counts are atomic, so copying references across threads is safe as well.
+    // Objects never move, references returned by get() stay valid while a reference to the resource is held.
+    template <typename Tag,
+              typename Type>
+    class TConcurrentResourceMap
+        : public IResourceOwner<Tag>
+    {
+    public:
+        using Resource = TResourceReference<Tag>;
+        using ResourceHandle = Resource::Handle;
+        using ResourceId = Resource::Id;
+
+    public:
+        TConcurrentResourceMap();
+
+        Resource add(Type&& object);
+
+        const Type& get(const ResourceHandle& resource) const;
+        Type& get(const ResourceHandle& resource);
+
+        [[nodiscard]]
+        std::size_t size() const;
+
+
+        void retain_resource(ResourceId id) override;
+        // Called from reference destructors, so a stale id is ignored instead of thrown on.
+        void release_resource(ResourceId id) override;
+
+    private:
+        struct Entry;
+
+    private:
+        [[nodiscard]]
+        Entry& get_entry(ResourceId id);
+
+    private:
+        algorithm::TConcurrentSlotMap<Entry> _resource_map;
+    };
+
+
+    template <typename Tag,
+              typename Type>
+    struct TConcurrentResourceMap<Tag, Type>::Entry
+    {
+        Type object;
+        std::atomic<std::uint32_t> reference_count;
+    };
+
+
+    template <typename Tag,
+              typename Type>
+    TConcurrentResourceMap<Tag, Type>::TConcurrentResourceMap()
+        : _resource_map{}
+    {
+    }
+
+    template <typename Tag,
+              typename Type>
+    TConcurrentResourceMap<Tag, Type>::Resource TConcurrentResourceMap<Tag, Type>::add(Type&& object)
+    {
+        const auto resource_id = _resource_map.emplace(
+            std::forward<Type>(object),
+            1u);
+
+        return Resource{
+            resource_id,
+            this};
+    }
+
+    template <typename Tag,
+              typename Type>
+    const Type& TConcurrentResourceMap<Tag, Type>::get(const ResourceHandle& resource) const
+    {
+        const auto* const entry = _resource_map.find(resource.id);
+        XAR_THROW_IF(
+            entry == nullptr,
+            error::XarException,
+            "{} has no resource with id {}",
+            XAR_OBJECT_ID(this),
+            resource.id);
+
+        return entry->object;
+    }
+
+    template <typename Tag,
+              typename Type>
+    Type& TConcurrentResourceMap<Tag, Type>::get(const ResourceHandle& resource)
+    {
+        return get_entry(resource.id).object;
+    }
+
+    template <typename Tag,
+              typename Type>
+    std::size_t TConcurrentResourceMap<Tag, Type>::size() const
+    {
+        return _resource_map.size();
+    }
+
+    template <typename Tag,
+              typename Type>
+    void TConcurrentResourceMap<Tag, Type>::retain_resource(const ResourceId id)
+    {
+        get_entry(id).reference_count.fetch_add(
+            1,
+            std::memory_order_relaxed);
+    }
+
+    template <typename Tag,
+              typename Type>
+    void TConcurrentResourceMap<Tag, Type>::release_resource(const ResourceId id)
+    {
+        auto* const entry = _resource_map.find(id);
+        if (entry != nullptr && entry->reference_count.fetch_sub(
+            1,
+            std::memory_order_acq_rel) == 1)
+        {
+            _resource_map.erase(id);
+        }
+    }
+
+    template <typename Tag,
+              typename Type>
+    TConcurrentResourceMap<Tag, Type>::Entry& TConcurrentResourceMap<Tag, Type>::get_entry(const ResourceId id)
+    {
+        auto* const entry = _resource_map.find(id);
+        XAR_THROW_IF(
+            entry == nullptr,
+            error::XarException,
+            "{} has no resource with id {}",
+            XAR_OBJECT_ID(this),
+            id);
+
+        return *entry;
+    }
+}
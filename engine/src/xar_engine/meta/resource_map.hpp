@@ -1,7 +1,8 @@
 #pragma once
 
 #include <cstdint>
-#include <unordered_map>
+
+#include <xar_engine/algorithm/slot_map.hpp>
 
 #include <xar_engine/error/exception_utils.hpp>
 
@@ -10,12 +11,18 @@
 
 namespace xar_engine::meta
 {
+    // Resource ids are slot map keys, so get() is an array lookup and an id of a released resource is rejected
+    // even after its slot is reused. References returned by get() are invalidated by add and by releases.
+    // The reference count of each resource lives in its slot map entry, the resource is destroyed when the last
+    // reference returned by add() or copied from it goes away. Single-threaded, see TConcurrentResourceMap.
     template <typename Tag,
               typename Type>
     class TResourceMap
+        : public IResourceOwner<Tag>
     {
     public:
         using Resource = TResourceReference<Tag>;
+        using ResourceHandle = Resource::Handle;
         using ResourceId = Resource::Id;
 
     public:
@@ -23,15 +30,35 @@ namespace xar_engine::meta
 
         Resource add(Type&& object);
 
-        const Type& get(const Resource& resource) const;
-        Type& get(const Resource& resource);
+        const Type& get(const ResourceHandle& resource) const;
+        Type& get(const ResourceHandle& resource);
 
         [[nodiscard]]
         std::size_t size() const;
 
+
+        void retain_resource(ResourceId id) override;
+        // Called from reference destructors, so a stale id is ignored instead of thrown on.
+        void release_resource(ResourceId id) override;
+
     private:
-        std::unordered_map<ResourceId, Type> _resource_map;
-        ResourceId _next_id;
+        struct Entry;
+
+    private:
+        [[nodiscard]]
+        Entry& get_entry(ResourceId id);
+
+    private:
+        algorithm::TSlotMap<Entry> _resource_map;
+    };
+
+
+    template <typename Tag,
+              typename Type>
+    struct TResourceMap<Tag, Type>::Entry
+    {
+        Type object;
+        std::uint32_t reference_count;
     };
 
 
@@ -39,7 +66,6 @@ namespace xar_engine::meta
               typename Type>
     TResourceMap<Tag, Type>::TResourceMap()
         : _resource_map{}
-        , _next_id(0)
     {
     }
 
@@ -47,46 +73,37 @@ namespace xar_engine::meta
               typename Type>
     TResourceMap<Tag, Type>::Resource TResourceMap<Tag, Type>::add(Type&& object)
     {
-        const auto resource_id = _next_id++;
-        _resource_map.emplace(
-            resource_id,
-            std::forward<Type>(object));
+        const auto resource_id = _resource_map.add(
+            Entry{
+                std::forward<Type>(object),
+                1,
+            });
 
         return Resource{
-            resource_id, [this, resource_id]()
-            {
-                _resource_map.erase(resource_id);
-            }};
+            resource_id,
+            this};
     }
 
     template <typename Tag,
               typename Type>
-    const Type& TResourceMap<Tag, Type>::get(const Resource& resource) const
+    const Type& TResourceMap<Tag, Type>::get(const ResourceHandle& resource) const
     {
-        const auto iter = _resource_map.find(resource.get_id());
+        const auto* const entry = _resource_map.find(resource.id);
         XAR_THROW_IF(
-            iter == _resource_map.end(),
+            entry == nullptr,
             error::XarException,
             "{} has no resource with id {}",
             XAR_OBJECT_ID(this),
-            resource.get_id());
+            resource.id);
 
-        return iter->second;
+        return entry->object;
     }
 
     template <typename Tag,
               typename Type>
-    Type& TResourceMap<Tag, Type>::get(const Resource& resource)
+    Type& TResourceMap<Tag, Type>::get(const ResourceHandle& resource)
     {
-        const auto iter = _resource_map.find(resource.get_id());
-        XAR_THROW_IF(
-            iter == _resource_map.end(),
-            error::XarException,
-            "{} has no resource with id {}",
-            XAR_OBJECT_ID(this),
-            resource.get_id());
-
-        return iter->second;
+        return get_entry(resource.id).object;
     }
 
     template <typename Tag,
@@ -95,4 +112,37 @@ namespace xar_engine::meta
     {
         return _resource_map.size();
     }
-}
\ No newline at end of file
+
+    template <typename Tag,
+              typename Type>
+    void TResourceMap<Tag, Type>::retain_resource(const ResourceId id)
+    {
+        ++get_entry(id).reference_count;
+    }
+
+    template <typename Tag,
+              typename Type>
+    void TResourceMap<Tag, Type>::release_resource(const ResourceId id)
+    {
+        auto* const entry = _resource_map.find(id);
+        if (entry != nullptr && --entry->reference_count == 0)
+        {
+            _resource_map.erase(id);
+        }
+    }
+
+    template <typename Tag,
+              typename Type>
+    TResourceMap<Tag, Type>::Entry& TResourceMap<Tag, Type>::get_entry(const ResourceId id)
+    {
+        auto* const entry = _resource_map.find(id);
+        XAR_THROW_IF(
+            entry == nullptr,
+            error::XarException,
+            "{} has no resource with id {}",
+            XAR_OBJECT_ID(this),
+            id);
+
+        return *entry;
+    }
+}
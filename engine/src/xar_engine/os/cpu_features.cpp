@@ -0,0 +1,133 @@
+#include <xar_engine/os/cpu_features.hpp>
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define XAR_ENGINE_OS_CPU_X86
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+    #define XAR_ENGINE_OS_CPU_X86
+#endif
+
+
+namespace xar_engine::os
+{
+    namespace
+    {
+    #if defined(XAR_ENGINE_OS_CPU_X86)
+        struct CpuidRegisters
+        {
+            std::uint32_t eax;
+            std::uint32_t ebx;
+            std::uint32_t ecx;
+            std::uint32_t edx;
+        };
+
+        CpuidRegisters read_cpuid(
+            const std::uint32_t leaf,
+            const std::uint32_t subleaf)
+        {
+            auto registers = CpuidRegisters{};
+        #if defined(_MSC_VER)
+            int register_list[4] = {};
+            __cpuidex(
+                register_list,
+                static_cast<int>(leaf),
+                static_cast<int>(subleaf));
+            registers = {
+                static_cast<std::uint32_t>(register_list[0]),
+                static_cast<std::uint32_t>(register_list[1]),
+                static_cast<std::uint32_t>(register_list[2]),
+                static_cast<std::uint32_t>(register_list[3]),
+            };
+        #else
+            __cpuid_count(
+                leaf,
+                subleaf,
+                registers.eax,
+                registers.ebx,
+                registers.ecx,
+                registers.edx);
+        #endif
+
+            return registers;
+        }
+
+        // Register state the operating system enabled in XCR0, only valid when cpuid reports OSXSAVE.
+        std::uint64_t read_enabled_register_state()
+        {
+        #if defined(_MSC_VER)
+            return _xgetbv(0);
+        #else
+            auto eax = std::uint32_t{0};
+            auto edx = std::uint32_t{0};
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+            return (static_cast<std::uint64_t>(edx) << 32) | eax;
+        #endif
+        }
+
+        bool is_bit_set(
+            const std::uint64_t value,
+            const int bit)
+        {
+            return ((value >> bit) & 1u) != 0;
+        }
+
+        CpuFeatures detect_cpu_features()
+        {
+            // SSE and AVX register halves, then the AVX-512 opmask and upper ZMM registers.
+            constexpr auto YMM_STATE_MASK = std::uint64_t{0x06};
+            constexpr auto ZMM_STATE_MASK = std::uint64_t{0xe6};
+
+            auto features = CpuFeatures{};
+
+            const auto max_leaf = read_cpuid(0, 0).eax;
+            if (max_leaf < 1)
+            {
+                return features;
+            }
+
+            const auto leaf_1 = read_cpuid(1, 0);
+            const auto leaf_7 = max_leaf >= 7
+                                ? read_cpuid(7, 0)
+                                : CpuidRegisters{};
+
+            const auto has_xsave_enabled = is_bit_set(leaf_1.ecx, 27);
+            const auto register_state = has_xsave_enabled
+                                        ? read_enabled_register_state()
+                                        : std::uint64_t{0};
+            const auto has_ymm_state = (register_state & YMM_STATE_MASK) == YMM_STATE_MASK;
+            const auto has_zmm_state = (register_state & ZMM_STATE_MASK) == ZMM_STATE_MASK;
+
+            features.has_sse4_2 = is_bit_set(leaf_1.ecx, 20);
+            features.has_avx = has_ymm_state && is_bit_set(leaf_1.ecx, 28);
+            features.has_avx2 = features.has_avx && is_bit_set(leaf_7.ebx, 5);
+            features.has_fma = features.has_avx && is_bit_set(leaf_1.ecx, 12);
+            features.has_avx512f = features.has_avx2 && has_zmm_state && is_bit_set(leaf_7.ebx, 16);
+
+            return features;
+        }
+    #else
+        CpuFeatures detect_cpu_features()
+        {
+            auto features = CpuFeatures{};
+
+            // Advanced SIMD is a mandatory part of ARMv8-A.
+        #if defined(__aarch64__) || defined(_M_ARM64)
+            features.has_neon = true;
+        #endif
+
+            return features;
+        }
+    #endif
+    }
+
+
+    const CpuFeatures& get_cpu_features()
+    {
+        static const auto features = detect_cpu_features();
+        return features;
+    }
+}
@@ -4,14 +4,23 @@
 #include <xar_engine/graphics/api/image_view_reference.hpp>
 #include <xar_engine/graphics/api/sampler_reference.hpp>
 
+#include <xar_engine/math/vector.hpp>
+
+#include <xar_engine/meta/resource_reference.hpp>
+
 
 namespace xar_engine::renderer::gpu_asset
 {
+    enum class GpuTextureSlotTag;
+    using GpuTextureSlotReference = meta::TResourceReference<GpuTextureSlotTag>;
+
     struct GpuMaterialData
     {
         graphics::api::ImageReference image;
         graphics::api::ImageViewReference image_view;
         graphics::api::SamplerReference sampler;
-        std::uint32_t index;
+        GpuTextureSlotReference texture_slot;
+        math::Vector2f uv_offset;
+        math::Vector2f uv_scale;
     };
 }
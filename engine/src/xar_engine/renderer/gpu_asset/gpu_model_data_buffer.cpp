@@ -12,29 +12,29 @@ namespace xar_engine::renderer::gpu_asset
 
         void fill_vertex_and_index_offset_values(
             GpuModelDataListBufferStructure& gpu_model_list_buffer_structure,
-            const std::vector<asset::Model>& model_list)
+            const std::vector<std::vector<GpuMeshElementCounts>>& mesh_element_counts_list_per_model)
         {
             auto vertex_offset = std::size_t{0};
             auto index_offset = std::size_t{0};
 
-            gpu_model_list_buffer_structure.gpu_model_buffer_structure_list.reserve(model_list.size());
-            for (const auto& model: model_list)
+            gpu_model_list_buffer_structure.gpu_model_buffer_structure_list.reserve(mesh_element_counts_list_per_model.size());
+            for (const auto& mesh_element_counts_list: mesh_element_counts_list_per_model)
             {
                 auto& gpu_model_offset = gpu_model_list_buffer_structure.gpu_model_buffer_structure_list.emplace_back();
                 gpu_model_offset.first_vertex = vertex_offset;
                 gpu_model_offset.first_index = index_offset;
 
-                gpu_model_offset.gpu_mesh_buffer_structure_list.reserve(model.mesh_list.size());
-                for (const auto& mesh: model.mesh_list)
+                gpu_model_offset.gpu_mesh_buffer_structure_list.reserve(mesh_element_counts_list.size());
+                for (const auto& mesh_element_counts: mesh_element_counts_list)
                 {
                     auto& gpu_mesh_offset = gpu_model_offset.gpu_mesh_buffer_structure_list.emplace_back();
                     gpu_mesh_offset.first_vertex = vertex_offset;
                     gpu_mesh_offset.first_index = index_offset;
-                    gpu_mesh_offset.vertex_counts = mesh.position_list.size();
-                    gpu_mesh_offset.index_counts = mesh.index_list.size();
+                    gpu_mesh_offset.vertex_counts = mesh_element_counts.vertex_counts;
+                    gpu_mesh_offset.index_counts = mesh_element_counts.index_counts;
 
-                    vertex_offset += mesh.position_list.size();
-                    index_offset += mesh.index_list.size();
+                    vertex_offset += mesh_element_counts.vertex_counts;
+                    index_offset += mesh_element_counts.index_counts;
                 }
 
                 for (const auto& gpu_mesh: gpu_model_offset.gpu_mesh_buffer_structure_list)
@@ -51,9 +51,7 @@ namespace xar_engine::renderer::gpu_asset
             }
         }
 
-        void fill_byte_size_values(
-            GpuModelDataListBufferStructure& gpu_model_list_buffer_structure,
-            const std::vector<asset::Model>& model_list)
+        void fill_byte_size_values(GpuModelDataListBufferStructure& gpu_model_list_buffer_structure)
         {
             gpu_model_list_buffer_structure.position_list_byte_size =
                 gpu_model_list_buffer_structure.vertex_counts * sizeof(PositionType);
@@ -67,14 +65,33 @@ namespace xar_engine::renderer::gpu_asset
     }
 
     GpuModelDataListBufferStructure make_gpu_model_data_list_buffer_structure(const std::vector<asset::Model>& model_list)
+    {
+        auto mesh_element_counts_list_per_model = std::vector<std::vector<GpuMeshElementCounts>>{};
+        mesh_element_counts_list_per_model.reserve(model_list.size());
+        for (const auto& model: model_list)
+        {
+            auto& mesh_element_counts_list = mesh_element_counts_list_per_model.emplace_back();
+            mesh_element_counts_list.reserve(model.mesh_list.size());
+            for (const auto& mesh: model.mesh_list)
+            {
+                mesh_element_counts_list.push_back(
+                    {
+                        static_cast<std::uint32_t>(mesh.position_list.size()),
+                        static_cast<std::uint32_t>(mesh.index_list.size()),
+                    });
+            }
+        }
+
+        return make_gpu_model_data_list_buffer_structure(mesh_element_counts_list_per_model);
+    }
+
+    GpuModelDataListBufferStructure make_gpu_model_data_list_buffer_structure(const std::vector<std::vector<GpuMeshElementCounts>>& mesh_element_counts_list_per_model)
     {
         auto gpu_model_list_buffer_structure = GpuModelDataListBufferStructure{};
         fill_vertex_and_index_offset_values(
             gpu_model_list_buffer_structure,
-            model_list);
-        fill_byte_size_values(
-            gpu_model_list_buffer_structure,
-            model_list);
+            mesh_element_counts_list_per_model);
+        fill_byte_size_values(gpu_model_list_buffer_structure);
 
         return gpu_model_list_buffer_structure;
     }
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <array>
+
 #include <xar_engine/asset/model.hpp>
 
 #include <xar_engine/graphics/api/buffer_reference.hpp>
+#include <xar_engine/graphics/api/command_list.hpp>
 
 
 namespace xar_engine::renderer::gpu_asset
@@ -40,7 +43,14 @@ namespace xar_engine::renderer::gpu_asset
         std::vector<GpuModelDataBufferStructure> gpu_model_buffer_structure_list;
     };
 
+    struct GpuMeshElementCounts
+    {
+        std::uint32_t vertex_counts;
+        std::uint32_t index_counts;
+    };
+
     GpuModelDataListBufferStructure make_gpu_model_data_list_buffer_structure(const std::vector<asset::Model>& model_list);
+    GpuModelDataListBufferStructure make_gpu_model_data_list_buffer_structure(const std::vector<std::vector<GpuMeshElementCounts>>& mesh_element_counts_list_per_model);
 
 
     struct GpuModelDataBuffer
@@ -50,6 +60,11 @@ namespace xar_engine::renderer::gpu_asset
         graphics::api::BufferReference texture_coord_buffer;
         graphics::api::BufferReference index_buffer;
 
+        // Native handles of the buffers above in vertex binding order, resolved once so recording a draw does
+        // no resource lookups. Valid for as long as the buffer references are held.
+        std::array<graphics::api::NativeHandle, 3> native_vertex_buffer_list;
+        graphics::api::NativeHandle native_index_buffer;
+
         GpuModelDataListBufferStructure structure;
     };
 
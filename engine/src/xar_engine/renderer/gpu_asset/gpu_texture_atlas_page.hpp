@@ -0,0 +1,24 @@
+#pragma once
+
+#include <xar_engine/algorithm/shelf_packer.hpp>
+
+#include <xar_engine/graphics/api/format.hpp>
+#include <xar_engine/graphics/api/image_reference.hpp>
+#include <xar_engine/graphics/api/image_view_reference.hpp>
+#include <xar_engine/graphics/api/sampler_reference.hpp>
+
+#include <xar_engine/renderer/gpu_asset/gpu_material_data.hpp>
+
+
+namespace xar_engine::renderer::gpu_asset
+{
+    struct GpuTextureAtlasPage
+    {
+        graphics::api::EFormat format;
+        graphics::api::ImageReference image;
+        graphics::api::ImageViewReference image_view;
+        graphics::api::SamplerReference sampler;
+        GpuTextureSlotReference texture_slot;
+        algorithm::ShelfPacker shelf_packer;
+    };
+}
@@ -0,0 +1,34 @@
+#include <xar_engine/renderer/gpu_asset/gpu_texture_slot_allocator.hpp>
+
+
+namespace xar_engine::renderer::gpu_asset
+{
+    GpuTextureSlotAllocator::GpuTextureSlotAllocator(const std::uint32_t capacity)
+        : _slot_allocator(capacity)
+        , _reference_count_list(capacity, 0)
+    {
+    }
+
+    GpuTextureSlotReference GpuTextureSlotAllocator::allocate()
+    {
+        const auto texture_slot = _slot_allocator.allocate();
+        _reference_count_list[texture_slot] = 1;
+
+        return {
+            texture_slot,
+            this};
+    }
+
+    void GpuTextureSlotAllocator::retain_resource(const Id id)
+    {
+        ++_reference_count_list[id];
+    }
+
+    void GpuTextureSlotAllocator::release_resource(const Id id)
+    {
+        if (--_reference_count_list[id] == 0)
+        {
+            _slot_allocator.free(id);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <xar_engine/algorithm/slot_allocator.hpp>
+
+#include <xar_engine/meta/resource_reference.hpp>
+
+#include <xar_engine/renderer/gpu_asset/gpu_material_data.hpp>
+
+
+namespace xar_engine::renderer::gpu_asset
+{
+    // Hands out texture slots of the bindless descriptor array as references whose id is the slot, the slot is
+    // freed when its last reference goes away.
+    class GpuTextureSlotAllocator
+        : public meta::IResourceOwner<GpuTextureSlotTag>
+    {
+    public:
+        explicit GpuTextureSlotAllocator(std::uint32_t capacity);
+
+
+        GpuTextureSlotReference allocate();
+
+
+        void retain_resource(Id id) override;
+        void release_resource(Id id) override;
+
+    private:
+        algorithm::SlotAllocator _slot_allocator;
+        std::vector<std::uint32_t> _reference_count_list;
+    };
+}
@@ -1,5 +1,7 @@
 #include <xar_engine/renderer/renderer.hpp>
 
+#include <xar_engine/file/file_reader.hpp>
+
 #include <xar_engine/graphics/backend/graphics_backend.hpp>
 
 #include <xar_engine/renderer/renderer_impl.hpp>
@@ -21,6 +23,7 @@ namespace xar_engine::renderer
         auto state = std::make_shared<RendererState>();
         state->graphics_backend = graphics_backend;
         state->window_surface = window_surface;
+        state->file_reader = file::FileReaderFactory().make();
 
         return std::make_unique<RendererImpl>(
             state,
@@ -1,6 +1,8 @@
 #include <xar_engine/renderer/renderer_impl.hpp>
 
+#include <array>
 #include <chrono>
+#include <span>
 #include <thread>
 #include <vector>
 
@@ -158,7 +160,7 @@ namespace xar_engine::renderer
                 0.0f,
                 1.0f));
 
-        ubo.model = ubo.model * get_state().redner_item_list[0].gpu_mesh_instance.model_matrix;
+        ubo.model = ubo.model * math::make_matrix_from_affine(get_state().redner_item_list[0].gpu_mesh_instance.model_matrix);
 
         ubo.view = math::make_view_matrix(
             math::Vector3f(
@@ -274,6 +276,8 @@ namespace xar_engine::renderer
                 get_state().image_descriptor_set_layout_ref,
                 1
             })[0];
+        get_state().texture_slot_allocator = std::make_unique<gpu_asset::GpuTextureSlotAllocator>(
+            get_state().graphics_backend->descriptor_unit().get_sampled_image_capacity());
     }
 
     RendererImpl::~RendererImpl()
@@ -353,18 +357,33 @@ namespace xar_engine::renderer
                 get_state().depth_image_view_ref
             });
 
-        get_state().graphics_backend->graphics_pipeline_unit().set_pipeline_state(
-            {
-                get_state().command_buffer_list[frame_index],
-                get_state().swap_chain_ref,
-                get_state().graphics_pipeline_ref,
-                {get_state().ubo_descriptor_set_list_ref[frame_index], get_state().image_descriptor_set_ref}});
+        auto& command_list = get_state().command_list;
+        command_list.clear();
+
+        const auto native_graphics_pipeline = get_state().graphics_backend->graphics_pipeline_unit().get_native_graphics_pipeline(get_state().graphics_pipeline_ref);
+        const auto swap_chain_extent = get_state().graphics_backend->swap_chain_unit().get_swap_chain_extent(get_state().swap_chain_ref);
+        const auto native_descriptor_set_list = std::array<graphics::api::NativeHandle, 2>{
+            get_state().graphics_backend->descriptor_unit().get_native_descriptor_set(get_state().ubo_descriptor_set_list_ref[frame_index]),
+            get_state().graphics_backend->descriptor_unit().get_native_descriptor_set(get_state().image_descriptor_set_ref),
+        };
+        constexpr auto vertex_buffer_offset_list = std::array<std::uint64_t, 3>{0, 0, 0};
+
+        command_list.set_graphics_pipeline(
+            native_graphics_pipeline.pipeline,
+            swap_chain_extent.x,
+            swap_chain_extent.y);
+        command_list.set_descriptor_set_list(
+            native_graphics_pipeline.pipeline_layout,
+            0,
+            native_descriptor_set_list);
 
         static float pcc = 0.0f;
         struct Constants
         {
             float time = pcc++;
             std::int32_t material_index;
+            math::Vector2f uv_offset;
+            math::Vector2f uv_scale;
         } pc;
 
         for (const auto& render_item: get_state().redner_item_list)
@@ -375,51 +394,42 @@ namespace xar_engine::renderer
 
             const auto& gpu_material_data = get_state().gpu_material_data_map.get(render_item.gpu_material);
 
-            pc.material_index = gpu_material_data.index;
-            get_state().graphics_backend->graphics_pipeline_unit().push_constants(
-                {
-                    get_state().command_buffer_list[frame_index],
-                    get_state().graphics_pipeline_ref,
-                    graphics::api::EShaderType::FRAGMENT,
-                    0,
-                    sizeof(Constants),
-                    &pc
-                });
+            pc.material_index = gpu_material_data.texture_slot.get_id();
+            pc.uv_offset = gpu_material_data.uv_offset;
+            pc.uv_scale = gpu_material_data.uv_scale;
+            command_list.push_constants(
+                native_graphics_pipeline.pipeline_layout,
+                graphics::api::EShaderType::FRAGMENT,
+                0,
+                std::as_bytes(std::span{&pc, 1}));
 
-            get_state().graphics_backend->graphics_pipeline_unit().set_vertex_buffer_list(
-                {
-                    get_state().command_buffer_list[frame_index],
-                    {
-                        gpu_buffer_data.position_buffer,
-                        gpu_buffer_data.normal_buffer,
-                        gpu_buffer_data.texture_coord_buffer,
-                    },
-                    {0, 0, 0},
-                    0
-                });
-            get_state().graphics_backend->graphics_pipeline_unit().set_index_buffer(
-                {
-                    get_state().command_buffer_list[frame_index],
-                    gpu_buffer_data.index_buffer,
-                    0
-                });
+            command_list.set_vertex_buffer_list(
+                0,
+                gpu_buffer_data.native_vertex_buffer_list,
+                vertex_buffer_offset_list);
+            command_list.set_index_buffer(
+                gpu_buffer_data.native_index_buffer,
+                0);
 
             const auto gpu_mesh_buffer_structure = gpu_buffer_data
                 .structure
                 .gpu_model_buffer_structure_list[gpu_model_data.model_index]
                 .gpu_mesh_buffer_structure_list[gpu_mesh_data.mesh_index];
 
-            get_state().graphics_backend->graphics_pipeline_unit().draw_indexed(
-                {
-                    get_state().command_buffer_list[frame_index],
-                    gpu_mesh_buffer_structure.index_counts,
-                    1,
-                    gpu_mesh_buffer_structure.first_index,
-                    gpu_mesh_buffer_structure.first_vertex,
-                    0
-                });
+            command_list.draw_indexed(
+                gpu_mesh_buffer_structure.index_counts,
+                1,
+                gpu_mesh_buffer_structure.first_index,
+                static_cast<std::int32_t>(gpu_mesh_buffer_structure.first_vertex),
+                0);
         }
 
+        get_state().graphics_backend->graphics_pipeline_unit().execute_command_list(
+            {
+                get_state().command_buffer_list[frame_index],
+                &command_list
+            });
+
         get_state().graphics_backend->swap_chain_unit().end_rendering(
             {
                 get_state().command_buffer_list[frame_index],
@@ -4,8 +4,11 @@
 #include <memory>
 #include <vector>
 
+#include <xar_engine/file/file_reader.hpp>
+
 #include <xar_engine/graphics/api/buffer_reference.hpp>
 #include <xar_engine/graphics/api/command_buffer_reference.hpp>
+#include <xar_engine/graphics/api/command_list.hpp>
 #include <xar_engine/graphics/api/descriptor_pool_reference.hpp>
 #include <xar_engine/graphics/api/descriptor_set_layout_reference.hpp>
 #include <xar_engine/graphics/api/descriptor_set_reference.hpp>
@@ -31,6 +34,8 @@
 #include <xar_engine/renderer/gpu_asset/gpu_mesh_instance.hpp>
 #include <xar_engine/renderer/gpu_asset/gpu_model_data.hpp>
 #include <xar_engine/renderer/gpu_asset/gpu_model_data_buffer.hpp>
+#include <xar_engine/renderer/gpu_asset/gpu_texture_atlas_page.hpp>
+#include <xar_engine/renderer/gpu_asset/gpu_texture_slot_allocator.hpp>
 
 
 namespace xar_engine::renderer
@@ -39,6 +44,7 @@ namespace xar_engine::renderer
     {
         std::shared_ptr<graphics::context::IWindowSurface> window_surface;
         std::shared_ptr<graphics::backend::IGraphicsBackend> graphics_backend;
+        std::unique_ptr<file::IFileReader> file_reader;
 
         std::vector<graphics::api::CommandBufferReference> command_buffer_list;
 
@@ -55,6 +61,8 @@ namespace xar_engine::renderer
         graphics::api::DescriptorPoolReference image_descriptor_pool_ref;
         graphics::api::DescriptorSetLayoutReference image_descriptor_set_layout_ref;
         graphics::api::DescriptorSetReference image_descriptor_set_ref;
+        std::unique_ptr<gpu_asset::GpuTextureSlotAllocator> texture_slot_allocator;
+        std::vector<gpu_asset::GpuTextureAtlasPage> gpu_texture_atlas_page_list;
 
         graphics::api::ImageReference color_image_ref;
         graphics::api::ImageViewReference color_image_view_ref;
@@ -77,6 +85,7 @@ namespace xar_engine::renderer
         };
 
         std::vector<RenderItem> redner_item_list;
+        graphics::api::CommandList command_list;
     };
 
 
@@ -1,73 +1,439 @@
 #include <xar_engine/renderer/unit/gpu_material_unit_impl.hpp>
 
+#include <cstring>
+#include <limits>
+#include <optional>
+
 #include <xar_engine/asset/image_loader.hpp>
+#include <xar_engine/asset/xtex_image_file.hpp>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/file/file_reader.hpp>
 
 
 namespace xar_engine::renderer::unit
 {
+    namespace
+    {
+        constexpr auto ATLAS_PAGE_DIMENSION = math::Vector2u32{2048, 2048};
+        constexpr auto ATLAS_PAGE_MIP_LEVEL_COUNT = std::uint32_t{5};
+        constexpr auto ATLAS_TEXTURE_ALIGNMENT = std::uint32_t{1} << (ATLAS_PAGE_MIP_LEVEL_COUNT - 1);
+        constexpr auto MAX_ATLAS_TEXTURE_DIMENSION = std::uint32_t{256};
+
+        // Every texture is surrounded by copies of its edge texels. A gutter as wide as the alignment keeps each
+        // aligned block of the page owned by one texture, so neither filtering nor the smallest mip level mixes
+        // neighbouring textures.
+        constexpr auto ATLAS_TEXTURE_GUTTER = ATLAS_TEXTURE_ALIGNMENT;
+
+        constexpr std::uint32_t align_up(
+            const std::uint32_t value,
+            const std::uint32_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        // Colour textures are always four-channel, a one- or two-channel image view would sample grey as red and
+        // an sRGB single-channel format is not guaranteed to support the linear blits of mip map generation.
+        graphics::api::EFormat to_texture_format(asset::EPixelFormat pixel_format)
+        {
+            switch (pixel_format)
+            {
+                case asset::EPixelFormat::R8G8B8A8:
+                {
+                    return graphics::api::EFormat::R8G8B8A8_SRGB;
+                }
+                case asset::EPixelFormat::R16G16B16A16_FLOAT:
+                {
+                    return graphics::api::EFormat::R16G16B16A16_SIGNED_FLOAT;
+                }
+                case asset::EPixelFormat::R8:
+                case asset::EPixelFormat::R8G8:
+                case asset::EPixelFormat::R16_FLOAT:
+                {
+                    break;
+                }
+            }
+
+            XAR_THROW(
+                error::XarException,
+                "asset::EPixelFormat value {} is not supported",
+                static_cast<std::uint32_t>(pixel_format));
+        }
+    }
+
     gpu_asset::GpuMaterialReference GpuMaterialUnitImpl::make_gpu_material(const MakeGpuMaterialParameters& parameters)
     {
-        const auto material_index = static_cast<std::uint32_t>(get_state().gpu_material_data_map.size());
+        if (std::filesystem::path{*parameters.material.color_base_texture}.extension() == asset::xtex::FILE_EXTENSION)
+        {
+            return make_gpu_material_from_cooked_file(
+                {
+                    *parameters.material.color_base_texture,
+                    parameters.texture_placement
+                });
+        }
 
-        auto image = asset::ImageLoaderFactory().make()->load_image_from_file(*parameters.material.color_base_texture);
-        auto texture_image_ref = init_texture(image);
-        auto texture_image_view_ref = get_state().graphics_backend->image_unit().make_image_view(
+        const auto image = asset::ImageLoaderFactory().make()->load_image_from_file(*parameters.material.color_base_texture);
+
+        return make_gpu_material_from_image(
             {
-                texture_image_ref,
-                graphics::api::EImageAspect::COLOR,
-                image.mip_level_count
+                image,
+                parameters.texture_placement
             });
-        auto sampler_ref = get_state().graphics_backend->image_unit().make_sampler({static_cast<float>(image.mip_level_count)});
+    }
 
-        get_state().graphics_backend->descriptor_unit().write_descriptor_set(
+    gpu_asset::GpuMaterialReference GpuMaterialUnitImpl::make_gpu_material_from_image(const MakeGpuMaterialFromImageParameters& parameters)
+    {
+        const auto& image = parameters.color_base_image;
+        if (asset::image::get_channel_count(image.pixel_format) != 4)
+        {
+            return make_gpu_material_from_expanded_pixels(
+                image,
+                image.bytes,
+                parameters.texture_placement);
+        }
+
+        const auto image_byte_size = asset::image::get_byte_size(image);
+
+        auto& buffer_unit = get_state().graphics_backend->buffer_unit();
+        const auto staging_buffer = buffer_unit.make_staging_buffer({image_byte_size});
+        std::memcpy(
+            buffer_unit.map_staging_buffer({staging_buffer}).data(),
+            image.bytes.data(),
+            image_byte_size);
+
+        return make_gpu_material_from_staging_buffer(
+            image,
+            staging_buffer,
+            0,
+            parameters.texture_placement);
+    }
+
+    gpu_asset::GpuMaterialReference GpuMaterialUnitImpl::make_gpu_material_from_cooked_file(const MakeGpuMaterialFromCookedFileParameters& parameters)
+    {
+        auto error_code = std::error_code{};
+        const auto file_byte_size = std::filesystem::file_size(
+            parameters.color_base_texture,
+            error_code);
+        XAR_THROW_IF(
+            error_code,
+            error::XarException,
+            "Failed to read file {}: {}",
+            parameters.color_base_texture.string(),
+            error_code.message());
+        XAR_THROW_IF(
+            file_byte_size > std::numeric_limits<std::uint32_t>::max(),
+            error::XarException,
+            "Cooked texture {} is too large for a staging buffer",
+            parameters.color_base_texture.string());
+
+        auto& buffer_unit = get_state().graphics_backend->buffer_unit();
+        const auto staging_buffer = buffer_unit.make_staging_buffer({static_cast<std::uint32_t>(file_byte_size)});
+        const auto staging_bytes = buffer_unit.map_staging_buffer({staging_buffer}).first(file_byte_size);
+
+        const auto file_read_request = file::FileReadRequest{
+            parameters.color_base_texture,
+            0,
+            staging_bytes
+        };
+        const auto read_byte_count = get_state().file_reader->read_files({&file_read_request, 1})[0];
+
+        // Only the header is parsed, the pixels stay in staging memory and are copied from their file offset.
+        const auto image_layout = asset::xtex::read_image_layout(staging_bytes.first(read_byte_count));
+
+        return make_gpu_material_from_staging_buffer(
+            image_layout.image,
+            staging_buffer,
+            image_layout.pixel_byte_offset,
+            parameters.texture_placement);
+    }
+
+    gpu_asset::GpuMaterialReference GpuMaterialUnitImpl::make_gpu_material_from_staging_buffer(
+        const asset::Image& image,
+        const graphics::api::BufferReference& staging_buffer,
+        std::uint64_t staging_byte_offset,
+        gpu_asset::EGpuTexturePlacement texture_placement)
+    {
+        if (asset::image::get_channel_count(image.pixel_format) != 4)
+        {
+            return make_gpu_material_from_expanded_pixels(
+                image,
+                get_state().graphics_backend->buffer_unit().map_staging_buffer({staging_buffer}).subspan(
+                    staging_byte_offset,
+                    asset::image::get_byte_size(image)),
+                texture_placement);
+        }
+
+        const auto fits_atlas_page =
+            image.pixel_width <= MAX_ATLAS_TEXTURE_DIMENSION &&
+            image.pixel_height <= MAX_ATLAS_TEXTURE_DIMENSION;
+
+        if (texture_placement == gpu_asset::EGpuTexturePlacement::ATLAS_PAGE && fits_atlas_page)
+        {
+            return get_state().gpu_material_data_map.add(
+                make_atlas_gpu_material_data(
+                    image,
+                    staging_buffer,
+                    staging_byte_offset));
+        }
+
+        return get_state().gpu_material_data_map.add(
+            make_dedicated_gpu_material_data(
+                image,
+                staging_buffer,
+                staging_byte_offset));
+    }
+
+    gpu_asset::GpuMaterialReference GpuMaterialUnitImpl::make_gpu_material_from_expanded_pixels(
+        const asset::Image& image,
+        std::span<const std::uint8_t> pixel_bytes,
+        gpu_asset::EGpuTexturePlacement texture_placement)
+    {
+        // Only the base level is uploaded, mip maps are generated on the GPU.
+        const auto expanded_image = asset::Image{
+            {},
+            asset::image::get_four_channel_pixel_format(image.pixel_format),
+            4,
+            image.pixel_width,
+            image.pixel_height,
+            image.mip_level_count,
+        };
+
+        auto& buffer_unit = get_state().graphics_backend->buffer_unit();
+        const auto expanded_staging_buffer = buffer_unit.make_staging_buffer({asset::image::get_byte_size(expanded_image)});
+        asset::image::expand_to_four_channels(
+            image.pixel_format,
+            pixel_bytes,
+            buffer_unit.map_staging_buffer({expanded_staging_buffer}));
+
+        return make_gpu_material_from_staging_buffer(
+            expanded_image,
+            expanded_staging_buffer,
+            0,
+            texture_placement);
+    }
+
+    gpu_asset::GpuMaterialData GpuMaterialUnitImpl::make_dedicated_gpu_material_data(
+        const asset::Image& image,
+        const graphics::api::BufferReference& staging_buffer,
+        std::uint64_t staging_byte_offset)
+    {
+        auto texture_slot_ref = make_texture_slot();
+
+        auto texture_image_ref = get_state().graphics_backend->image_unit().make_image(
             {
-                get_state().image_descriptor_set_ref,
-                0,
-                {},
-                material_index,
-                {texture_image_view_ref},
-                {sampler_ref}
+                graphics::api::EImageType::TEXTURE,
+                {
+                    image.pixel_width,
+                    image.pixel_height,
+                    1
+                },
+                to_texture_format(image.pixel_format),
+                image.mip_level_count,
+                1
             });
+        upload_texture(
+            image,
+            staging_buffer,
+            staging_byte_offset,
+            texture_image_ref,
+            {0, 0});
 
-        return get_state().gpu_material_data_map.add(
+        auto texture_image_view_ref = get_state().graphics_backend->image_unit().make_image_view(
             {
                 texture_image_ref,
-                texture_image_view_ref,
-                sampler_ref,
-                static_cast<std::uint32_t>(material_index),
+                graphics::api::EImageAspect::COLOR,
+                image.mip_level_count
             });
+        auto sampler_ref = get_state().graphics_backend->image_unit().make_sampler(
+            {
+                .magnification_filter = graphics::api::ESamplerFilter::LINEAR,
+                .minification_filter = graphics::api::ESamplerFilter::LINEAR,
+                .mip_map_mode = graphics::api::ESamplerMipMapMode::LINEAR,
+                .address_mode_u = graphics::api::ESamplerAddressMode::REPEAT,
+                .address_mode_v = graphics::api::ESamplerAddressMode::REPEAT,
+                .address_mode_w = graphics::api::ESamplerAddressMode::REPEAT,
+                .anisotropy_enabled = true,
+                .max_anisotropy = std::numeric_limits<float>::max(),
+                .min_lod = 0.0f,
+                .max_lod = graphics::api::SAMPLER_LOD_CLAMP_NONE,
+            });
+
+        write_texture_descriptor(
+            texture_slot_ref,
+            texture_image_view_ref,
+            sampler_ref);
+
+        return {
+            texture_image_ref,
+            texture_image_view_ref,
+            sampler_ref,
+            texture_slot_ref,
+            {0.0f, 0.0f},
+            {1.0f, 1.0f},
+        };
     }
 
-    graphics::api::ImageReference GpuMaterialUnitImpl::init_texture(const asset::Image& image)
+    gpu_asset::GpuMaterialData GpuMaterialUnitImpl::make_atlas_gpu_material_data(
+        const asset::Image& image,
+        const graphics::api::BufferReference& staging_buffer,
+        std::uint64_t staging_byte_offset)
     {
-        const auto imageSize = asset::image::get_byte_size(image);
+        const auto texture_format = to_texture_format(image.pixel_format);
+
+        // The right and bottom gutters also cover the alignment padding.
+        const auto padded_image = asset::Image{
+            {},
+            image.pixel_format,
+            image.channel_count,
+            align_up(image.pixel_width, ATLAS_TEXTURE_ALIGNMENT) + 2 * ATLAS_TEXTURE_GUTTER,
+            align_up(image.pixel_height, ATLAS_TEXTURE_ALIGNMENT) + 2 * ATLAS_TEXTURE_GUTTER,
+            1,
+        };
+        const auto image_dimension = math::Vector2u32{
+            padded_image.pixel_width,
+            padded_image.pixel_height,
+        };
 
-        auto staging_buffer = get_state().graphics_backend->buffer_unit().make_staging_buffer({imageSize});
-        get_state().graphics_backend->buffer_unit().update_buffer(
+        auto& buffer_unit = get_state().graphics_backend->buffer_unit();
+        const auto padded_staging_buffer = buffer_unit.make_staging_buffer({asset::image::get_byte_size(padded_image)});
+        asset::image::copy_with_edge_border(
+            image.pixel_format,
+            image.pixel_width,
+            image.pixel_height,
+            buffer_unit.map_staging_buffer({staging_buffer}).subspan(staging_byte_offset),
+            padded_image.pixel_width,
+            padded_image.pixel_height,
+            ATLAS_TEXTURE_GUTTER,
+            ATLAS_TEXTURE_GUTTER,
+            buffer_unit.map_staging_buffer({padded_staging_buffer}));
+
+        gpu_asset::GpuTextureAtlasPage* texture_atlas_page = nullptr;
+        auto image_offset = std::optional<math::Vector2u32>{};
+        for (auto& gpu_texture_atlas_page: get_state().gpu_texture_atlas_page_list)
+        {
+            if (gpu_texture_atlas_page.format != texture_format)
             {
-                staging_buffer,
-                {
-                    {
-                        image.bytes.data(),
-                        0,
-                        static_cast<std::uint32_t>(imageSize),
-                    }
-                }
-            });
+                continue;
+            }
+
+            image_offset = gpu_texture_atlas_page.shelf_packer.pack(image_dimension);
+            if (image_offset)
+            {
+                texture_atlas_page = &gpu_texture_atlas_page;
+                break;
+            }
+        }
+
+        if (texture_atlas_page == nullptr)
+        {
+            texture_atlas_page = &get_state().gpu_texture_atlas_page_list.emplace_back(make_texture_atlas_page(texture_format));
+            image_offset = texture_atlas_page->shelf_packer.pack(image_dimension);
+        }
+
+        upload_texture(
+            padded_image,
+            padded_staging_buffer,
+            0,
+            texture_atlas_page->image,
+            *image_offset);
+
+        return {
+            texture_atlas_page->image,
+            texture_atlas_page->image_view,
+            texture_atlas_page->sampler,
+            texture_atlas_page->texture_slot,
+            {
+                static_cast<float>(image_offset->x + ATLAS_TEXTURE_GUTTER) / static_cast<float>(ATLAS_PAGE_DIMENSION.x),
+                static_cast<float>(image_offset->y + ATLAS_TEXTURE_GUTTER) / static_cast<float>(ATLAS_PAGE_DIMENSION.y),
+            },
+            {
+                static_cast<float>(image.pixel_width) / static_cast<float>(ATLAS_PAGE_DIMENSION.x),
+                static_cast<float>(image.pixel_height) / static_cast<float>(ATLAS_PAGE_DIMENSION.y),
+            },
+        };
+    }
+
+    gpu_asset::GpuTextureAtlasPage GpuMaterialUnitImpl::make_texture_atlas_page(graphics::api::EFormat format)
+    {
+        auto texture_slot_ref = make_texture_slot();
 
         auto texture_image_ref = get_state().graphics_backend->image_unit().make_image(
             {
                 graphics::api::EImageType::TEXTURE,
                 {
-                    image.pixel_width,
-                    image.pixel_height,
+                    ATLAS_PAGE_DIMENSION.x,
+                    ATLAS_PAGE_DIMENSION.y,
                     1
                 },
-                graphics::api::EFormat::R8G8B8A8_SRGB,
-                image.mip_level_count,
+                format,
+                ATLAS_PAGE_MIP_LEVEL_COUNT,
                 1
             });
+        clear_texture(texture_image_ref);
 
+        auto texture_image_view_ref = get_state().graphics_backend->image_unit().make_image_view(
+            {
+                texture_image_ref,
+                graphics::api::EImageAspect::COLOR,
+                ATLAS_PAGE_MIP_LEVEL_COUNT
+            });
+        auto sampler_ref = get_state().graphics_backend->image_unit().make_sampler(
+            {
+                .magnification_filter = graphics::api::ESamplerFilter::LINEAR,
+                .minification_filter = graphics::api::ESamplerFilter::LINEAR,
+                .mip_map_mode = graphics::api::ESamplerMipMapMode::LINEAR,
+                .address_mode_u = graphics::api::ESamplerAddressMode::CLAMP_TO_EDGE,
+                .address_mode_v = graphics::api::ESamplerAddressMode::CLAMP_TO_EDGE,
+                .address_mode_w = graphics::api::ESamplerAddressMode::CLAMP_TO_EDGE,
+                .anisotropy_enabled = true,
+                .max_anisotropy = std::numeric_limits<float>::max(),
+                .min_lod = 0.0f,
+                .max_lod = static_cast<float>(ATLAS_PAGE_MIP_LEVEL_COUNT - 1),
+            });
+
+        write_texture_descriptor(
+            texture_slot_ref,
+            texture_image_view_ref,
+            sampler_ref);
+
+        return {
+            format,
+            texture_image_ref,
+            texture_image_view_ref,
+            sampler_ref,
+            texture_slot_ref,
+            algorithm::ShelfPacker{
+                ATLAS_PAGE_DIMENSION,
+                ATLAS_TEXTURE_ALIGNMENT,
+            },
+        };
+    }
+
+    gpu_asset::GpuTextureSlotReference GpuMaterialUnitImpl::make_texture_slot()
+    {
+        return get_state().texture_slot_allocator->allocate();
+    }
+
+    void GpuMaterialUnitImpl::write_texture_descriptor(
+        const gpu_asset::GpuTextureSlotReference& texture_slot,
+        const graphics::api::ImageViewReference& texture_image_view,
+        const graphics::api::SamplerReference& sampler)
+    {
+        get_state().graphics_backend->descriptor_unit().write_descriptor_set(
+            {
+                get_state().image_descriptor_set_ref,
+                0,
+                {},
+                texture_slot.get_id(),
+                {texture_image_view},
+                {sampler}
+            });
+    }
+
+    // Texels between the textures of an atlas page are never uploaded to, clearing keeps them defined.
+    void GpuMaterialUnitImpl::clear_texture(graphics::api::ImageReference& texture_image)
+    {
         auto tmp_command_buffer = get_state().graphics_backend->command_buffer_unit().make_command_buffer_list({1});
         get_state().graphics_backend->command_buffer_unit().begin_command_buffer(
             {
@@ -77,23 +443,66 @@ namespace xar_engine::renderer::unit
         get_state().graphics_backend->image_unit().transit_image_layout(
             {
                 tmp_command_buffer[0],
-                texture_image_ref,
+                texture_image,
+                graphics::api::EImageLayout::TRANSFER_DESTINATION
+            });
+        get_state().graphics_backend->image_unit().clear_image(
+            {
+                tmp_command_buffer[0],
+                texture_image
+            });
+        get_state().graphics_backend->image_unit().transit_image_layout(
+            {
+                tmp_command_buffer[0],
+                texture_image,
+                graphics::api::EImageLayout::SHADER_READ_ONLY
+            });
+        get_state().graphics_backend->command_buffer_unit().end_command_buffer({tmp_command_buffer[0]});
+        get_state().graphics_backend->command_buffer_unit().submit_command_buffer({tmp_command_buffer[0]});
+    }
+
+    void GpuMaterialUnitImpl::upload_texture(
+        const asset::Image& image,
+        const graphics::api::BufferReference& staging_buffer,
+        std::uint64_t staging_byte_offset,
+        graphics::api::ImageReference& texture_image,
+        math::Vector2u32 image_offset)
+    {
+        auto tmp_command_buffer = get_state().graphics_backend->command_buffer_unit().make_command_buffer_list({1});
+        get_state().graphics_backend->command_buffer_unit().begin_command_buffer(
+            {
+                tmp_command_buffer[0],
+                graphics::api::ECommandBufferType::ONE_TIME
+            });
+        get_state().graphics_backend->image_unit().transit_image_layout(
+            {
+                tmp_command_buffer[0],
+                texture_image,
                 graphics::api::EImageLayout::TRANSFER_DESTINATION
             });
         get_state().graphics_backend->buffer_unit().copy_buffer_to_image(
             {
                 tmp_command_buffer[0],
                 staging_buffer,
-                texture_image_ref
+                texture_image,
+                image_offset,
+                {
+                    image.pixel_width,
+                    image.pixel_height
+                },
+                staging_byte_offset
             });
         get_state().graphics_backend->image_unit().generate_image_mip_maps(
             {
                 tmp_command_buffer[0],
-                texture_image_ref
+                texture_image,
+                image_offset,
+                {
+                    image.pixel_width,
+                    image.pixel_height
+                }
             });
         get_state().graphics_backend->command_buffer_unit().end_command_buffer({tmp_command_buffer[0]});
         get_state().graphics_backend->command_buffer_unit().submit_command_buffer({tmp_command_buffer[0]});
-
-        return texture_image_ref;
     }
 }
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
 #include <xar_engine/asset/image.hpp>
 
+#include <xar_engine/math/vector.hpp>
+
 #include <xar_engine/renderer/renderer_state.hpp>
 
 #include <xar_engine/renderer/unit/gpu_material_unit.hpp>
@@ -17,8 +22,42 @@ namespace xar_engine::renderer::unit
         using SharedRendererState::SharedRendererState;
 
         gpu_asset::GpuMaterialReference make_gpu_material(const MakeGpuMaterialParameters& parameters) override;
+        gpu_asset::GpuMaterialReference make_gpu_material_from_image(const MakeGpuMaterialFromImageParameters& parameters) override;
+        gpu_asset::GpuMaterialReference make_gpu_material_from_cooked_file(const MakeGpuMaterialFromCookedFileParameters& parameters) override;
 
     private:
-        graphics::api::ImageReference init_texture(const asset::Image& image);
+        // The image only describes the texture, its pixels are read from the staging buffer at the given offset.
+        gpu_asset::GpuMaterialReference make_gpu_material_from_staging_buffer(
+            const asset::Image& image,
+            const graphics::api::BufferReference& staging_buffer,
+            std::uint64_t staging_byte_offset,
+            gpu_asset::EGpuTexturePlacement texture_placement);
+        gpu_asset::GpuMaterialReference make_gpu_material_from_expanded_pixels(
+            const asset::Image& image,
+            std::span<const std::uint8_t> pixel_bytes,
+            gpu_asset::EGpuTexturePlacement texture_placement);
+        gpu_asset::GpuMaterialData make_dedicated_gpu_material_data(
+            const asset::Image& image,
+            const graphics::api::BufferReference& staging_buffer,
+            std::uint64_t staging_byte_offset);
+        gpu_asset::GpuMaterialData make_atlas_gpu_material_data(
+            const asset::Image& image,
+            const graphics::api::BufferReference& staging_buffer,
+            std::uint64_t staging_byte_offset);
+
+        gpu_asset::GpuTextureAtlasPage make_texture_atlas_page(graphics::api::EFormat format);
+        gpu_asset::GpuTextureSlotReference make_texture_slot();
+
+        void write_texture_descriptor(
+            const gpu_asset::GpuTextureSlotReference& texture_slot,
+            const graphics::api::ImageViewReference& texture_image_view,
+            const graphics::api::SamplerReference& sampler);
+        void clear_texture(graphics::api::ImageReference& texture_image);
+        void upload_texture(
+            const asset::Image& image,
+            const graphics::api::BufferReference& staging_buffer,
+            std::uint64_t staging_byte_offset,
+            graphics::api::ImageReference& texture_image,
+            math::Vector2u32 image_offset);
     };
-}
\ No newline at end of file
+}
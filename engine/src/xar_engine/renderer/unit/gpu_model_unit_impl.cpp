@@ -1,6 +1,12 @@
 #include <xar_engine/renderer/unit/gpu_model_unit_impl.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 #include <xar_engine/asset/model_loader.hpp>
+#include <xar_engine/asset/xmesh_model_file.hpp>
+
+#include <xar_engine/file/memory_mapped_file.hpp>
 
 #include <xar_engine/graphics/backend/graphics_backend.hpp>
 
@@ -15,180 +21,231 @@ namespace
 
 namespace xar_engine::renderer::unit
 {
-    std::vector<gpu_asset::GpuModel> GpuModelUnitImpl::make_gpu_model(const MakeGpuModelParameters& parameters)
+    namespace
     {
-        auto gpu_model_data_list_buffer_structure = gpu_asset::make_gpu_model_data_list_buffer_structure(parameters.model_list);
-
+        void copy_to_staging_buffer(
+            std::span<std::uint8_t> staging_bytes,
+            std::uint64_t byte_offset,
+            const void* data,
+            std::uint64_t byte_size)
         {
-            for (auto j = 0; j < parameters.model_list.size(); ++j)
-            {
-                const auto& model = parameters.model_list[j];
-
-                for (auto i = 0; i < model.mesh_list.size(); ++i)
-                {
-                    const auto& mesh = model.mesh_list[i];
-
-                    XAR_LOG(
-                        logging::LogLevel::DEBUG,
-                        tag,
-                        "model {}, mesh {} = position: {}, normal: {}, texcoords: {}, indices: {}",
-                        reinterpret_cast<std::uint64_t>(&model),
-                        reinterpret_cast<std::uint64_t>(&mesh),
-                        mesh.position_list.size(),
-                        mesh.normal_list.size(),
-                        mesh.texture_coord_list.size(),
-                        mesh.index_list.size());
-                }
-            }
-
-            for (auto j = 0; j < parameters.model_list.size(); ++j)
+            if (byte_size != 0)
             {
-                const auto& model = parameters.model_list[j];
-
-                for (auto i = 0; i < model.mesh_list.size(); ++i)
-                {
-                    const auto& mesh = model.mesh_list[i];
-
-                    XAR_LOG(
-                        logging::LogLevel::DEBUG,
-                        tag,
-                        "first idx: {}, index count: {}, first vertex: {}, vertex count: {}",
-                        gpu_model_data_list_buffer_structure.gpu_model_buffer_structure_list[j].gpu_mesh_buffer_structure_list[i].first_index,
-                        gpu_model_data_list_buffer_structure.gpu_model_buffer_structure_list[j].gpu_mesh_buffer_structure_list[i].index_counts,
-                        gpu_model_data_list_buffer_structure.gpu_model_buffer_structure_list[j].gpu_mesh_buffer_structure_list[i].first_vertex,
-                        gpu_model_data_list_buffer_structure.gpu_model_buffer_structure_list[j].gpu_mesh_buffer_structure_list[i].vertex_counts);
-                }
+                std::memcpy(
+                    staging_bytes.data() + byte_offset,
+                    data,
+                    byte_size);
             }
         }
 
-        auto gpu_model_data_buffer = gpu_asset::GpuModelDataBuffer{};
-        gpu_model_data_buffer.position_buffer = get_state().graphics_backend->buffer_unit().make_vertex_buffer({gpu_model_data_list_buffer_structure.position_list_byte_size});
-        gpu_model_data_buffer.normal_buffer = get_state().graphics_backend->buffer_unit().make_vertex_buffer({gpu_model_data_list_buffer_structure.normal_list_byte_size});
-        gpu_model_data_buffer.texture_coord_buffer = get_state().graphics_backend->buffer_unit().make_vertex_buffer({gpu_model_data_list_buffer_structure.texture_coord_list_byte_size});
-        gpu_model_data_buffer.index_buffer = get_state().graphics_backend->buffer_unit().make_index_buffer({gpu_model_data_list_buffer_structure.index_list_byte_size});
-        gpu_model_data_buffer.structure = std::move(gpu_model_data_list_buffer_structure);
-
-        auto staging_buffer = get_state().graphics_backend->buffer_unit().make_staging_buffer({gpu_model_data_buffer.structure.position_list_byte_size});
+        // Streams shorter than the vertex count leave the rest of the attribute range unwritten, longer ones are cut.
+        void copy_stream_to_staging_buffer(
+            std::span<std::uint8_t> staging_bytes,
+            std::uint64_t byte_offset,
+            std::span<const std::uint8_t> stream_bytes,
+            std::uint64_t max_byte_size)
         {
-            auto buffer_update_list = std::vector<graphics::api::BufferUpdate>{};
-            auto byte_size_offset = std::uint32_t{0};
-            for (auto i = 0; i < parameters.model_list.size(); ++i)
-            {
-                const auto& model = parameters.model_list[i];
-
-                for (auto j = 0; j < model.mesh_list.size(); ++j)
-                {
-                    const auto& mesh = model.mesh_list[j];
+            copy_to_staging_buffer(
+                staging_bytes,
+                byte_offset,
+                stream_bytes.data(),
+                std::min<std::uint64_t>(
+                    stream_bytes.size(),
+                    max_byte_size));
+        }
+    }
 
-                    const auto attribute_byte_size = mesh.position_list.size() * sizeof(mesh.position_list[0]);
+    std::vector<gpu_asset::GpuModel> GpuModelUnitImpl::make_gpu_model(const MakeGpuModelParameters& parameters)
+    {
+        auto gpu_model_data_list_buffer_structure = gpu_asset::make_gpu_model_data_list_buffer_structure(parameters.model_list);
 
-                    buffer_update_list.emplace_back(
-                        mesh.position_list.data(),
-                        byte_size_offset,
-                        attribute_byte_size);
+        for (auto j = 0; j < parameters.model_list.size(); ++j)
+        {
+            const auto& model = parameters.model_list[j];
 
-                    byte_size_offset += attribute_byte_size;
-                }
+            for (auto i = 0; i < model.mesh_list.size(); ++i)
+            {
+                const auto& mesh = model.mesh_list[i];
+
+                XAR_LOG(
+                    logging::LogLevel::DEBUG,
+                    tag,
+                    "model {}, mesh {} = position: {}, normal: {}, texcoords: {}, indices: {}",
+                    reinterpret_cast<std::uint64_t>(&model),
+                    reinterpret_cast<std::uint64_t>(&mesh),
+                    mesh.position_list.size(),
+                    mesh.normal_list.size(),
+                    mesh.texture_coord_list.size(),
+                    mesh.index_list.size());
             }
-
-            get_state().graphics_backend->buffer_unit().update_buffer(
-                {
-                    staging_buffer,
-                    buffer_update_list
-                });
         }
 
-        auto staging_buffer_1 = get_state().graphics_backend->buffer_unit().make_staging_buffer({gpu_model_data_buffer.structure.normal_list_byte_size});
+        const auto staging_buffer_list = make_staging_buffer_list(gpu_model_data_list_buffer_structure);
+        for (auto model_index = std::size_t{0}; model_index < parameters.model_list.size(); ++model_index)
         {
-            auto buffer_update_list = std::vector<graphics::api::BufferUpdate>{};
-            auto byte_size_offset = std::uint32_t{0};
-            for (auto i = 0; i < parameters.model_list.size(); ++i)
-            {
-                const auto& model = parameters.model_list[i];
-
-                for (auto j = 0; j < model.mesh_list.size(); ++j)
-                {
-                    const auto& mesh = model.mesh_list[j];
-
-                    const auto attribute_byte_size = mesh.normal_list.size() * sizeof(mesh.normal_list[0]);
+            const auto& model = parameters.model_list[model_index];
+            const auto& gpu_model_buffer_structure = gpu_model_data_list_buffer_structure.gpu_model_buffer_structure_list[model_index];
 
-                    buffer_update_list.emplace_back(
-                        mesh.normal_list.data(),
-                        byte_size_offset,
-                        attribute_byte_size);
-
-                    byte_size_offset += attribute_byte_size;
-                }
+            for (auto mesh_index = std::size_t{0}; mesh_index < model.mesh_list.size(); ++mesh_index)
+            {
+                const auto& mesh = model.mesh_list[mesh_index];
+                const auto& gpu_mesh_buffer_structure = gpu_model_buffer_structure.gpu_mesh_buffer_structure_list[mesh_index];
+
+                const auto vertex_counts = std::uint64_t{gpu_mesh_buffer_structure.vertex_counts};
+                copy_to_staging_buffer(
+                    staging_buffer_list.position.bytes,
+                    gpu_mesh_buffer_structure.first_vertex * sizeof(mesh.position_list[0]),
+                    mesh.position_list.data(),
+                    vertex_counts * sizeof(mesh.position_list[0]));
+                copy_to_staging_buffer(
+                    staging_buffer_list.normal.bytes,
+                    gpu_mesh_buffer_structure.first_vertex * sizeof(mesh.normal_list[0]),
+                    mesh.normal_list.data(),
+                    std::min<std::uint64_t>(mesh.normal_list.size(), vertex_counts) * sizeof(mesh.normal_list[0]));
+                copy_to_staging_buffer(
+                    staging_buffer_list.texture_coord.bytes,
+                    gpu_mesh_buffer_structure.first_vertex * sizeof(mesh.texture_coord_list[0]),
+                    mesh.texture_coord_list.data(),
+                    std::min<std::uint64_t>(mesh.texture_coord_list.size(), vertex_counts) * sizeof(mesh.texture_coord_list[0]));
+                copy_to_staging_buffer(
+                    staging_buffer_list.index.bytes,
+                    gpu_mesh_buffer_structure.first_index * sizeof(mesh.index_list[0]),
+                    mesh.index_list.data(),
+                    mesh.index_list.size() * sizeof(mesh.index_list[0]));
             }
-
-            get_state().graphics_backend->buffer_unit().update_buffer(
-                {
-                    staging_buffer_1,
-                    buffer_update_list
-                });
         }
 
-        auto staging_buffer_2 = get_state().graphics_backend->buffer_unit().make_staging_buffer({gpu_model_data_buffer.structure.texture_coord_list_byte_size});
+        return upload_gpu_model_list(
+            std::move(gpu_model_data_list_buffer_structure),
+            staging_buffer_list);
+    }
+
+    std::vector<gpu_asset::GpuModel> GpuModelUnitImpl::make_gpu_model_from_cooked_file(const MakeGpuModelFromCookedFileParameters& parameters)
+    {
+        auto memory_mapped_file_list = std::vector<file::MemoryMappedFile>{};
+        auto model_layout_list = std::vector<asset::xmesh::XmeshModelLayout>{};
+        auto mesh_element_counts_list_per_model = std::vector<std::vector<gpu_asset::GpuMeshElementCounts>>{};
+        memory_mapped_file_list.reserve(parameters.path_list.size());
+        model_layout_list.reserve(parameters.path_list.size());
+        mesh_element_counts_list_per_model.reserve(parameters.path_list.size());
+
+        for (const auto& path: parameters.path_list)
         {
-            auto buffer_update_list = std::vector<graphics::api::BufferUpdate>{};
-            auto byte_size_offset = std::uint32_t{0};
-            for (auto i = 0; i < parameters.model_list.size(); ++i)
+            const auto& memory_mapped_file = memory_mapped_file_list.emplace_back(path);
+            const auto& model_layout = model_layout_list.emplace_back(
+                asset::xmesh::read_model_layout(
+                    memory_mapped_file.get_bytes(),
+                    path));
+
+            auto& mesh_element_counts_list = mesh_element_counts_list_per_model.emplace_back();
+            mesh_element_counts_list.reserve(model_layout.mesh_layout_list.size());
+            for (const auto& mesh_layout: model_layout.mesh_layout_list)
             {
-                const auto& model = parameters.model_list[i];
-
-                for (auto j = 0; j < model.mesh_list.size(); ++j)
-                {
-                    const auto& mesh = model.mesh_list[j];
+                mesh_element_counts_list.push_back(
+                    {
+                        mesh_layout.position_count,
+                        mesh_layout.index_count
+                    });
+            }
+        }
 
-                    const auto attribute_byte_size =
-                        mesh.texture_coord_list.size() * sizeof(mesh.texture_coord_list[0]);
+        auto gpu_model_data_list_buffer_structure = gpu_asset::make_gpu_model_data_list_buffer_structure(mesh_element_counts_list_per_model);
 
-                    buffer_update_list.emplace_back(
-                        mesh.texture_coord_list.data(),
-                        byte_size_offset,
-                        attribute_byte_size);
+        const auto staging_buffer_list = make_staging_buffer_list(gpu_model_data_list_buffer_structure);
+        for (auto model_index = std::size_t{0}; model_index < model_layout_list.size(); ++model_index)
+        {
+            const auto& model_layout = model_layout_list[model_index];
+            const auto& gpu_model_buffer_structure = gpu_model_data_list_buffer_structure.gpu_model_buffer_structure_list[model_index];
 
-                    byte_size_offset += attribute_byte_size;
-                }
+            for (auto mesh_index = std::size_t{0}; mesh_index < model_layout.mesh_layout_list.size(); ++mesh_index)
+            {
+                const auto& mesh_layout = model_layout.mesh_layout_list[mesh_index];
+                const auto& gpu_mesh_buffer_structure = gpu_model_buffer_structure.gpu_mesh_buffer_structure_list[mesh_index];
+
+                const auto vertex_counts = std::uint64_t{gpu_mesh_buffer_structure.vertex_counts};
+                copy_stream_to_staging_buffer(
+                    staging_buffer_list.position.bytes,
+                    gpu_mesh_buffer_structure.first_vertex * sizeof(math::Vector3f),
+                    mesh_layout.position_bytes,
+                    vertex_counts * sizeof(math::Vector3f));
+                copy_stream_to_staging_buffer(
+                    staging_buffer_list.normal.bytes,
+                    gpu_mesh_buffer_structure.first_vertex * sizeof(math::Vector3f),
+                    mesh_layout.normal_bytes,
+                    vertex_counts * sizeof(math::Vector3f));
+                copy_stream_to_staging_buffer(
+                    staging_buffer_list.texture_coord.bytes,
+                    gpu_mesh_buffer_structure.first_vertex * sizeof(math::Vector2f),
+                    mesh_layout.texture_coord_bytes,
+                    vertex_counts * sizeof(math::Vector2f));
+                copy_stream_to_staging_buffer(
+                    staging_buffer_list.index.bytes,
+                    gpu_mesh_buffer_structure.first_index * sizeof(std::uint32_t),
+                    mesh_layout.index_bytes,
+                    mesh_layout.index_bytes.size());
             }
-
-            get_state().graphics_backend->buffer_unit().update_buffer(
-                {
-                    staging_buffer_2,
-                    buffer_update_list
-                });
         }
 
-        auto staging_buffer_3 = get_state().graphics_backend->buffer_unit().make_staging_buffer({gpu_model_data_buffer.structure.index_list_byte_size});
-        {
-            auto buffer_update_list = std::vector<graphics::api::BufferUpdate>{};
-            auto byte_size_offset = std::uint32_t{0};
-            for (auto i = 0; i < parameters.model_list.size(); ++i)
-            {
-                const auto& model = parameters.model_list[i];
+        return upload_gpu_model_list(
+            std::move(gpu_model_data_list_buffer_structure),
+            staging_buffer_list);
+    }
 
-                for (auto j = 0; j < model.mesh_list.size(); ++j)
-                {
-                    const auto& mesh = model.mesh_list[j];
+    GpuModelUnitImpl::StagingBufferList GpuModelUnitImpl::make_staging_buffer_list(const gpu_asset::GpuModelDataListBufferStructure& gpu_model_data_list_buffer_structure)
+    {
+        return {
+            make_staging_buffer(gpu_model_data_list_buffer_structure.position_list_byte_size),
+            make_staging_buffer(gpu_model_data_list_buffer_structure.normal_list_byte_size),
+            make_staging_buffer(gpu_model_data_list_buffer_structure.texture_coord_list_byte_size),
+            make_staging_buffer(gpu_model_data_list_buffer_structure.index_list_byte_size),
+        };
+    }
 
-                    const auto attribute_byte_size = mesh.index_list.size() * sizeof(mesh.index_list[0]);
+    GpuModelUnitImpl::StagingBuffer GpuModelUnitImpl::make_staging_buffer(std::uint32_t byte_size)
+    {
+        auto& buffer_unit = get_state().graphics_backend->buffer_unit();
 
-                    buffer_update_list.emplace_back(
-                        mesh.index_list.data(),
-                        byte_size_offset,
-                        attribute_byte_size);
+        auto staging_buffer = buffer_unit.make_staging_buffer({byte_size});
+        const auto staging_bytes = buffer_unit.map_staging_buffer({staging_buffer});
 
-                    byte_size_offset += attribute_byte_size;
-                }
-            }
+        return {
+            std::move(staging_buffer),
+            staging_bytes
+        };
+    }
 
-            get_state().graphics_backend->buffer_unit().update_buffer(
-                {
-                    staging_buffer_3,
-                    buffer_update_list
-                });
+    std::vector<gpu_asset::GpuModel> GpuModelUnitImpl::upload_gpu_model_list(
+        gpu_asset::GpuModelDataListBufferStructure gpu_model_data_list_buffer_structure,
+        const StagingBufferList& staging_buffer_list)
+    {
+        for (const auto& gpu_model_buffer_structure: gpu_model_data_list_buffer_structure.gpu_model_buffer_structure_list)
+        {
+            for (const auto& gpu_mesh_buffer_structure: gpu_model_buffer_structure.gpu_mesh_buffer_structure_list)
+            {
+                XAR_LOG(
+                    logging::LogLevel::DEBUG,
+                    tag,
+                    "first idx: {}, index count: {}, first vertex: {}, vertex count: {}",
+                    gpu_mesh_buffer_structure.first_index,
+                    gpu_mesh_buffer_structure.index_counts,
+                    gpu_mesh_buffer_structure.first_vertex,
+                    gpu_mesh_buffer_structure.vertex_counts);
+            }
         }
 
+        auto gpu_model_data_buffer = gpu_asset::GpuModelDataBuffer{};
+        gpu_model_data_buffer.position_buffer = get_state().graphics_backend->buffer_unit().make_vertex_buffer({gpu_model_data_list_buffer_structure.position_list_byte_size});
+        gpu_model_data_buffer.normal_buffer = get_state().graphics_backend->buffer_unit().make_vertex_buffer({gpu_model_data_list_buffer_structure.normal_list_byte_size});
+        gpu_model_data_buffer.texture_coord_buffer = get_state().graphics_backend->buffer_unit().make_vertex_buffer({gpu_model_data_list_buffer_structure.texture_coord_list_byte_size});
+        gpu_model_data_buffer.index_buffer = get_state().graphics_backend->buffer_unit().make_index_buffer({gpu_model_data_list_buffer_structure.index_list_byte_size});
+        gpu_model_data_buffer.native_vertex_buffer_list = {
+            get_state().graphics_backend->buffer_unit().get_native_buffer(gpu_model_data_buffer.position_buffer),
+            get_state().graphics_backend->buffer_unit().get_native_buffer(gpu_model_data_buffer.normal_buffer),
+            get_state().graphics_backend->buffer_unit().get_native_buffer(gpu_model_data_buffer.texture_coord_buffer),
+        };
+        gpu_model_data_buffer.native_index_buffer = get_state().graphics_backend->buffer_unit().get_native_buffer(gpu_model_data_buffer.index_buffer);
+        gpu_model_data_buffer.structure = std::move(gpu_model_data_list_buffer_structure);
+
         const auto command_buffer = get_state().graphics_backend->command_buffer_unit().make_command_buffer_list({1});
         get_state().graphics_backend->command_buffer_unit().begin_command_buffer(
             {
@@ -199,55 +256,58 @@ namespace xar_engine::renderer::unit
         get_state().graphics_backend->buffer_unit().copy_buffer(
             {
                 command_buffer[0],
-                staging_buffer,
+                staging_buffer_list.position.buffer,
                 gpu_model_data_buffer.position_buffer
             });
         get_state().graphics_backend->buffer_unit().copy_buffer(
             {
                 command_buffer[0],
-                staging_buffer_1,
+                staging_buffer_list.normal.buffer,
                 gpu_model_data_buffer.normal_buffer
             });
         get_state().graphics_backend->buffer_unit().copy_buffer(
             {
                 command_buffer[0],
-                staging_buffer_2,
+                staging_buffer_list.texture_coord.buffer,
                 gpu_model_data_buffer.texture_coord_buffer
             });
         get_state().graphics_backend->buffer_unit().copy_buffer(
             {
                 command_buffer[0],
-                staging_buffer_3,
+                staging_buffer_list.index.buffer,
                 gpu_model_data_buffer.index_buffer
             });
 
         get_state().graphics_backend->command_buffer_unit().end_command_buffer({command_buffer[0]});
         get_state().graphics_backend->command_buffer_unit().submit_command_buffer({command_buffer[0]});
 
+        auto mesh_count_list = std::vector<std::uint32_t>{};
+        mesh_count_list.reserve(gpu_model_data_buffer.structure.gpu_model_buffer_structure_list.size());
+        for (const auto& gpu_model_buffer_structure: gpu_model_data_buffer.structure.gpu_model_buffer_structure_list)
+        {
+            mesh_count_list.push_back(static_cast<std::uint32_t>(gpu_model_buffer_structure.gpu_mesh_buffer_structure_list.size()));
+        }
+
         auto gpu_model_data_buffer_reference = get_state().gpu_model_data_buffer_map.add(std::move(gpu_model_data_buffer));
 
         auto gpu_model_data_list = std::vector<gpu_asset::GpuModel>{};
+        for (auto model_index = std::uint32_t{0}; model_index < mesh_count_list.size(); ++model_index)
         {
-            for (auto model_index = std::uint32_t{0}; model_index < parameters.model_list.size(); ++model_index)
+            auto& gpu_model_data = gpu_model_data_list.emplace_back(
+                get_state().gpu_model_data_map.add(
+                    {
+                        model_index,
+                        gpu_model_data_buffer_reference
+                    }));
+
+            for (auto mesh_index = std::uint32_t{0}; mesh_index < mesh_count_list[model_index]; ++mesh_index)
             {
-                const auto& model = parameters.model_list[model_index];
-
-                auto& gpu_model_data = gpu_model_data_list.emplace_back(
-                    get_state().gpu_model_data_map.add(
+                gpu_model_data.gpu_mesh.push_back(
+                    get_state().gpu_mesh_data_map.add(
                         {
-                            model_index,
-                            gpu_model_data_buffer_reference
+                            mesh_index,
+                            gpu_model_data.gpu_model,
                         }));
-
-                for (auto mesh_index = std::uint32_t{0}; mesh_index < model.mesh_list.size(); ++mesh_index)
-                {
-                    gpu_model_data.gpu_mesh.push_back(
-                        get_state().gpu_mesh_data_map.add(
-                            {
-                                mesh_index,
-                                gpu_model_data.gpu_model,
-                            }));
-                }
             }
         }
 
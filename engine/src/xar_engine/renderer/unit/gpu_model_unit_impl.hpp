@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
 #include <xar_engine/renderer/unit/gpu_model_unit.hpp>
 
 #include <xar_engine/renderer/renderer_state.hpp>
@@ -15,5 +18,29 @@ namespace xar_engine::renderer::unit
         using SharedRendererState::SharedRendererState;
 
         std::vector<gpu_asset::GpuModel> make_gpu_model(const MakeGpuModelParameters& parameters) override;
+        std::vector<gpu_asset::GpuModel> make_gpu_model_from_cooked_file(const MakeGpuModelFromCookedFileParameters& parameters) override;
+
+    private:
+        struct StagingBuffer
+        {
+            graphics::api::BufferReference buffer;
+            std::span<std::uint8_t> bytes;
+        };
+
+        struct StagingBufferList
+        {
+            StagingBuffer position;
+            StagingBuffer normal;
+            StagingBuffer texture_coord;
+            StagingBuffer index;
+        };
+
+    private:
+        StagingBufferList make_staging_buffer_list(const gpu_asset::GpuModelDataListBufferStructure& gpu_model_data_list_buffer_structure);
+        StagingBuffer make_staging_buffer(std::uint32_t byte_size);
+
+        std::vector<gpu_asset::GpuModel> upload_gpu_model_list(
+            gpu_asset::GpuModelDataListBufferStructure gpu_model_data_list_buffer_structure,
+            const StagingBufferList& staging_buffer_list);
     };
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include <xar_engine/scene/transform_table.hpp>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+#include <xar_engine/math/transform.hpp>
+
+
+namespace xar_engine::scene
+{
+    TransformTable make_transform_table(const asset::ModelNodeList& node_list)
+    {
+        const auto node_count = node_list.parent_index_list.size();
+        XAR_THROW_IF(
+            node_list.translation_list.size() != node_count ||
+            node_list.rotation_list.size() != node_count ||
+            node_list.scale_list.size() != node_count,
+            error::XarException,
+            "Node lists have different sizes");
+
+        auto rotation_list = std::vector<math::Quaternionf>{};
+        rotation_list.reserve(node_count);
+        for (const auto& rotation: node_list.rotation_list)
+        {
+            rotation_list.push_back({rotation.x, rotation.y, rotation.z, rotation.w});
+        }
+
+        return {
+            node_list.parent_index_list,
+            node_list.translation_list,
+            std::move(rotation_list),
+            node_list.scale_list,
+            std::vector<math::Affine3x4f>(node_count),
+        };
+    }
+
+    void update_world_matrices(
+        TransformTable& transform_table,
+        const math::Affine3x4f& root_matrix)
+    {
+        const auto node_count = transform_table.parent_index_list.size();
+        transform_table.world_matrix_list.resize(node_count);
+
+        auto* const world_matrix_list = transform_table.world_matrix_list.data();
+        for (auto node_index = std::size_t{0}; node_index < node_count; ++node_index)
+        {
+            world_matrix_list[node_index] = math::make_affine_from_transform(
+                {
+                    transform_table.local_translation_list[node_index],
+                    transform_table.local_rotation_list[node_index],
+                    transform_table.local_scale_list[node_index],
+                });
+        }
+
+        // Parents precede children, so a parent's world matrix is final by the time its children read it.
+        for (auto node_index = std::size_t{0}; node_index < node_count; ++node_index)
+        {
+            const auto parent_index = transform_table.parent_index_list[node_index];
+            if (parent_index == asset::NO_PARENT_NODE_INDEX)
+            {
+                world_matrix_list[node_index] = root_matrix * world_matrix_list[node_index];
+                continue;
+            }
+
+            XAR_THROW_IF(
+                parent_index < 0 || static_cast<std::size_t>(parent_index) >= node_index,
+                error::XarException,
+                "Node {} does not follow its parent {}",
+                node_index,
+                parent_index);
+
+            world_matrix_list[node_index] = world_matrix_list[parent_index] * world_matrix_list[node_index];
+        }
+    }
+}
@@ -0,0 +1,30 @@
+#include <xar_engine/thread/executor.hpp>
+
+
+namespace xar_engine::thread
+{
+    IExecutor::~IExecutor() = default;
+
+
+    void QueueExecutor::execute(std::function<void()> task)
+    {
+        auto lock = std::lock_guard{_mutex};
+        _task_list.push_back(std::move(task));
+    }
+
+    std::uint32_t QueueExecutor::run_pending()
+    {
+        auto task_list = std::vector<std::function<void()>>{};
+        {
+            auto lock = std::lock_guard{_mutex};
+            task_list.swap(_task_list);
+        }
+
+        for (auto& task: task_list)
+        {
+            task();
+        }
+
+        return static_cast<std::uint32_t>(task_list.size());
+    }
+}
@@ -0,0 +1,141 @@
+#include <xar_engine/thread/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#include <xar_engine/error/exception_utils.hpp>
+
+
+namespace xar_engine::thread
+{
+    ThreadPool::ThreadPool(std::uint32_t worker_count)
+        : _stopping(false)
+    {
+        XAR_THROW_IF(
+            worker_count == 0,
+            error::XarException,
+            "ThreadPool requires at least one worker");
+
+        _worker_list.reserve(worker_count);
+        for (auto worker_index = std::uint32_t{0}; worker_index < worker_count; ++worker_index)
+        {
+            _worker_list.emplace_back(
+                [this]()
+                {
+                    run_worker();
+                });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            auto lock = std::lock_guard{_mutex};
+            _stopping = true;
+        }
+        _condition_variable.notify_all();
+
+        for (auto& worker: _worker_list)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::execute(std::function<void()> task)
+    {
+        push_task(std::move(task));
+    }
+
+    void ThreadPool::parallel_for(
+        std::size_t count,
+        const std::function<void(std::size_t)>& function)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (count == 1)
+        {
+            function(0);
+            return;
+        }
+
+        auto next_index = std::atomic<std::size_t>{0};
+        const auto task_count = std::min(
+            count,
+            _worker_list.size());
+
+        auto future_list = std::vector<std::future<void>>{};
+        future_list.reserve(task_count);
+        for (auto task_index = std::size_t{0}; task_index < task_count; ++task_index)
+        {
+            future_list.push_back(
+                submit(
+                    [&next_index, &function, count]()
+                    {
+                        for (auto index = next_index++; index < count; index = next_index++)
+                        {
+                            function(index);
+                        }
+                    }));
+        }
+
+        for (auto& future: future_list)
+        {
+            future.wait();
+        }
+        for (auto& future: future_list)
+        {
+            future.get();
+        }
+    }
+
+    std::uint32_t ThreadPool::get_worker_count() const
+    {
+        return static_cast<std::uint32_t>(_worker_list.size());
+    }
+
+    std::uint32_t ThreadPool::get_default_worker_count()
+    {
+        return std::max(
+            std::thread::hardware_concurrency(),
+            1u);
+    }
+
+    void ThreadPool::push_task(std::function<void()> task)
+    {
+        {
+            auto lock = std::lock_guard{_mutex};
+            _task_queue.push(std::move(task));
+        }
+        _condition_variable.notify_one();
+    }
+
+    void ThreadPool::run_worker()
+    {
+        while (true)
+        {
+            auto task = std::function<void()>{};
+            {
+                auto lock = std::unique_lock{_mutex};
+                _condition_variable.wait(
+                    lock,
+                    [this]()
+                    {
+                        return _stopping || !_task_queue.empty();
+                    });
+
+                if (_task_queue.empty())
+                {
+                    return;
+                }
+
+                task = std::move(_task_queue.front());
+                _task_queue.pop();
+            }
+
+            task();
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <xar_engine/algorithm/slot_map.hpp>
+
+
+namespace
+{
+    // About the size of the native Vulkan wrappers kept in the resource maps.
+    struct Payload
+    {
+        std::array<std::uint64_t, 4> data;
+    };
+
+    // What meta::TResourceMap stored resources in before it moved to TSlotMap.
+    class UnorderedMap
+    {
+    public:
+        using Key = std::uint32_t;
+
+    public:
+        Key add(Payload&& payload)
+        {
+            const auto key = _next_key++;
+            _payload_map.emplace(
+                key,
+                std::move(payload));
+
+            return key;
+        }
+
+        bool erase(const Key key)
+        {
+            return _payload_map.erase(key) != 0;
+        }
+
+        const Payload* find(const Key key) const
+        {
+            const auto iter = _payload_map.find(key);
+            return iter != _payload_map.end() ? &iter->second : nullptr;
+        }
+
+    private:
+        std::unordered_map<Key, Payload> _payload_map;
+        Key _next_key = 0;
+    };
+
+    using SlotMap = xar_engine::algorithm::TSlotMap<Payload>;
+
+
+    template <typename TMap>
+    std::vector<typename TMap::Key> fill_map(
+        TMap& map,
+        const std::size_t count)
+    {
+        auto key_list = std::vector<typename TMap::Key>(count);
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            key_list[index] = map.add(Payload{{index, 0, 0, 0}});
+        }
+
+        return key_list;
+    }
+
+    // Resources are looked up in draw order, which has nothing to do with creation order.
+    template <typename TKey>
+    void shuffle_key_list(std::vector<TKey>& key_list)
+    {
+        auto random_engine = std::mt19937{0};
+        std::ranges::shuffle(
+            key_list,
+            random_engine);
+    }
+
+    template <typename TMap>
+    void get(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto map = TMap{};
+        auto key_list = fill_map(
+            map,
+            count);
+        shuffle_key_list(key_list);
+
+        for (auto _: state)
+        {
+            auto sum = std::uint64_t{0};
+            for (const auto key: key_list)
+            {
+                sum += map.find(key)->data[0];
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    template <typename TMap>
+    void add_and_erase(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto map = TMap{};
+
+        // Warm up once so both maps run on recycled storage, as they do after the first few frames.
+        auto key_list = fill_map(
+            map,
+            count);
+        for (const auto key: key_list)
+        {
+            map.erase(key);
+        }
+
+        for (auto _: state)
+        {
+            key_list = fill_map(
+                map,
+                count);
+            shuffle_key_list(key_list);
+            for (const auto key: key_list)
+            {
+                map.erase(key);
+            }
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+}
+
+BENCHMARK_TEMPLATE(get, UnorderedMap)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(get, SlotMap)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(add_and_erase, UnorderedMap)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(add_and_erase, SlotMap)->Range(1 << 8, 1 << 16)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <span>
+#include <vector>
+
+#include <xar_engine/asset/image_decoder.hpp>
+#include <xar_engine/asset/image_loader.hpp>
+#include <xar_engine/asset/stb_image_decoder.hpp>
+
+#ifdef XAR_ENGINE_WITH_SPNG
+#include <xar_engine/asset/spng_image_decoder.hpp>
+#endif
+
+#include <xar_engine/file/file.hpp>
+
+
+namespace
+{
+    constexpr auto* const IMAGE_PATH = "resources/viking_room.png";
+
+    template <typename ImageDecoderType>
+    void decode_image(benchmark::State& state)
+    {
+        const auto file_bytes = xar_engine::file::read_binary_file(IMAGE_PATH);
+        const auto file_byte_span = std::span<const std::uint8_t>{
+            reinterpret_cast<const std::uint8_t*>(file_bytes.data()),
+            file_bytes.size()
+        };
+
+        const auto image_decoder = ImageDecoderType{};
+        for (auto _: state)
+        {
+            auto image = image_decoder.decode_image(file_byte_span);
+            benchmark::DoNotOptimize(image.bytes.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_bytes.size()));
+    }
+
+    void load_image_from_file(benchmark::State& state)
+    {
+        const auto image_loader = xar_engine::asset::ImageLoaderFactory().make();
+        for (auto _: state)
+        {
+            auto image = image_loader->load_image_from_file(IMAGE_PATH);
+            benchmark::DoNotOptimize(image.bytes.data());
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(decode_image, xar_engine::asset::StbImageDecoder)->Unit(benchmark::kMillisecond);
+
+#ifdef XAR_ENGINE_WITH_SPNG
+BENCHMARK_TEMPLATE(decode_image, xar_engine::asset::SpngImageDecoder)->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK(load_image_from_file)->Unit(benchmark::kMillisecond);
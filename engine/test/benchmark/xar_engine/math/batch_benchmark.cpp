@@ -0,0 +1,362 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <xar_engine/math/batch.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace
+{
+    xar_engine::math::Matrix4x4f make_benchmark_matrix()
+    {
+        auto matrix = xar_engine::math::rotate_matrix(
+            xar_engine::math::make_identity_matrix(),
+            30.0f,
+            xar_engine::math::Vector3f{0.0f, 1.0f, 0.0f});
+        matrix.as_column_list[3] = {1.0f, 2.0f, 3.0f, 1.0f};
+
+        return matrix;
+    }
+
+    xar_engine::math::Frustum make_benchmark_frustum()
+    {
+        const auto view = xar_engine::math::make_view_matrix(
+            {0.0f, 0.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f});
+        const auto projection = xar_engine::math::make_projection_matrix(
+            60.0f,
+            1.5f,
+            0.1f,
+            100.0f);
+
+        return xar_engine::math::make_frustum(projection * view);
+    }
+
+    // Unit boxes on a line sweeping through the frustum, so roughly half of them are visible.
+    std::vector<xar_engine::math::Aabb> make_benchmark_aabb_list(const std::size_t count)
+    {
+        auto aabb_list = std::vector<xar_engine::math::Aabb>(count);
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            const auto y = static_cast<float>(index % 200) - 100.0f;
+            aabb_list[index] = {{10.0f, y, -0.5f}, {11.0f, y + 1.0f, 0.5f}};
+        }
+
+        return aabb_list;
+    }
+
+    void transform_points_single(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto matrix = make_benchmark_matrix();
+        const auto point_list = std::vector<xar_engine::math::Vector3f>(count, {1.0f, 2.0f, 3.0f});
+        auto result_list = std::vector<xar_engine::math::Vector3f>(count);
+
+        for (auto _: state)
+        {
+            for (auto index = std::size_t{0}; index < count; ++index)
+            {
+                result_list[index] = xar_engine::math::transform_point(
+                    matrix,
+                    point_list[index]);
+            }
+            benchmark::DoNotOptimize(result_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void transform_points_soa(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto matrix = make_benchmark_matrix();
+        const auto x_list = std::vector<float>(count, 1.0f);
+        const auto y_list = std::vector<float>(count, 2.0f);
+        const auto z_list = std::vector<float>(count, 3.0f);
+        auto result_x_list = std::vector<float>(count);
+        auto result_y_list = std::vector<float>(count);
+        auto result_z_list = std::vector<float>(count);
+
+        for (auto _: state)
+        {
+            xar_engine::math::transform_points(
+                {x_list, y_list, z_list},
+                matrix,
+                {result_x_list, result_y_list, result_z_list});
+            benchmark::DoNotOptimize(result_x_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void transform_points_soa_thread_pool(benchmark::State& state)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{xar_engine::thread::ThreadPool::get_default_worker_count()};
+
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto matrix = make_benchmark_matrix();
+        const auto x_list = std::vector<float>(count, 1.0f);
+        const auto y_list = std::vector<float>(count, 2.0f);
+        const auto z_list = std::vector<float>(count, 3.0f);
+        auto result_x_list = std::vector<float>(count);
+        auto result_y_list = std::vector<float>(count);
+        auto result_z_list = std::vector<float>(count);
+
+        for (auto _: state)
+        {
+            xar_engine::math::transform_points(
+                {x_list, y_list, z_list},
+                matrix,
+                {result_x_list, result_y_list, result_z_list},
+                thread_pool);
+            benchmark::DoNotOptimize(result_x_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void multiply_matrices(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto matrix = make_benchmark_matrix();
+        const auto matrix_list = std::vector<xar_engine::math::Matrix4x4f>(count, matrix);
+        auto result_list = std::vector<xar_engine::math::Matrix4x4f>(count);
+
+        for (auto _: state)
+        {
+            xar_engine::math::multiply_matrices(
+                matrix,
+                matrix_list,
+                result_list);
+            benchmark::DoNotOptimize(result_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void transform_aabbs(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto matrix = make_benchmark_matrix();
+        const auto aabb_list = std::vector<xar_engine::math::Aabb>(count, {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}});
+        auto result_list = std::vector<xar_engine::math::Aabb>(count);
+
+        for (auto _: state)
+        {
+            xar_engine::math::transform_aabbs(
+                aabb_list,
+                matrix,
+                result_list);
+            benchmark::DoNotOptimize(result_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void cull_aabbs_single(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto frustum = make_benchmark_frustum();
+        const auto aabb_list = make_benchmark_aabb_list(count);
+        auto visible_list = std::vector<std::uint8_t>(count);
+
+        for (auto _: state)
+        {
+            for (auto index = std::size_t{0}; index < count; ++index)
+            {
+                visible_list[index] = xar_engine::math::intersects(
+                    frustum,
+                    aabb_list[index]);
+            }
+            benchmark::DoNotOptimize(visible_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    // Runs function with the batch instruction set given as the second argument, skips unsupported ones.
+    template <typename TFunction>
+    void run_with_instruction_set(
+        benchmark::State& state,
+        const TFunction& function)
+    {
+        const auto instruction_set = static_cast<xar_engine::math::kernel::EInstructionSet>(state.range(1));
+        if (!xar_engine::math::is_batch_instruction_set_supported(instruction_set))
+        {
+            state.SkipWithError("Instruction set is not supported");
+            return;
+        }
+
+        const auto default_instruction_set = xar_engine::math::get_batch_instruction_set();
+        xar_engine::math::set_batch_instruction_set(instruction_set);
+        state.SetLabel(xar_engine::meta::enum_to_short_string(instruction_set));
+
+        function();
+
+        xar_engine::math::set_batch_instruction_set(default_instruction_set);
+    }
+
+    void add_instruction_set_arguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (const auto count: {1 << 10, 1 << 16})
+        {
+            for (const auto instruction_set: {
+                     xar_engine::math::kernel::EInstructionSet::SCALAR,
+                     xar_engine::math::kernel::EInstructionSet::SSE4_2,
+                     xar_engine::math::kernel::EInstructionSet::AVX2,
+                     xar_engine::math::kernel::EInstructionSet::AVX512,
+                     xar_engine::math::kernel::EInstructionSet::NEON,
+                 })
+            {
+                benchmark->Args({count, static_cast<std::int64_t>(instruction_set)});
+            }
+        }
+    }
+
+    void cull_aabbs_soa(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto frustum = make_benchmark_frustum();
+
+        std::vector<float> component_list[6];
+        for (const auto& aabb: make_benchmark_aabb_list(count))
+        {
+            component_list[0].push_back(aabb.min.x);
+            component_list[1].push_back(aabb.min.y);
+            component_list[2].push_back(aabb.min.z);
+            component_list[3].push_back(aabb.max.x);
+            component_list[4].push_back(aabb.max.y);
+            component_list[5].push_back(aabb.max.z);
+        }
+        auto visible_list = std::vector<std::uint8_t>(count);
+
+        run_with_instruction_set(
+            state,
+            [&]()
+            {
+                for (auto _: state)
+                {
+                    xar_engine::math::cull_aabbs(
+                        frustum,
+                        {component_list[0], component_list[1], component_list[2], component_list[3], component_list[4], component_list[5]},
+                        visible_list);
+                    benchmark::DoNotOptimize(visible_list.data());
+                }
+            });
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void intersect_ray_triangles_single(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto ray = xar_engine::math::Ray{{0.0f, 0.0f, 0.0f}, {1.0f, 0.1f, 0.1f}};
+        auto distance_list = std::vector<float>(count);
+
+        for (auto _: state)
+        {
+            for (auto index = std::size_t{0}; index < count; ++index)
+            {
+                const auto x = static_cast<float>(index % 100);
+                distance_list[index] = xar_engine::math::intersect_ray(
+                    ray,
+                    xar_engine::math::Vector3f{x, -1.0f, -1.0f},
+                    xar_engine::math::Vector3f{x, 2.0f, -1.0f},
+                    xar_engine::math::Vector3f{x, -1.0f, 2.0f}).value_or(0.0f);
+            }
+            benchmark::DoNotOptimize(distance_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    void intersect_ray_triangles_soa(benchmark::State& state)
+    {
+        const auto count = static_cast<std::size_t>(state.range(0));
+        const auto ray = xar_engine::math::Ray{{0.0f, 0.0f, 0.0f}, {1.0f, 0.1f, 0.1f}};
+
+        auto x_list = std::vector<float>(count);
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            x_list[index] = static_cast<float>(index % 100);
+        }
+        const auto low_list = std::vector<float>(count, -1.0f);
+        const auto high_list = std::vector<float>(count, 2.0f);
+        auto distance_list = std::vector<float>(count);
+
+        for (auto _: state)
+        {
+            xar_engine::math::intersect_ray(
+                ray,
+                {x_list, low_list, low_list, x_list, high_list, low_list, x_list, low_list, high_list},
+                distance_list);
+            benchmark::DoNotOptimize(distance_list.data());
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+    }
+
+    std::vector<xar_engine::math::Vector3f> make_benchmark_point_list(const std::size_t count)
+    {
+        auto point_list = std::vector<xar_engine::math::Vector3f>(count);
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            const auto value = static_cast<float>(index % 1000);
+            point_list[index] = {value, -value * 0.5f, value * 0.25f};
+        }
+
+        return point_list;
+    }
+
+    void compute_aabb_single(benchmark::State& state)
+    {
+        const auto point_list = make_benchmark_point_list(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _: state)
+        {
+            auto aabb = xar_engine::math::Aabb{point_list[0], point_list[0]};
+            for (const auto& point: point_list)
+            {
+                aabb.min = {std::min(aabb.min.x, point.x), std::min(aabb.min.y, point.y), std::min(aabb.min.z, point.z)};
+                aabb.max = {std::max(aabb.max.x, point.x), std::max(aabb.max.y, point.y), std::max(aabb.max.z, point.z)};
+            }
+            benchmark::DoNotOptimize(aabb);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * point_list.size()));
+    }
+
+    void compute_aabb_batch(benchmark::State& state)
+    {
+        const auto point_list = make_benchmark_point_list(static_cast<std::size_t>(state.range(0)));
+
+        run_with_instruction_set(
+            state,
+            [&]()
+            {
+                for (auto _: state)
+                {
+                    benchmark::DoNotOptimize(xar_engine::math::compute_aabb(point_list));
+                }
+            });
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * point_list.size()));
+    }
+}
+
+BENCHMARK(transform_points_single)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(transform_points_soa)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+BENCHMARK(transform_points_soa_thread_pool)->Range(1 << 10, 1 << 20)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(multiply_matrices)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(transform_aabbs)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(cull_aabbs_single)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(cull_aabbs_soa)->Apply(add_instruction_set_arguments)->Unit(benchmark::kMicrosecond);
+BENCHMARK(intersect_ray_triangles_single)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(intersect_ray_triangles_soa)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(compute_aabb_single)->Range(1 << 10, 1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(compute_aabb_batch)->Apply(add_instruction_set_arguments)->Unit(benchmark::kMicrosecond);
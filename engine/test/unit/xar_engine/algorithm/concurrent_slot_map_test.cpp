@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <xar_engine/algorithm/concurrent_slot_map.hpp>
+
+
+namespace
+{
+    using SlotMap = xar_engine::algorithm::TConcurrentSlotMap<std::uint32_t>;
+
+
+    TEST(concurrent_slot_map,
+         emplace__empty_map__values_found_by_key)
+    {
+        auto slot_map = SlotMap{};
+        const auto first_key = slot_map.emplace(10u);
+        const auto second_key = slot_map.emplace(20u);
+
+        ASSERT_NE(slot_map.find(first_key), nullptr);
+        ASSERT_NE(slot_map.find(second_key), nullptr);
+        EXPECT_EQ(*slot_map.find(first_key), 10);
+        EXPECT_EQ(*slot_map.find(second_key), 20);
+        EXPECT_EQ(slot_map.size(), 2);
+        EXPECT_EQ(slot_map.find(SlotMap::INVALID_KEY), nullptr);
+    }
+
+    TEST(concurrent_slot_map,
+         erase__value__address_of_other_values_kept)
+    {
+        auto slot_map = SlotMap{};
+        auto key_list = std::vector<SlotMap::Key>{};
+        for (auto value = 0u; value < 2 * SlotMap::PAGE_SLOT_COUNT; ++value)
+        {
+            key_list.push_back(slot_map.emplace(value));
+        }
+        const auto* const last_value = slot_map.find(key_list.back());
+
+        EXPECT_TRUE(slot_map.erase(key_list.front()));
+        EXPECT_FALSE(slot_map.erase(key_list.front()));
+
+        EXPECT_EQ(slot_map.find(key_list.front()), nullptr);
+        EXPECT_EQ(slot_map.find(key_list.back()), last_value);
+        EXPECT_EQ(slot_map.size(), key_list.size() - 1);
+    }
+
+    TEST(concurrent_slot_map,
+         emplace__erased_slot__slot_reused_and_stale_key_rejected)
+    {
+        auto slot_map = SlotMap{};
+        const auto stale_key = slot_map.emplace(10u);
+        slot_map.erase(stale_key);
+
+        const auto new_key = slot_map.emplace(20u);
+
+        EXPECT_EQ(new_key & SlotMap::INDEX_MASK, stale_key & SlotMap::INDEX_MASK);
+        EXPECT_NE(new_key, stale_key);
+        EXPECT_EQ(slot_map.find(stale_key), nullptr);
+        EXPECT_EQ(*slot_map.find(new_key), 20);
+    }
+
+    TEST(concurrent_slot_map,
+         emplace__constructor_throws__slot_returned)
+    {
+        struct ThrowingValue
+        {
+            explicit ThrowingValue(const bool should_throw)
+            {
+                if (should_throw)
+                {
+                    throw std::runtime_error{"test"};
+                }
+            }
+        };
+
+        auto slot_map = xar_engine::algorithm::TConcurrentSlotMap<ThrowingValue>{};
+        EXPECT_THROW(
+            slot_map.emplace(true),
+            std::runtime_error);
+
+        const auto key = slot_map.emplace(false);
+        EXPECT_EQ(key, 0);
+        EXPECT_EQ(slot_map.size(), 1);
+    }
+
+    TEST(concurrent_slot_map,
+         emplace_and_erase__several_threads__own_values_always_found)
+    {
+        constexpr auto THREAD_COUNT = 4u;
+        constexpr auto ROUND_COUNT = 200u;
+        constexpr auto VALUE_COUNT = 64u;
+
+        auto slot_map = SlotMap{};
+        auto mismatch_count = std::atomic<std::uint32_t>{0};
+
+        auto thread_list = std::vector<std::jthread>{};
+        for (auto thread_index = 0u; thread_index < THREAD_COUNT; ++thread_index)
+        {
+            thread_list.emplace_back(
+                [&, thread_index]()
+                {
+                    auto key_list = std::vector<SlotMap::Key>(VALUE_COUNT);
+                    for (auto round = 0u; round < ROUND_COUNT; ++round)
+                    {
+                        for (auto index = 0u; index < VALUE_COUNT; ++index)
+                        {
+                            key_list[index] = slot_map.emplace(thread_index * VALUE_COUNT + index);
+                        }
+
+                        for (auto index = 0u; index < VALUE_COUNT; ++index)
+                        {
+                            const auto* const value = slot_map.find(key_list[index]);
+                            if (value == nullptr || *value != thread_index * VALUE_COUNT + index)
+                            {
+                                ++mismatch_count;
+                            }
+                            if (!slot_map.erase(key_list[index]))
+                            {
+                                ++mismatch_count;
+                            }
+                        }
+                    }
+                });
+        }
+        thread_list.clear();
+
+        EXPECT_EQ(mismatch_count, 0);
+        EXPECT_EQ(slot_map.size(), 0);
+    }
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <xar_engine/algorithm/shelf_packer.hpp>
+
+
+namespace
+{
+    void expect_position(
+        const std::optional<xar_engine::math::Vector2u32>& position,
+        std::uint32_t expected_x,
+        std::uint32_t expected_y)
+    {
+        ASSERT_TRUE(position.has_value());
+        EXPECT_EQ(position->x, expected_x);
+        EXPECT_EQ(position->y, expected_y);
+    }
+
+
+    TEST(shelf_packer,
+         pack__same_height__placed_on_one_shelf)
+    {
+        auto shelf_packer = xar_engine::algorithm::ShelfPacker{{64, 64}, 1};
+
+        expect_position(
+            shelf_packer.pack({16, 16}),
+            0,
+            0);
+        expect_position(
+            shelf_packer.pack({16, 16}),
+            16,
+            0);
+        expect_position(
+            shelf_packer.pack({32, 16}),
+            32,
+            0);
+    }
+
+    TEST(shelf_packer,
+         pack__full_shelf__new_shelf_opened)
+    {
+        auto shelf_packer = xar_engine::algorithm::ShelfPacker{{64, 64}, 1};
+        shelf_packer.pack({48, 16});
+
+        expect_position(
+            shelf_packer.pack({32, 8}),
+            0,
+            16);
+        expect_position(
+            shelf_packer.pack({16, 16}),
+            48,
+            0);
+    }
+
+    TEST(shelf_packer,
+         pack__unaligned_dimension__aligned_position)
+    {
+        auto shelf_packer = xar_engine::algorithm::ShelfPacker{{64, 64}, 16};
+
+        expect_position(
+            shelf_packer.pack({10, 10}),
+            0,
+            0);
+        expect_position(
+            shelf_packer.pack({17, 10}),
+            16,
+            0);
+        expect_position(
+            shelf_packer.pack({10, 17}),
+            0,
+            16);
+    }
+
+    TEST(shelf_packer,
+         pack__no_space_left__nullopt)
+    {
+        auto shelf_packer = xar_engine::algorithm::ShelfPacker{{32, 32}, 1};
+
+        EXPECT_FALSE(shelf_packer.pack({33, 1}).has_value());
+        EXPECT_TRUE(shelf_packer.pack({32, 24}).has_value());
+        EXPECT_FALSE(shelf_packer.pack({32, 16}).has_value());
+        EXPECT_TRUE(shelf_packer.pack({32, 8}).has_value());
+    }
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <xar_engine/algorithm/slot_allocator.hpp>
+
+#include <xar_engine/error/exception.hpp>
+
+
+namespace
+{
+    TEST(slot_allocator,
+         allocate__empty_allocator__consecutive_slots)
+    {
+        auto slot_allocator = xar_engine::algorithm::SlotAllocator{4};
+
+        EXPECT_EQ(slot_allocator.allocate(), 0);
+        EXPECT_EQ(slot_allocator.allocate(), 1);
+        EXPECT_EQ(slot_allocator.allocate(), 2);
+        EXPECT_EQ(slot_allocator.get_allocated_count(), 3);
+    }
+
+    TEST(slot_allocator,
+         allocate__freed_slot__slot_recycled)
+    {
+        auto slot_allocator = xar_engine::algorithm::SlotAllocator{4};
+        slot_allocator.allocate();
+        slot_allocator.allocate();
+        slot_allocator.allocate();
+
+        slot_allocator.free(1);
+        EXPECT_FALSE(slot_allocator.is_allocated(1));
+        EXPECT_EQ(slot_allocator.get_allocated_count(), 2);
+
+        EXPECT_EQ(slot_allocator.allocate(), 1);
+        EXPECT_TRUE(slot_allocator.is_allocated(1));
+        EXPECT_EQ(slot_allocator.allocate(), 3);
+    }
+
+    TEST(slot_allocator,
+         allocate__full_allocator__throws)
+    {
+        auto slot_allocator = xar_engine::algorithm::SlotAllocator{2};
+        slot_allocator.allocate();
+        slot_allocator.allocate();
+
+        EXPECT_THROW(
+            slot_allocator.allocate(),
+            xar_engine::error::XarException);
+    }
+
+    TEST(slot_allocator,
+         free__not_allocated_slot__throws)
+    {
+        auto slot_allocator = xar_engine::algorithm::SlotAllocator{2};
+        slot_allocator.allocate();
+        slot_allocator.free(0);
+
+        EXPECT_THROW(
+            slot_allocator.free(0),
+            xar_engine::error::XarException);
+        EXPECT_THROW(
+            slot_allocator.free(5),
+            xar_engine::error::XarException);
+    }
+}
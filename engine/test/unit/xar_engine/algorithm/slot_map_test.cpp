@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <xar_engine/algorithm/slot_map.hpp>
+
+
+namespace
+{
+    using SlotMap = xar_engine::algorithm::TSlotMap<int>;
+
+
+    TEST(slot_map,
+         add__empty_map__values_found_by_key)
+    {
+        auto slot_map = SlotMap{};
+        const auto first_key = slot_map.add(10);
+        const auto second_key = slot_map.add(20);
+
+        ASSERT_NE(slot_map.find(first_key), nullptr);
+        ASSERT_NE(slot_map.find(second_key), nullptr);
+        EXPECT_EQ(*slot_map.find(first_key), 10);
+        EXPECT_EQ(*slot_map.find(second_key), 20);
+        EXPECT_EQ(slot_map.size(), 2);
+    }
+
+    TEST(slot_map,
+         erase__middle_value__other_values_kept_dense)
+    {
+        auto slot_map = SlotMap{};
+        const auto first_key = slot_map.add(10);
+        const auto second_key = slot_map.add(20);
+        const auto third_key = slot_map.add(30);
+
+        EXPECT_TRUE(slot_map.erase(first_key));
+
+        EXPECT_FALSE(slot_map.contains(first_key));
+        EXPECT_EQ(*slot_map.find(second_key), 20);
+        EXPECT_EQ(*slot_map.find(third_key), 30);
+
+        auto value_list = std::vector<int>(slot_map.get_value_list().begin(), slot_map.get_value_list().end());
+        std::ranges::sort(value_list);
+        EXPECT_EQ(value_list, (std::vector<int>{20, 30}));
+    }
+
+    TEST(slot_map,
+         add__erased_slot__slot_reused_and_stale_key_rejected)
+    {
+        auto slot_map = SlotMap{};
+        const auto stale_key = slot_map.add(10);
+        slot_map.erase(stale_key);
+
+        const auto new_key = slot_map.add(20);
+
+        EXPECT_EQ(new_key & SlotMap::INDEX_MASK, stale_key & SlotMap::INDEX_MASK);
+        EXPECT_NE(new_key, stale_key);
+        EXPECT_EQ(slot_map.find(stale_key), nullptr);
+        EXPECT_FALSE(slot_map.erase(stale_key));
+        EXPECT_EQ(*slot_map.find(new_key), 20);
+    }
+
+    TEST(slot_map,
+         find__key_never_added__nullptr)
+    {
+        auto slot_map = SlotMap{};
+        slot_map.add(10);
+
+        EXPECT_EQ(slot_map.find(1), nullptr);
+        EXPECT_EQ(slot_map.find(1u << SlotMap::INDEX_BIT_COUNT), nullptr);
+        EXPECT_EQ(slot_map.find(SlotMap::INVALID_KEY), nullptr);
+    }
+
+    TEST(slot_map,
+         add__generation_wrapped__slot_retired)
+    {
+        auto slot_map = SlotMap{};
+        const auto first_key = slot_map.add(0);
+        slot_map.erase(first_key);
+
+        for (auto generation = 1u; generation < (1u << SlotMap::GENERATION_BIT_COUNT); ++generation)
+        {
+            const auto key = slot_map.add(static_cast<int>(generation));
+            ASSERT_EQ(key >> SlotMap::INDEX_BIT_COUNT, generation);
+            slot_map.erase(key);
+        }
+
+        const auto key = slot_map.add(1);
+        EXPECT_NE(key, first_key);
+        EXPECT_EQ(key & SlotMap::INDEX_MASK, 1);
+        EXPECT_FALSE(slot_map.contains(first_key));
+    }
+
+    TEST(slot_map,
+         erase__value_destructor__runs_after_map_is_consistent)
+    {
+        using OwnerMap = xar_engine::algorithm::TSlotMap<std::shared_ptr<int>>;
+
+        auto slot_map = OwnerMap{};
+        auto release_count = 0;
+        const auto first_key = slot_map.add(
+            std::shared_ptr<int>(
+                new int{1},
+                [&](int* value)
+                {
+                    EXPECT_EQ(slot_map.size(), 1);
+                    ++release_count;
+                    delete value;
+                }));
+        const auto second_key = slot_map.add(std::make_shared<int>(2));
+
+        EXPECT_TRUE(slot_map.erase(first_key));
+
+        EXPECT_EQ(release_count, 1);
+        EXPECT_EQ(**slot_map.find(second_key), 2);
+    }
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include <xar_engine/asset/image_decoder_registry.hpp>
+
+
+namespace
+{
+    class FakeImageDecoder
+        : public xar_engine::asset::IImageDecoder
+    {
+    public:
+        explicit FakeImageDecoder(std::uint32_t pixel_width)
+            : _pixel_width(pixel_width)
+        {
+        }
+
+        [[nodiscard]]
+        xar_engine::asset::Image decode_image(std::span<const std::uint8_t> file_bytes) const override
+        {
+            auto image = xar_engine::asset::Image{};
+            image.pixel_width = _pixel_width;
+
+            return image;
+        }
+
+    private:
+        std::uint32_t _pixel_width;
+    };
+
+
+    TEST(image_decoder,
+         detect_file_type__known_signatures__correct_type)
+    {
+        const auto png_bytes = std::array<std::uint8_t, 9>{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0};
+        const auto jpeg_bytes = std::array<std::uint8_t, 4>{0xFF, 0xD8, 0xFF, 0xE0};
+        const auto hdr_bytes = std::array<std::uint8_t, 6>{'#', '?', 'R', 'G', 'B', 'E'};
+
+        EXPECT_EQ(xar_engine::asset::image::detect_file_type(png_bytes),
+                  xar_engine::asset::EImageFileType::PNG);
+        EXPECT_EQ(xar_engine::asset::image::detect_file_type(jpeg_bytes),
+                  xar_engine::asset::EImageFileType::JPEG);
+        EXPECT_EQ(xar_engine::asset::image::detect_file_type(hdr_bytes),
+                  xar_engine::asset::EImageFileType::HDR);
+    }
+
+    TEST(image_decoder,
+         detect_file_type__truncated_signature__unknown)
+    {
+        const auto png_bytes = std::array<std::uint8_t, 4>{0x89, 'P', 'N', 'G'};
+
+        EXPECT_EQ(xar_engine::asset::image::detect_file_type(png_bytes),
+                  xar_engine::asset::EImageFileType::UNKNOWN);
+        EXPECT_EQ(xar_engine::asset::image::detect_file_type({}),
+                  xar_engine::asset::EImageFileType::UNKNOWN);
+    }
+
+    TEST(image_decoder_registry,
+         get_image_decoder__registered_and_unregistered_types__correct_decoder)
+    {
+        auto image_decoder_registry = xar_engine::asset::ImageDecoderRegistry{std::make_unique<FakeImageDecoder>(1)};
+        image_decoder_registry.add_image_decoder(
+            xar_engine::asset::EImageFileType::PNG,
+            std::make_unique<FakeImageDecoder>(2));
+
+        const auto png_bytes = std::array<std::uint8_t, 8>{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        const auto jpeg_bytes = std::array<std::uint8_t, 3>{0xFF, 0xD8, 0xFF};
+
+        EXPECT_EQ(image_decoder_registry.get_image_decoder(png_bytes).decode_image(png_bytes).pixel_width,
+                  2);
+        EXPECT_EQ(image_decoder_registry.get_image_decoder(jpeg_bytes).decode_image(jpeg_bytes).pixel_width,
+                  1);
+    }
+}
@@ -1,7 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include <xar_engine/asset/stb_image_loader.hpp>
 
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/thread/task.hpp>
+#include <xar_engine/thread/thread_pool.hpp>
+
 
 namespace
 {
@@ -42,9 +49,69 @@ namespace
                   4);
         EXPECT_EQ(model.pixel_height,
                   4);
+        EXPECT_EQ(model.pixel_format,
+                  xar_engine::asset::EPixelFormat::R8G8B8A8);
         EXPECT_EQ(model.channel_count,
                   4);
         EXPECT_EQ(model.bytes,
                   expected_bytes);
     }
-}
\ No newline at end of file
+
+    TEST(stb_model_loader,
+         load_small_grayscale_png__single_channel_kept)
+    {
+        xar_engine::asset::StbImageLoader loader;
+        const auto model = loader.load_image_from_file("resources/gray_quad.png");
+
+        const auto expected_bytes = std::vector<std::uint8_t>{
+            0, 64,
+            128, 255
+        };
+
+        EXPECT_EQ(model.pixel_width,
+                  2);
+        EXPECT_EQ(model.pixel_height,
+                  2);
+        EXPECT_EQ(model.pixel_format,
+                  xar_engine::asset::EPixelFormat::R8);
+        EXPECT_EQ(model.channel_count,
+                  1);
+        EXPECT_EQ(model.bytes,
+                  expected_bytes);
+    }
+
+    TEST(image_loader,
+         load_image_async__missing_file__error_completes_on_resume_executor)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{1};
+        auto queue_executor = xar_engine::thread::QueueExecutor{};
+        const auto loader = xar_engine::asset::StbImageLoader{};
+
+        auto completed = false;
+        auto completion_thread_id = std::thread::id{};
+        xar_engine::thread::start_task(
+            loader.load_image_async(
+                "resources/missing.png",
+                thread_pool,
+                queue_executor),
+            [&](std::expected<xar_engine::asset::Image, std::exception_ptr> result)
+            {
+                completed = true;
+                completion_thread_id = std::this_thread::get_id();
+
+                ASSERT_FALSE(result);
+                EXPECT_THROW(
+                    std::rethrow_exception(result.error()),
+                    xar_engine::error::XarException);
+            });
+
+        while (!completed)
+        {
+            queue_executor.run_pending();
+            std::this_thread::yield();
+        }
+
+        EXPECT_EQ(completion_thread_id,
+                  std::this_thread::get_id());
+    }
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <xar_engine/asset/image.hpp>
+
+#include <xar_engine/error/exception.hpp>
+
+
+namespace
+{
+    using xar_engine::asset::EPixelFormat;
+
+
+    TEST(image,
+         expand_to_four_channels__grey__grey_replicated_and_opaque)
+    {
+        const auto source_bytes = std::vector<std::uint8_t>{10, 200};
+        auto target_bytes = std::vector<std::uint8_t>(8);
+
+        xar_engine::asset::image::expand_to_four_channels(
+            EPixelFormat::R8,
+            source_bytes,
+            target_bytes);
+
+        EXPECT_EQ(
+            target_bytes,
+            (std::vector<std::uint8_t>{10, 10, 10, 255, 200, 200, 200, 255}));
+    }
+
+    TEST(image,
+         expand_to_four_channels__grey_alpha__alpha_kept)
+    {
+        const auto source_bytes = std::vector<std::uint8_t>{10, 20, 30, 40};
+        auto target_bytes = std::vector<std::uint8_t>(8);
+
+        xar_engine::asset::image::expand_to_four_channels(
+            EPixelFormat::R8G8,
+            source_bytes,
+            target_bytes);
+
+        EXPECT_EQ(
+            target_bytes,
+            (std::vector<std::uint8_t>{10, 10, 10, 20, 30, 30, 30, 40}));
+    }
+
+    TEST(image,
+         expand_to_four_channels__half_float_grey__alpha_one)
+    {
+        // 0.25 and 1.0 as IEEE 754 half floats.
+        const auto grey = std::uint16_t{0x3400};
+        auto source_bytes = std::vector<std::uint8_t>(sizeof(grey));
+        std::memcpy(source_bytes.data(), &grey, sizeof(grey));
+        auto target_bytes = std::vector<std::uint8_t>(4 * sizeof(grey));
+
+        xar_engine::asset::image::expand_to_four_channels(
+            EPixelFormat::R16_FLOAT,
+            source_bytes,
+            target_bytes);
+
+        auto target_values = std::vector<std::uint16_t>(4);
+        std::memcpy(target_values.data(), target_bytes.data(), target_bytes.size());
+        const auto one = std::uint16_t{0x3c00};
+        EXPECT_EQ(
+            target_values,
+            (std::vector<std::uint16_t>{grey, grey, grey, one}));
+    }
+
+    TEST(image,
+         expand_to_four_channels__target_too_small__throws)
+    {
+        const auto source_bytes = std::vector<std::uint8_t>{10, 20};
+        auto target_bytes = std::vector<std::uint8_t>(7);
+
+        EXPECT_THROW(
+            xar_engine::asset::image::expand_to_four_channels(
+                EPixelFormat::R8,
+                source_bytes,
+                target_bytes),
+            xar_engine::error::XarException);
+    }
+
+    TEST(image,
+         copy_with_edge_border__border_around_source__edge_pixels_repeated)
+    {
+        const auto source_bytes = std::vector<std::uint8_t>{
+            1, 2,
+            3, 4,
+        };
+        auto target_bytes = std::vector<std::uint8_t>(5 * 4);
+
+        xar_engine::asset::image::copy_with_edge_border(
+            EPixelFormat::R8,
+            2,
+            2,
+            source_bytes,
+            5,
+            4,
+            1,
+            1,
+            target_bytes);
+
+        EXPECT_EQ(
+            target_bytes,
+            (std::vector<std::uint8_t>{
+                1, 1, 2, 2, 2,
+                1, 1, 2, 2, 2,
+                3, 3, 4, 4, 4,
+                3, 3, 4, 4, 4,
+            }));
+    }
+
+    TEST(image,
+         copy_with_edge_border__source_outside_target__throws)
+    {
+        const auto source_bytes = std::vector<std::uint8_t>(4);
+        auto target_bytes = std::vector<std::uint8_t>(9);
+
+        EXPECT_THROW(
+            xar_engine::asset::image::copy_with_edge_border(
+                EPixelFormat::R8,
+                2,
+                2,
+                source_bytes,
+                3,
+                3,
+                2,
+                0,
+                target_bytes),
+            xar_engine::error::XarException);
+    }
+}
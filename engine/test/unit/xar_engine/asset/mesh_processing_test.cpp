@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <xar_engine/asset/mesh_processing.hpp>
+
+#include <xar_engine/error/exception.hpp>
+
+
+namespace
+{
+    // Unit quad in the xy plane facing +z, with texture coordinates following x and y.
+    xar_engine::asset::Mesh make_quad_mesh()
+    {
+        auto mesh = xar_engine::asset::Mesh{};
+        mesh.position_list = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+        mesh.texture_coord_list = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+        mesh.index_list = {0, 1, 2, 0, 2, 3};
+
+        return mesh;
+    }
+
+
+    TEST(mesh_processing,
+         compute_bounding_volume__box_and_sphere_enclose_positions)
+    {
+        const auto position_list = std::vector<xar_engine::math::Vector3f>{{-1.0f, 0.0f, 2.0f}, {3.0f, -2.0f, 2.0f}, {1.0f, 2.0f, 4.0f}};
+
+        const auto bounding_volume = xar_engine::asset::mesh::compute_bounding_volume(position_list);
+
+        EXPECT_EQ(bounding_volume.box_min,
+                  (xar_engine::math::Vector3f{-1.0f, -2.0f, 2.0f}));
+        EXPECT_EQ(bounding_volume.box_max,
+                  (xar_engine::math::Vector3f{3.0f, 2.0f, 4.0f}));
+        EXPECT_EQ(bounding_volume.sphere_center,
+                  (xar_engine::math::Vector3f{1.0f, 0.0f, 3.0f}));
+        EXPECT_FLOAT_EQ(bounding_volume.sphere_radius,
+                        3.0f);
+    }
+
+    TEST(mesh_processing,
+         merge_bounding_volumes__result_encloses_all_volumes)
+    {
+        const auto bounding_volume_list = std::vector<xar_engine::asset::BoundingVolume>{
+            xar_engine::asset::mesh::compute_bounding_volume(std::vector<xar_engine::math::Vector3f>{{-2.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}}),
+            xar_engine::asset::mesh::compute_bounding_volume(std::vector<xar_engine::math::Vector3f>{{1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}}),
+        };
+
+        const auto bounding_volume = xar_engine::asset::mesh::merge_bounding_volumes(bounding_volume_list);
+
+        EXPECT_EQ(bounding_volume.box_min,
+                  (xar_engine::math::Vector3f{-2.0f, 0.0f, 0.0f}));
+        EXPECT_EQ(bounding_volume.box_max,
+                  (xar_engine::math::Vector3f{2.0f, 0.0f, 0.0f}));
+        EXPECT_FLOAT_EQ(bounding_volume.sphere_radius,
+                        2.0f);
+    }
+
+    TEST(mesh_processing,
+         compute_smooth_normals__quad__normals_face_positive_z)
+    {
+        const auto mesh = make_quad_mesh();
+
+        const auto normal_list = xar_engine::asset::mesh::compute_smooth_normals(
+            mesh.position_list,
+            mesh.index_list);
+
+        ASSERT_EQ(normal_list.size(),
+                  4);
+        for (const auto& normal: normal_list)
+        {
+            EXPECT_EQ(normal,
+                      (xar_engine::math::Vector3f{0.0f, 0.0f, 1.0f}));
+        }
+    }
+
+    TEST(mesh_processing,
+         compute_tangents__mirrored_texture_coords__handedness_flips)
+    {
+        auto mesh = make_quad_mesh();
+        mesh.normal_list = xar_engine::asset::mesh::compute_smooth_normals(
+            mesh.position_list,
+            mesh.index_list);
+
+        const auto tangent_list = xar_engine::asset::mesh::compute_tangents(
+            mesh.position_list,
+            mesh.normal_list,
+            mesh.texture_coord_list,
+            mesh.index_list);
+        for (const auto& tangent: tangent_list)
+        {
+            EXPECT_EQ(tangent,
+                      (xar_engine::math::Vector4f{1.0f, 0.0f, 0.0f, 1.0f}));
+        }
+
+        for (auto& texture_coord: mesh.texture_coord_list)
+        {
+            texture_coord.y = 1.0f - texture_coord.y;
+        }
+        const auto mirrored_tangent_list = xar_engine::asset::mesh::compute_tangents(
+            mesh.position_list,
+            mesh.normal_list,
+            mesh.texture_coord_list,
+            mesh.index_list);
+        for (const auto& tangent: mirrored_tangent_list)
+        {
+            EXPECT_EQ(tangent,
+                      (xar_engine::math::Vector4f{1.0f, 0.0f, 0.0f, -1.0f}));
+        }
+    }
+
+    TEST(mesh_processing,
+         process_model__existing_normals_are_kept_and_bounds_are_set)
+    {
+        auto model = xar_engine::asset::Model{};
+        model.mesh_list.push_back(make_quad_mesh());
+        model.mesh_list.push_back(make_quad_mesh());
+        model.mesh_list[1].normal_list = {{0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+        for (auto& position: model.mesh_list[1].position_list)
+        {
+            position.z = 3.0f;
+        }
+
+        xar_engine::asset::mesh::process_model(model);
+
+        EXPECT_EQ(model.mesh_list[0].normal_list[0],
+                  (xar_engine::math::Vector3f{0.0f, 0.0f, 1.0f}));
+        EXPECT_EQ(model.mesh_list[1].normal_list[0],
+                  (xar_engine::math::Vector3f{0.0f, 1.0f, 0.0f}));
+        EXPECT_EQ(model.mesh_list[0].tangent_list.size(),
+                  4);
+        EXPECT_EQ(model.bounding_volume.box_max,
+                  (xar_engine::math::Vector3f{1.0f, 1.0f, 3.0f}));
+    }
+
+    TEST(mesh_processing,
+         process_node_list__no_nodes__root_node_owns_every_mesh)
+    {
+        auto model = xar_engine::asset::Model{};
+        model.mesh_list.resize(3);
+
+        xar_engine::asset::mesh::process_node_list(model);
+
+        EXPECT_EQ(model.node_list.parent_index_list,
+                  (std::vector<std::int32_t>{xar_engine::asset::NO_PARENT_NODE_INDEX}));
+        EXPECT_EQ(model.node_list.rotation_list[0],
+                  (xar_engine::math::Vector4f{0.0f, 0.0f, 0.0f, 1.0f}));
+        EXPECT_EQ(model.node_list.mesh_index_count_list[0],
+                  3);
+        EXPECT_EQ(model.node_list.mesh_index_list,
+                  (std::vector<std::uint32_t>{0, 1, 2}));
+    }
+
+    TEST(mesh_processing,
+         process_node_list__child_before_parent__throws)
+    {
+        auto model = xar_engine::asset::Model{};
+        model.node_list = {
+            {1, xar_engine::asset::NO_PARENT_NODE_INDEX},
+            {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}},
+            {{0.0f, 0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 0.0f, 1.0f}},
+            {{1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f}},
+            {0, 0},
+            {0, 0},
+            {},
+        };
+
+        EXPECT_THROW(
+            xar_engine::asset::mesh::process_node_list(model),
+            xar_engine::error::XarException);
+    }
+
+    TEST(mesh_processing,
+         compute_smooth_normals__index_out_of_range__throws)
+    {
+        const auto position_list = std::vector<xar_engine::math::Vector3f>{{0.0f, 0.0f, 0.0f}};
+
+        EXPECT_THROW(
+            std::ignore = xar_engine::asset::mesh::compute_smooth_normals(
+                position_list,
+                std::vector<std::uint32_t>{0, 0, 1}),
+            xar_engine::error::XarException);
+    }
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <xar_engine/asset/obj_model_loader.hpp>
+
+#include <xar_engine/error/exception.hpp>
+
+
+namespace
+{
+    std::filesystem::path write_obj_file(
+        const std::string& filename,
+        const std::string& text)
+    {
+        const auto path = std::filesystem::temp_directory_path() / filename;
+        auto file = std::ofstream{
+            path,
+            std::ios::binary
+        };
+        file << text;
+
+        return path;
+    }
+
+
+    TEST(obj_model_loader,
+         load_simple_obj__loaded_model_is_correct)
+    {
+        const auto model = xar_engine::asset::ObjModelLoader{}.load_model_from_file("resources/crate.obj");
+
+        ASSERT_EQ(model.mesh_list.size(),
+                  std::size_t{1});
+
+        EXPECT_EQ(model.mesh_list[0].position_list.size(),
+                  std::size_t{24});
+        EXPECT_TRUE(model.mesh_list[0].normal_list.empty());
+        EXPECT_EQ(model.mesh_list[0].texture_coord_list.size(),
+                  std::size_t{24});
+        EXPECT_EQ(model.mesh_list[0].index_list.size(),
+                  std::size_t{36});
+    }
+
+    TEST(obj_model_loader,
+         load_quad_with_relative_indices__vertices_shared_and_uvs_flipped)
+    {
+        const auto path = write_obj_file(
+            "obj_model_loader_test_quad.obj",
+            "v 0 0 0\r\n"
+            "v 1 0 0\r\n"
+            "v 1 1 0\r\n"
+            "v 0 1 0\r\n"
+            "vt 0 0\r\n"
+            "vt 1 0\r\n"
+            "vt 1 1\r\n"
+            "vt 0 1\r\n"
+            "f -4/-4 -3/-3 -2/-2 -1/-1\r\n");
+
+        const auto model = xar_engine::asset::ObjModelLoader{}.load_model_from_file(path);
+
+        ASSERT_EQ(model.mesh_list.size(),
+                  std::size_t{1});
+        const auto& mesh = model.mesh_list[0];
+
+        ASSERT_EQ(mesh.position_list.size(),
+                  std::size_t{4});
+        EXPECT_FLOAT_EQ(mesh.position_list[2].x,
+                        1.0f);
+        EXPECT_FLOAT_EQ(mesh.position_list[2].y,
+                        1.0f);
+        ASSERT_EQ(mesh.texture_coord_list.size(),
+                  std::size_t{4});
+        EXPECT_FLOAT_EQ(mesh.texture_coord_list[0].y,
+                        1.0f);
+        EXPECT_EQ(mesh.index_list,
+                  (std::vector<std::uint32_t>{0, 1, 2, 0, 2, 3}));
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(obj_model_loader,
+         load_two_groups__one_mesh_per_group)
+    {
+        const auto path = write_obj_file(
+            "obj_model_loader_test_groups.obj",
+            "v 0 0 0\n"
+            "v 1 0 0\n"
+            "v 1 1 0\n"
+            "vn 0 0 1\n"
+            "g first\n"
+            "f 1//1 2//1 3//1\n"
+            "g second\n"
+            "usemtl material\n"
+            "f 3//1 2//1 1//1\n"
+            "f 1//1 2//1 3//1\n");
+
+        const auto model = xar_engine::asset::ObjModelLoader{}.load_model_from_file(path);
+
+        ASSERT_EQ(model.mesh_list.size(),
+                  std::size_t{2});
+        EXPECT_EQ(model.mesh_list[0].index_list.size(),
+                  std::size_t{3});
+        EXPECT_EQ(model.mesh_list[1].position_list.size(),
+                  std::size_t{3});
+        EXPECT_EQ(model.mesh_list[1].normal_list.size(),
+                  std::size_t{3});
+        EXPECT_EQ(model.mesh_list[1].index_list.size(),
+                  std::size_t{6});
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(obj_model_loader,
+         load_face_with_missing_position__throws)
+    {
+        const auto path = write_obj_file(
+            "obj_model_loader_test_invalid.obj",
+            "v 0 0 0\n"
+            "f 1 2 3\n");
+
+        EXPECT_THROW(
+            std::ignore = xar_engine::asset::ObjModelLoader{}.load_model_from_file(path),
+            xar_engine::error::XarException);
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <xar_engine/asset/xmesh_model_file.hpp>
+
+#include <xar_engine/error/exception.hpp>
+
+
+namespace
+{
+    TEST(xmesh_model_file,
+         write_and_load__model_is_unchanged)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "xmesh_model_file_test.xmesh";
+
+        auto model = xar_engine::asset::Model{};
+        model.metadata.name = "quad";
+        model.mesh_list.push_back(
+            {
+                {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}},
+                {},
+                {{1.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f, 1.0f}},
+                {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}},
+                {0, 1, 2},
+                {
+                    {0.0f, 0.0f, 0.0f},
+                    {1.0f, 1.0f, 0.0f},
+                    {0.5f, 0.5f, 0.0f},
+                    0.75f
+                }
+            });
+        model.mesh_list.push_back(
+            {
+                {{2.0f, 3.0f, 4.0f}},
+                {{0.0f, 0.0f, 1.0f}},
+                {},
+                {},
+                {0, 0, 0, 0, 0},
+                {}
+            });
+        model.node_list = {
+            {xar_engine::asset::NO_PARENT_NODE_INDEX, 0},
+            {{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}},
+            {{0.0f, 0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f, 0.0f}},
+            {{1.0f, 1.0f, 1.0f}, {2.0f, 2.0f, 2.0f}},
+            {0, 1},
+            {1, 1},
+            {0, 1},
+        };
+        model.bounding_volume.sphere_radius = 5.0f;
+
+        xar_engine::asset::xmesh::write_model_to_file(
+            model,
+            path);
+        const auto loaded_model = xar_engine::asset::XmeshModelLoader{}.load_model_from_file(path);
+
+        EXPECT_EQ(loaded_model.metadata.name,
+                  model.metadata.name);
+        ASSERT_EQ(loaded_model.mesh_list.size(),
+                  model.mesh_list.size());
+        for (auto mesh_index = std::size_t{0}; mesh_index < model.mesh_list.size(); ++mesh_index)
+        {
+            EXPECT_EQ(loaded_model.mesh_list[mesh_index].position_list,
+                      model.mesh_list[mesh_index].position_list);
+            EXPECT_EQ(loaded_model.mesh_list[mesh_index].normal_list,
+                      model.mesh_list[mesh_index].normal_list);
+            EXPECT_EQ(loaded_model.mesh_list[mesh_index].tangent_list,
+                      model.mesh_list[mesh_index].tangent_list);
+            EXPECT_EQ(loaded_model.mesh_list[mesh_index].texture_coord_list,
+                      model.mesh_list[mesh_index].texture_coord_list);
+            EXPECT_EQ(loaded_model.mesh_list[mesh_index].index_list,
+                      model.mesh_list[mesh_index].index_list);
+            EXPECT_EQ(loaded_model.mesh_list[mesh_index].bounding_volume.box_max,
+                      model.mesh_list[mesh_index].bounding_volume.box_max);
+            EXPECT_FLOAT_EQ(loaded_model.mesh_list[mesh_index].bounding_volume.sphere_radius,
+                            model.mesh_list[mesh_index].bounding_volume.sphere_radius);
+        }
+        EXPECT_FLOAT_EQ(loaded_model.bounding_volume.sphere_radius,
+                        model.bounding_volume.sphere_radius);
+
+        EXPECT_EQ(loaded_model.node_list.parent_index_list,
+                  model.node_list.parent_index_list);
+        EXPECT_EQ(loaded_model.node_list.translation_list,
+                  model.node_list.translation_list);
+        EXPECT_EQ(loaded_model.node_list.rotation_list,
+                  model.node_list.rotation_list);
+        EXPECT_EQ(loaded_model.node_list.scale_list,
+                  model.node_list.scale_list);
+        EXPECT_EQ(loaded_model.node_list.mesh_index_offset_list,
+                  model.node_list.mesh_index_offset_list);
+        EXPECT_EQ(loaded_model.node_list.mesh_index_count_list,
+                  model.node_list.mesh_index_count_list);
+        EXPECT_EQ(loaded_model.node_list.mesh_index_list,
+                  model.node_list.mesh_index_list);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(xmesh_model_file,
+         load_file_without_header__throws)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "xmesh_model_file_test_invalid.xmesh";
+        {
+            auto file = std::ofstream{path};
+            file << "not an xmesh file, but long enough to hold a header";
+        }
+
+        EXPECT_THROW(
+            std::ignore = xar_engine::asset::XmeshModelLoader{}.load_model_from_file(path),
+            xar_engine::error::XarException);
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <xar_engine/asset/xtex_image_file.hpp>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/file/file.hpp>
+
+
+namespace
+{
+    TEST(xtex_image_file,
+         write_and_decode__image_is_unchanged)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "xtex_image_file_test.xtex";
+
+        auto image = xar_engine::asset::Image{};
+        image.pixel_format = xar_engine::asset::EPixelFormat::R8G8;
+        image.channel_count = 2;
+        image.pixel_width = 2;
+        image.pixel_height = 1;
+        image.mip_level_count = 2;
+        image.bytes = {1, 2, 3, 4};
+
+        xar_engine::asset::xtex::write_image_to_file(
+            image,
+            path);
+        const auto file_bytes = xar_engine::file::read_binary_file(path);
+        const auto file_byte_span = std::span<const std::uint8_t>{
+            reinterpret_cast<const std::uint8_t*>(file_bytes.data()),
+            file_bytes.size()
+        };
+
+        EXPECT_EQ(xar_engine::asset::image::detect_file_type(file_byte_span),
+                  xar_engine::asset::EImageFileType::XTEX);
+
+        const auto decoded_image = xar_engine::asset::XtexImageDecoder{}.decode_image(file_byte_span);
+        EXPECT_EQ(decoded_image.bytes,
+                  image.bytes);
+        EXPECT_EQ(decoded_image.pixel_format,
+                  image.pixel_format);
+        EXPECT_EQ(decoded_image.channel_count,
+                  image.channel_count);
+        EXPECT_EQ(decoded_image.pixel_width,
+                  image.pixel_width);
+        EXPECT_EQ(decoded_image.pixel_height,
+                  image.pixel_height);
+        EXPECT_EQ(decoded_image.mip_level_count,
+                  image.mip_level_count);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(xtex_image_file,
+         read_image_layout__pixel_offset_is_aligned_and_bytes_are_empty)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "xtex_image_file_layout_test.xtex";
+
+        auto image = xar_engine::asset::Image{};
+        image.pixel_format = xar_engine::asset::EPixelFormat::R8G8B8A8;
+        image.channel_count = 4;
+        image.pixel_width = 1;
+        image.pixel_height = 2;
+        image.mip_level_count = 1;
+        image.bytes = {1, 2, 3, 4, 5, 6, 7, 8};
+
+        xar_engine::asset::xtex::write_image_to_file(
+            image,
+            path);
+        const auto file_bytes = xar_engine::file::read_binary_file(path);
+        const auto file_byte_span = std::span<const std::uint8_t>{
+            reinterpret_cast<const std::uint8_t*>(file_bytes.data()),
+            file_bytes.size()
+        };
+
+        const auto image_layout = xar_engine::asset::xtex::read_image_layout(file_byte_span);
+        EXPECT_TRUE(image_layout.image.bytes.empty());
+        EXPECT_EQ(image_layout.image.pixel_height,
+                  2);
+        EXPECT_EQ(image_layout.pixel_byte_offset % 16,
+                  0);
+        EXPECT_EQ(file_byte_span[image_layout.pixel_byte_offset + 4],
+                  5);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST(xtex_image_file,
+         decode_truncated_image__throws)
+    {
+        const auto file_bytes = std::vector<std::uint8_t>{'X', 'T', 'E', 'X', 1, 0, 0, 0};
+
+        EXPECT_THROW(
+            std::ignore = xar_engine::asset::XtexImageDecoder{}.decode_image(file_bytes),
+            xar_engine::error::XarException);
+    }
+}
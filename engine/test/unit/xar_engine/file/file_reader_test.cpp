@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/file/file_reader.hpp>
+#include <xar_engine/file/io_uring_file_reader.hpp>
+
+
+namespace
+{
+    std::vector<std::filesystem::path> write_test_files()
+    {
+        auto path_list = std::vector<std::filesystem::path>{};
+        for (auto file_index = std::uint32_t{0}; file_index < 100; ++file_index)
+        {
+            const auto& path = path_list.emplace_back(
+                std::filesystem::temp_directory_path() / ("file_reader_test_" + std::to_string(file_index) + ".bin"));
+
+            auto file = std::ofstream{
+                path,
+                std::ios::binary
+            };
+            for (auto byte_index = std::uint32_t{0}; byte_index < file_index * 37; ++byte_index)
+            {
+                file.put(static_cast<char>(file_index + byte_index));
+            }
+        }
+
+        return path_list;
+    }
+
+    void expect_test_files(const std::vector<std::vector<std::uint8_t>>& file_bytes_list)
+    {
+        ASSERT_EQ(file_bytes_list.size(),
+                  100);
+        for (auto file_index = std::uint32_t{0}; file_index < file_bytes_list.size(); ++file_index)
+        {
+            ASSERT_EQ(file_bytes_list[file_index].size(),
+                      file_index * 37);
+            for (auto byte_index = std::uint32_t{0}; byte_index < file_bytes_list[file_index].size(); ++byte_index)
+            {
+                ASSERT_EQ(file_bytes_list[file_index][byte_index],
+                          static_cast<std::uint8_t>(file_index + byte_index));
+            }
+        }
+    }
+
+    void expect_partial_and_failed_reads(xar_engine::file::IFileReader& file_reader)
+    {
+        const auto path_list = write_test_files();
+
+        auto buffer = std::vector<std::uint8_t>(64);
+        const auto request_list = std::vector<xar_engine::file::FileReadRequest>{
+            {
+                path_list[2],
+                70,
+                buffer
+            }
+        };
+
+        EXPECT_EQ(file_reader.read_files(request_list),
+                  (std::vector<std::uint64_t>{4}));
+        EXPECT_EQ(buffer[0],
+                  static_cast<std::uint8_t>(72));
+
+        EXPECT_THROW(
+            (void) xar_engine::file::read_whole_file_list(
+                file_reader,
+                {std::filesystem::temp_directory_path() / "file_reader_test_missing.bin"}),
+            xar_engine::error::XarException);
+    }
+
+
+    TEST(thread_pool_file_reader,
+         read_whole_file_list__files_are_read)
+    {
+        auto file_reader = xar_engine::file::ThreadPoolFileReader{4};
+
+        expect_test_files(
+            xar_engine::file::read_whole_file_list(
+                file_reader,
+                write_test_files()));
+    }
+
+    TEST(thread_pool_file_reader,
+         read_files__past_end_of_file__reads_are_partial)
+    {
+        auto file_reader = xar_engine::file::ThreadPoolFileReader{2};
+
+        expect_partial_and_failed_reads(file_reader);
+    }
+
+    TEST(file_reader_factory,
+         read_whole_file_list__files_are_read)
+    {
+        const auto file_reader = xar_engine::file::FileReaderFactory().make();
+
+        expect_test_files(
+            xar_engine::file::read_whole_file_list(
+                *file_reader,
+                write_test_files()));
+    }
+
+#ifdef XAR_ENGINE_HAS_IO_URING
+    TEST(io_uring_file_reader,
+         read_files__past_end_of_file__reads_are_partial)
+    {
+        auto file_reader = std::unique_ptr<xar_engine::file::IoUringFileReader>{};
+        try
+        {
+            file_reader = std::make_unique<xar_engine::file::IoUringFileReader>();
+        }
+        catch (const xar_engine::error::XarException&)
+        {
+            GTEST_SKIP() << "io_uring is not available";
+        }
+
+        expect_partial_and_failed_reads(*file_reader);
+    }
+#endif
+}
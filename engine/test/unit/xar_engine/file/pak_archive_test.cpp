@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/file/pak_archive.hpp>
+#include <xar_engine/file/virtual_file_system.hpp>
+
+
+namespace
+{
+    std::vector<std::uint8_t> to_bytes(const std::string& text)
+    {
+        return {
+            text.begin(),
+            text.end()
+        };
+    }
+
+
+    TEST(pak_archive,
+         write_and_read__files_are_unchanged)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "pak_archive_test.xpak";
+        auto thread_pool = xar_engine::thread::ThreadPool{2};
+
+        auto pak_archive_writer = xar_engine::file::PakArchiveWriter{};
+        pak_archive_writer.add_file(
+            "textures/b.xtex",
+            to_bytes("second file"),
+            xar_engine::file::EPakCompression::NONE);
+        pak_archive_writer.add_file(
+            "models/a.xmesh",
+            to_bytes("first file"),
+            xar_engine::file::EPakCompression::NONE);
+        pak_archive_writer.add_file(
+            "empty",
+            {},
+            xar_engine::file::EPakCompression::NONE);
+        pak_archive_writer.write_to_file(
+            path,
+            thread_pool);
+
+        {
+            const auto pak_file_archive = xar_engine::file::PakFileArchive{path};
+
+            EXPECT_EQ(pak_file_archive.get_virtual_path_list(),
+                      (std::vector<std::string>{"empty", "models/a.xmesh", "textures/b.xtex"}));
+            EXPECT_TRUE(pak_file_archive.contains("models/a.xmesh"));
+            EXPECT_FALSE(pak_file_archive.contains("models/c.xmesh"));
+
+            EXPECT_EQ(pak_file_archive.read_file("models/a.xmesh"),
+                      to_bytes("first file"));
+            EXPECT_EQ(pak_file_archive.read_file("textures/b.xtex"),
+                      to_bytes("second file"));
+            EXPECT_TRUE(pak_file_archive.read_file("empty").empty());
+
+            const auto file_view = pak_file_archive.get_file_view("textures/b.xtex");
+            ASSERT_TRUE(file_view.has_value());
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(file_view->data()) % 64,
+                      0u);
+            EXPECT_EQ(std::vector<std::uint8_t>(file_view->begin(), file_view->end()),
+                      to_bytes("second file"));
+
+            EXPECT_THROW(
+                std::ignore = pak_file_archive.read_file("missing"),
+                xar_engine::error::XarException);
+        }
+
+        std::filesystem::remove(path);
+    }
+
+    void expect_compressed_round_trip(xar_engine::file::EPakCompression compression)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "pak_archive_test_compressed.xpak";
+        auto thread_pool = xar_engine::thread::ThreadPool{2};
+
+        auto repeated_bytes = std::vector<std::uint8_t>{};
+        for (auto index = 0; index < 4096; ++index)
+        {
+            repeated_bytes.push_back(static_cast<std::uint8_t>(index % 7));
+        }
+
+        auto pak_archive_writer = xar_engine::file::PakArchiveWriter{};
+        pak_archive_writer.add_file(
+            "repeated",
+            repeated_bytes,
+            compression);
+        pak_archive_writer.add_file(
+            "text",
+            to_bytes("short compressed file"),
+            compression);
+        pak_archive_writer.add_file(
+            "uncompressed",
+            to_bytes("uncompressed file"),
+            xar_engine::file::EPakCompression::NONE);
+        pak_archive_writer.write_to_file(
+            path,
+            thread_pool);
+
+        EXPECT_LT(std::filesystem::file_size(path),
+                  repeated_bytes.size());
+
+        {
+            const auto pak_file_archive = xar_engine::file::PakFileArchive{path};
+
+            EXPECT_EQ(pak_file_archive.read_file("repeated"),
+                      repeated_bytes);
+            EXPECT_EQ(pak_file_archive.read_file("text"),
+                      to_bytes("short compressed file"));
+            EXPECT_EQ(pak_file_archive.read_file("uncompressed"),
+                      to_bytes("uncompressed file"));
+
+            EXPECT_FALSE(pak_file_archive.get_file_view("repeated").has_value());
+            EXPECT_TRUE(pak_file_archive.get_file_view("uncompressed").has_value());
+        }
+
+        std::filesystem::remove(path);
+    }
+
+
+#ifdef XAR_ENGINE_WITH_LZ4
+    TEST(pak_archive,
+         write_and_read__lz4_compression__files_are_unchanged)
+    {
+        expect_compressed_round_trip(xar_engine::file::EPakCompression::LZ4);
+    }
+#else
+    TEST(pak_archive,
+         write_to_file__lz4_compression_not_built__throws)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{2};
+
+        auto pak_archive_writer = xar_engine::file::PakArchiveWriter{};
+        pak_archive_writer.add_file(
+            "compressed",
+            to_bytes("compressed file"),
+            xar_engine::file::EPakCompression::LZ4);
+
+        EXPECT_FALSE(xar_engine::file::pak::is_compression_supported(xar_engine::file::EPakCompression::LZ4));
+        EXPECT_THROW(
+            pak_archive_writer.write_to_file(
+                std::filesystem::temp_directory_path() / "pak_archive_test_unsupported.xpak",
+                thread_pool),
+            xar_engine::error::XarException);
+    }
+#endif
+
+#ifdef XAR_ENGINE_WITH_ZSTD
+    TEST(pak_archive,
+         write_and_read__zstd_compression__files_are_unchanged)
+    {
+        expect_compressed_round_trip(xar_engine::file::EPakCompression::ZSTD);
+    }
+#endif
+
+    TEST(virtual_file_system,
+         read_file__later_mount_shadows_earlier_mount)
+    {
+        const auto pak_path = std::filesystem::temp_directory_path() / "virtual_file_system_test.xpak";
+        const auto directory_path = std::filesystem::temp_directory_path() / "virtual_file_system_test";
+        auto thread_pool = xar_engine::thread::ThreadPool{2};
+
+        auto pak_archive_writer = xar_engine::file::PakArchiveWriter{};
+        pak_archive_writer.add_file(
+            "shadowed",
+            to_bytes("packed"),
+            xar_engine::file::EPakCompression::NONE);
+        pak_archive_writer.add_file(
+            "packed_only",
+            to_bytes("packed only"),
+            xar_engine::file::EPakCompression::NONE);
+        pak_archive_writer.write_to_file(
+            pak_path,
+            thread_pool);
+
+        std::filesystem::create_directories(directory_path);
+        {
+            auto file = std::ofstream{directory_path / "shadowed"};
+            file << "loose";
+        }
+
+        {
+            auto virtual_file_system = xar_engine::file::VirtualFileSystem{};
+            virtual_file_system.mount(std::make_unique<xar_engine::file::PakFileArchive>(pak_path));
+            virtual_file_system.mount(std::make_unique<xar_engine::file::DirectoryFileArchive>(directory_path));
+
+            EXPECT_EQ(virtual_file_system.read_file_list(
+                          {"shadowed", "packed_only"},
+                          thread_pool),
+                      (std::vector<std::vector<std::uint8_t>>{to_bytes("loose"), to_bytes("packed only")}));
+            EXPECT_FALSE(virtual_file_system.contains("missing"));
+        }
+
+        std::filesystem::remove(pak_path);
+        std::filesystem::remove_all(directory_path);
+    }
+}
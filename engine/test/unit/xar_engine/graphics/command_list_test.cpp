@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/graphics/api/command_list.hpp>
+
+#include <xar_engine/meta/overloaded.hpp>
+
+
+namespace
+{
+    using namespace xar_engine::graphics::api;
+
+
+    TEST(command_list,
+         record__all_command_types__replayed_in_order_with_payload)
+    {
+        const auto descriptor_set_list = std::array<NativeHandle, 2>{11, 12};
+        const auto vertex_buffer_list = std::array<NativeHandle, 3>{21, 22, 23};
+        const auto vertex_buffer_offset_list = std::array<std::uint64_t, 3>{0, 64, 128};
+        const auto push_constant_data = std::array<std::uint8_t, 5>{1, 2, 3, 4, 5};
+
+        auto command_list = CommandList{};
+        command_list.set_graphics_pipeline(1, 800, 600);
+        command_list.set_descriptor_set_list(2, 0, descriptor_set_list);
+        command_list.set_vertex_buffer_list(0, vertex_buffer_list, vertex_buffer_offset_list);
+        command_list.set_index_buffer(3, 16);
+        command_list.push_constants(2, EShaderType::VERTEX, 4, std::as_bytes(std::span{push_constant_data}));
+        command_list.draw_indexed(36, 1, 0, -2, 0);
+
+        EXPECT_EQ(command_list.get_command_counts(), 6);
+        EXPECT_EQ(command_list.get_byte_size() % alignof(NativeHandle), 0);
+
+        auto type_list = std::vector<ECommandType>{};
+        command_list.for_each_command(
+            xar_engine::meta::TOverloaded{
+                [&](const command::SetGraphicsPipeline& command)
+                {
+                    type_list.push_back(command.TYPE);
+                    EXPECT_EQ(command.pipeline, 1);
+                    EXPECT_EQ(command.extent_width, 800);
+                    EXPECT_EQ(command.extent_height, 600);
+                },
+                [&](const command::SetDescriptorSetList& command)
+                {
+                    type_list.push_back(command.TYPE);
+                    EXPECT_EQ(command.pipeline_layout, 2);
+                    EXPECT_EQ(command.first_set, 0);
+                    EXPECT_TRUE(std::ranges::equal(command.get_descriptor_set_list(), descriptor_set_list));
+                },
+                [&](const command::SetVertexBufferList& command)
+                {
+                    type_list.push_back(command.TYPE);
+                    EXPECT_EQ(command.first_slot, 0);
+                    EXPECT_TRUE(std::ranges::equal(command.get_vertex_buffer_list(), vertex_buffer_list));
+                    EXPECT_TRUE(std::ranges::equal(command.get_vertex_buffer_offset_list(), vertex_buffer_offset_list));
+                },
+                [&](const command::SetIndexBuffer& command)
+                {
+                    type_list.push_back(command.TYPE);
+                    EXPECT_EQ(command.index_buffer, 3);
+                    EXPECT_EQ(command.byte_offset, 16);
+                },
+                [&](const command::PushConstants& command)
+                {
+                    type_list.push_back(command.TYPE);
+                    EXPECT_EQ(command.pipeline_layout, 2);
+                    EXPECT_EQ(command.shader_type, EShaderType::VERTEX);
+                    EXPECT_EQ(command.byte_offset, 4);
+                    EXPECT_TRUE(std::ranges::equal(command.get_data(), std::as_bytes(std::span{push_constant_data})));
+                },
+                [&](const command::DrawIndexed& command)
+                {
+                    type_list.push_back(command.TYPE);
+                    EXPECT_EQ(command.index_counts, 36);
+                    EXPECT_EQ(command.instance_counts, 1);
+                    EXPECT_EQ(command.first_index, 0);
+                    EXPECT_EQ(command.vertex_offset, -2);
+                    EXPECT_EQ(command.first_instance, 0);
+                },
+            });
+
+        EXPECT_EQ(
+            type_list,
+            (std::vector<ECommandType>{
+                ECommandType::SET_GRAPHICS_PIPELINE,
+                ECommandType::SET_DESCRIPTOR_SET_LIST,
+                ECommandType::SET_VERTEX_BUFFER_LIST,
+                ECommandType::SET_INDEX_BUFFER,
+                ECommandType::PUSH_CONSTANTS,
+                ECommandType::DRAW_INDEXED,
+            }));
+    }
+
+    TEST(command_list,
+         clear__recorded_commands__list_empty_and_recordable)
+    {
+        auto command_list = CommandList{};
+        command_list.draw_indexed(3, 1, 0, 0, 0);
+        command_list.clear();
+
+        EXPECT_EQ(command_list.get_command_counts(), 0);
+        EXPECT_EQ(command_list.get_byte_size(), 0);
+
+        command_list.set_index_buffer(7, 0);
+
+        auto command_counts = 0;
+        command_list.for_each_command(
+            [&](const auto& command)
+            {
+                ++command_counts;
+                EXPECT_EQ(command.TYPE, ECommandType::SET_INDEX_BUFFER);
+            });
+        EXPECT_EQ(command_counts, 1);
+    }
+
+    TEST(command_list,
+         set_vertex_buffer_list__offset_count_mismatch__throws)
+    {
+        const auto vertex_buffer_list = std::array<NativeHandle, 2>{1, 2};
+        const auto vertex_buffer_offset_list = std::array<std::uint64_t, 1>{0};
+
+        auto command_list = CommandList{};
+        EXPECT_THROW(
+            command_list.set_vertex_buffer_list(0, vertex_buffer_list, vertex_buffer_offset_list),
+            xar_engine::error::XarException);
+        EXPECT_EQ(command_list.get_command_counts(), 0);
+    }
+}
@@ -0,0 +1,661 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/math/batch.hpp>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace
+{
+    constexpr auto TOLERANCE = 1e-4f;
+
+    xar_engine::math::Matrix4x4f make_test_matrix()
+    {
+        auto matrix = xar_engine::math::rotate_matrix(
+            xar_engine::math::make_identity_matrix(),
+            30.0f,
+            xar_engine::math::Vector3f{1.0f, 2.0f, 3.0f});
+        matrix.as_column_list[3] = {4.0f, -5.0f, 6.0f, 1.0f};
+
+        return matrix;
+    }
+
+    std::vector<xar_engine::math::Vector3f> make_random_vector_list(const std::size_t count)
+    {
+        auto random_engine = std::mt19937{42};
+        auto distribution = std::uniform_real_distribution<float>{-10.0f, 10.0f};
+
+        auto vector_list = std::vector<xar_engine::math::Vector3f>(count);
+        for (auto& vector: vector_list)
+        {
+            vector = {distribution(random_engine), distribution(random_engine), distribution(random_engine)};
+        }
+
+        return vector_list;
+    }
+
+    struct SoaVectorList
+    {
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> z;
+
+        explicit SoaVectorList(const std::vector<xar_engine::math::Vector3f>& vector_list)
+        {
+            for (const auto& vector: vector_list)
+            {
+                x.push_back(vector.x);
+                y.push_back(vector.y);
+                z.push_back(vector.z);
+            }
+        }
+
+        xar_engine::math::ConstVector3fSoaSpan as_const_span() const
+        {
+            return {x, y, z};
+        }
+
+        xar_engine::math::Vector3fSoaSpan as_span()
+        {
+            return {x, y, z};
+        }
+    };
+
+    void expect_soa_near(
+        const SoaVectorList& soa_vector_list,
+        const std::vector<xar_engine::math::Vector3f>& vector_list)
+    {
+        ASSERT_EQ(soa_vector_list.x.size(),
+                  vector_list.size());
+
+        for (auto index = std::size_t{0}; index < vector_list.size(); ++index)
+        {
+            EXPECT_NEAR(soa_vector_list.x[index],
+                        vector_list[index].x,
+                        TOLERANCE);
+            EXPECT_NEAR(soa_vector_list.y[index],
+                        vector_list[index].y,
+                        TOLERANCE);
+            EXPECT_NEAR(soa_vector_list.z[index],
+                        vector_list[index].z,
+                        TOLERANCE);
+        }
+    }
+
+
+    void expect_matrix_near(
+        const xar_engine::math::Matrix4x4f& left,
+        const xar_engine::math::Matrix4x4f& right)
+    {
+        for (auto index = 0; index < 16; ++index)
+        {
+            EXPECT_NEAR(left.as_scalar_list[index],
+                        right.as_scalar_list[index],
+                        TOLERANCE);
+        }
+    }
+
+
+    TEST(batch,
+         transform_points__count_not_multiple_of_width__matches_single_point_transform)
+    {
+        const auto matrix = make_test_matrix();
+        const auto point_list = make_random_vector_list(37);
+
+        auto expected_list = std::vector<xar_engine::math::Vector3f>{};
+        for (const auto& point: point_list)
+        {
+            expected_list.push_back(
+                xar_engine::math::transform_point(
+                    matrix,
+                    point));
+        }
+
+        auto aos_result_list = std::vector<xar_engine::math::Vector3f>(point_list.size());
+        xar_engine::math::transform_points(
+            point_list,
+            matrix,
+            aos_result_list);
+        for (auto index = std::size_t{0}; index < point_list.size(); ++index)
+        {
+            EXPECT_EQ(aos_result_list[index],
+                      expected_list[index]);
+        }
+
+        auto soa_point_list = SoaVectorList{point_list};
+        auto soa_result_list = SoaVectorList{point_list};
+        xar_engine::math::transform_points(
+            soa_point_list.as_const_span(),
+            matrix,
+            soa_result_list.as_span());
+        expect_soa_near(
+            soa_result_list,
+            expected_list);
+    }
+
+    TEST(batch,
+         transform_vectors__in_place__ignores_translation)
+    {
+        const auto matrix = make_test_matrix();
+        const auto vector_list = make_random_vector_list(21);
+
+        auto expected_list = std::vector<xar_engine::math::Vector3f>{};
+        for (const auto& vector: vector_list)
+        {
+            expected_list.push_back(
+                xar_engine::math::transform_vector(
+                    matrix,
+                    vector));
+        }
+
+        auto soa_vector_list = SoaVectorList{vector_list};
+        xar_engine::math::transform_vectors(
+            soa_vector_list.as_const_span(),
+            matrix,
+            soa_vector_list.as_span());
+        expect_soa_near(
+            soa_vector_list,
+            expected_list);
+    }
+
+    TEST(batch,
+         transform_points__thread_pool_and_large_input__matches_single_thread)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{4};
+
+        const auto matrix = make_test_matrix();
+        const auto point_list = make_random_vector_list(50'000);
+
+        auto soa_point_list = SoaVectorList{point_list};
+        auto single_thread_result_list = SoaVectorList{point_list};
+        auto thread_pool_result_list = SoaVectorList{point_list};
+
+        xar_engine::math::transform_points(
+            soa_point_list.as_const_span(),
+            matrix,
+            single_thread_result_list.as_span());
+        xar_engine::math::transform_points(
+            soa_point_list.as_const_span(),
+            matrix,
+            thread_pool_result_list.as_span(),
+            thread_pool);
+
+        EXPECT_EQ(thread_pool_result_list.x,
+                  single_thread_result_list.x);
+        EXPECT_EQ(thread_pool_result_list.y,
+                  single_thread_result_list.y);
+        EXPECT_EQ(thread_pool_result_list.z,
+                  single_thread_result_list.z);
+    }
+
+    TEST(batch,
+         multiply_matrices__matches_matrix_product)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{2};
+
+        const auto left = make_test_matrix();
+        auto right_list = std::vector<xar_engine::math::Matrix4x4f>{};
+        for (auto index = 0; index < 5; ++index)
+        {
+            right_list.push_back(
+                xar_engine::math::scale_matrix(
+                    left,
+                    xar_engine::math::Vector3f{1.0f + index, 2.0f, 0.5f}));
+        }
+
+        auto pairwise_result_list = std::vector<xar_engine::math::Matrix4x4f>(right_list.size());
+        xar_engine::math::multiply_matrices(
+            right_list,
+            right_list,
+            pairwise_result_list);
+
+        auto broadcast_result_list = std::vector<xar_engine::math::Matrix4x4f>(right_list.size());
+        xar_engine::math::multiply_matrices(
+            left,
+            right_list,
+            broadcast_result_list,
+            thread_pool);
+
+        for (auto index = std::size_t{0}; index < right_list.size(); ++index)
+        {
+            expect_matrix_near(
+                pairwise_result_list[index],
+                right_list[index] * right_list[index]);
+            expect_matrix_near(
+                broadcast_result_list[index],
+                left * right_list[index]);
+        }
+    }
+
+    TEST(batch,
+         transform_aabbs__rotation_and_translation__encloses_transformed_corners)
+    {
+        const auto matrix = make_test_matrix();
+        const auto aabb_list = std::vector<xar_engine::math::Aabb>{
+            {{-1.0f, -2.0f, -3.0f}, {1.0f, 2.0f, 3.0f}},
+            {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}},
+            {{5.0f, -1.0f, 2.0f}, {7.0f, 4.0f, 2.5f}},
+        };
+
+        auto result_list = std::vector<xar_engine::math::Aabb>(aabb_list.size());
+        xar_engine::math::transform_aabbs(
+            aabb_list,
+            matrix,
+            result_list);
+
+        for (auto index = std::size_t{0}; index < aabb_list.size(); ++index)
+        {
+            const auto& aabb = aabb_list[index];
+
+            auto expected_min = xar_engine::math::Vector3f{1e9f, 1e9f, 1e9f};
+            auto expected_max = xar_engine::math::Vector3f{-1e9f, -1e9f, -1e9f};
+            for (auto corner = 0; corner < 8; ++corner)
+            {
+                const auto transformed_corner = xar_engine::math::transform_point(
+                    matrix,
+                    xar_engine::math::Vector3f{
+                        (corner & 1) ? aabb.max.x : aabb.min.x,
+                        (corner & 2) ? aabb.max.y : aabb.min.y,
+                        (corner & 4) ? aabb.max.z : aabb.min.z,
+                    });
+
+                expected_min = {
+                    std::min(expected_min.x, transformed_corner.x),
+                    std::min(expected_min.y, transformed_corner.y),
+                    std::min(expected_min.z, transformed_corner.z),
+                };
+                expected_max = {
+                    std::max(expected_max.x, transformed_corner.x),
+                    std::max(expected_max.y, transformed_corner.y),
+                    std::max(expected_max.z, transformed_corner.z),
+                };
+            }
+
+            EXPECT_NEAR(result_list[index].min.x, expected_min.x, TOLERANCE);
+            EXPECT_NEAR(result_list[index].min.y, expected_min.y, TOLERANCE);
+            EXPECT_NEAR(result_list[index].min.z, expected_min.z, TOLERANCE);
+            EXPECT_NEAR(result_list[index].max.x, expected_max.x, TOLERANCE);
+            EXPECT_NEAR(result_list[index].max.y, expected_max.y, TOLERANCE);
+            EXPECT_NEAR(result_list[index].max.z, expected_max.z, TOLERANCE);
+        }
+    }
+
+    struct SoaAabbList
+    {
+        std::vector<xar_engine::math::Aabb> aabb_list;
+        std::vector<float> component_list[6];
+
+        explicit SoaAabbList(const std::size_t count)
+        {
+            const auto center_list = make_random_vector_list(count);
+            const auto extent_list = make_random_vector_list(count + 1);
+            for (auto index = std::size_t{0}; index < count; ++index)
+            {
+                const auto& extent = extent_list[index + 1];
+                const auto half_extent = xar_engine::math::Vector3f{std::abs(extent.x), std::abs(extent.y), std::abs(extent.z)} * 0.2f;
+                const auto aabb = xar_engine::math::Aabb{center_list[index] - half_extent, center_list[index] + half_extent};
+
+                aabb_list.push_back(aabb);
+                component_list[0].push_back(aabb.min.x);
+                component_list[1].push_back(aabb.min.y);
+                component_list[2].push_back(aabb.min.z);
+                component_list[3].push_back(aabb.max.x);
+                component_list[4].push_back(aabb.max.y);
+                component_list[5].push_back(aabb.max.z);
+            }
+        }
+
+        xar_engine::math::AabbSoaSpan as_span() const
+        {
+            return {
+                component_list[0],
+                component_list[1],
+                component_list[2],
+                component_list[3],
+                component_list[4],
+                component_list[5],
+            };
+        }
+    };
+
+    xar_engine::math::Frustum make_test_frustum()
+    {
+        const auto view = xar_engine::math::make_view_matrix(
+            {0.0f, 0.0f, 0.0f},
+            {1.0f, 0.5f, 0.0f},
+            {0.0f, 0.0f, 1.0f});
+        const auto projection = xar_engine::math::make_projection_matrix(
+            60.0f,
+            1.5f,
+            0.5f,
+            8.0f);
+
+        return xar_engine::math::make_frustum(projection * view);
+    }
+
+    void expect_distance_near(
+        const float distance,
+        const std::optional<float>& expected_distance)
+    {
+        if (!expected_distance.has_value())
+        {
+            EXPECT_EQ(distance,
+                      std::numeric_limits<float>::infinity());
+            return;
+        }
+
+        EXPECT_NEAR(distance,
+                    *expected_distance,
+                    TOLERANCE);
+    }
+
+
+    TEST(batch,
+         cull_aabbs_and_spheres__match_single_primitive_tests)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{4};
+
+        const auto frustum = make_test_frustum();
+        const auto soa_aabb_list = SoaAabbList{40'000};
+        const auto count = soa_aabb_list.aabb_list.size();
+
+        auto visible_list = std::vector<std::uint8_t>(count);
+        xar_engine::math::cull_aabbs(
+            frustum,
+            soa_aabb_list.as_span(),
+            visible_list,
+            thread_pool);
+
+        // Sphere lists reuse the box centers, with the max x list standing in for the radius.
+        auto sphere_visible_list = std::vector<std::uint8_t>(count);
+        auto radius_list = std::vector<float>{};
+        std::vector<float> center_list[3];
+        for (const auto& aabb: soa_aabb_list.aabb_list)
+        {
+            center_list[0].push_back((aabb.min.x + aabb.max.x) * 0.5f);
+            center_list[1].push_back((aabb.min.y + aabb.max.y) * 0.5f);
+            center_list[2].push_back((aabb.min.z + aabb.max.z) * 0.5f);
+            radius_list.push_back((aabb.max.x - aabb.min.x) * 0.5f);
+        }
+        xar_engine::math::cull_spheres(
+            frustum,
+            xar_engine::math::BoundingSphereSoaSpan{center_list[0], center_list[1], center_list[2], radius_list},
+            sphere_visible_list);
+
+        auto visible_count = std::size_t{0};
+        for (auto index = std::size_t{0}; index < count; ++index)
+        {
+            const auto& aabb = soa_aabb_list.aabb_list[index];
+            ASSERT_EQ(visible_list[index] != 0,
+                      xar_engine::math::intersects(frustum, aabb)) << index;
+
+            const auto sphere = xar_engine::math::BoundingSphere{
+                {center_list[0][index], center_list[1][index], center_list[2][index]},
+                radius_list[index],
+            };
+            ASSERT_EQ(sphere_visible_list[index] != 0,
+                      xar_engine::math::intersects(frustum, sphere)) << index;
+
+            visible_count += visible_list[index];
+        }
+
+        EXPECT_GT(visible_count,
+                  0);
+        EXPECT_LT(visible_count,
+                  count);
+    }
+
+    TEST(batch,
+         intersect_aabbs__matches_single_primitive_test)
+    {
+        const auto soa_aabb_list = SoaAabbList{37};
+        const auto query = xar_engine::math::Aabb{{-4.0f, -4.0f, -4.0f}, {3.0f, 5.0f, 2.0f}};
+
+        auto overlap_list = std::vector<std::uint8_t>(soa_aabb_list.aabb_list.size());
+        xar_engine::math::intersect_aabbs(
+            query,
+            soa_aabb_list.as_span(),
+            overlap_list);
+
+        for (auto index = std::size_t{0}; index < overlap_list.size(); ++index)
+        {
+            EXPECT_EQ(overlap_list[index] != 0,
+                      xar_engine::math::intersects(soa_aabb_list.aabb_list[index], query));
+        }
+    }
+
+    TEST(batch,
+         intersect_ray__aabbs_and_triangles__match_single_primitive_tests)
+    {
+        const auto soa_aabb_list = SoaAabbList{37};
+
+        // Aimed at the center of one box, the others are hit or missed at random.
+        const auto& target_aabb = soa_aabb_list.aabb_list[3];
+        const auto direction = xar_engine::math::Vector3f{1.0f, 0.05f, 0.02f};
+        const auto ray = xar_engine::math::Ray{(target_aabb.min + target_aabb.max) * 0.5f - direction * 12.0f, direction};
+        auto aabb_distance_list = std::vector<float>(soa_aabb_list.aabb_list.size());
+        xar_engine::math::intersect_ray(
+            ray,
+            soa_aabb_list.as_span(),
+            aabb_distance_list);
+
+        auto hit_count = 0;
+        for (auto index = std::size_t{0}; index < aabb_distance_list.size(); ++index)
+        {
+            const auto expected_distance = xar_engine::math::intersect_ray(
+                ray,
+                soa_aabb_list.aabb_list[index]);
+            expect_distance_near(
+                aabb_distance_list[index],
+                expected_distance);
+
+            hit_count += expected_distance.has_value() ? 1 : 0;
+        }
+        EXPECT_GT(hit_count,
+                  0);
+
+        // Triangles in planes crossed by the ray, some of them covering it.
+        const auto vertex_list = make_random_vector_list(37 * 3);
+        std::vector<float> triangle_component_list[9];
+        for (auto index = std::size_t{0}; index < vertex_list.size(); ++index)
+        {
+            const auto& vertex = vertex_list[index];
+            triangle_component_list[(index % 3) * 3 + 0].push_back(ray.origin.x + vertex.x * 0.1f + static_cast<float>(index / 3) * 0.5f);
+            triangle_component_list[(index % 3) * 3 + 1].push_back(ray.origin.y + vertex.y);
+            triangle_component_list[(index % 3) * 3 + 2].push_back(ray.origin.z + vertex.z);
+        }
+
+        auto triangle_distance_list = std::vector<float>(37);
+        xar_engine::math::intersect_ray(
+            ray,
+            xar_engine::math::TriangleSoaSpan{
+                triangle_component_list[0], triangle_component_list[1], triangle_component_list[2],
+                triangle_component_list[3], triangle_component_list[4], triangle_component_list[5],
+                triangle_component_list[6], triangle_component_list[7], triangle_component_list[8],
+            },
+            triangle_distance_list);
+
+        hit_count = 0;
+        for (auto index = std::size_t{0}; index < triangle_distance_list.size(); ++index)
+        {
+            const auto expected_distance = xar_engine::math::intersect_ray(
+                ray,
+                xar_engine::math::Vector3f{triangle_component_list[0][index], triangle_component_list[1][index], triangle_component_list[2][index]},
+                xar_engine::math::Vector3f{triangle_component_list[3][index], triangle_component_list[4][index], triangle_component_list[5][index]},
+                xar_engine::math::Vector3f{triangle_component_list[6][index], triangle_component_list[7][index], triangle_component_list[8][index]});
+            expect_distance_near(
+                triangle_distance_list[index],
+                expected_distance);
+
+            hit_count += expected_distance.has_value() ? 1 : 0;
+        }
+        EXPECT_GT(hit_count,
+                  0);
+    }
+
+    // Runs function once per batch instruction set the build and the processor support, then restores the pick.
+    template <typename TFunction>
+    void for_each_batch_instruction_set(const TFunction& function)
+    {
+        const auto default_instruction_set = xar_engine::math::get_batch_instruction_set();
+
+        for (const auto instruction_set: {
+                 xar_engine::math::kernel::EInstructionSet::SCALAR,
+                 xar_engine::math::kernel::EInstructionSet::SSE4_2,
+                 xar_engine::math::kernel::EInstructionSet::AVX2,
+                 xar_engine::math::kernel::EInstructionSet::AVX512,
+                 xar_engine::math::kernel::EInstructionSet::NEON,
+             })
+        {
+            if (xar_engine::math::is_batch_instruction_set_supported(instruction_set))
+            {
+                SCOPED_TRACE(xar_engine::meta::enum_to_string(instruction_set));
+
+                xar_engine::math::set_batch_instruction_set(instruction_set);
+                function();
+            }
+        }
+
+        xar_engine::math::set_batch_instruction_set(default_instruction_set);
+    }
+
+
+    TEST(batch,
+         compute_aabb_and_max_distance__every_instruction_set__match_point_loop)
+    {
+        const auto point_list = make_random_vector_list(53);
+
+        auto expected_aabb = xar_engine::math::Aabb{point_list[0], point_list[0]};
+        for (const auto& point: point_list)
+        {
+            expected_aabb.min = {std::min(expected_aabb.min.x, point.x), std::min(expected_aabb.min.y, point.y), std::min(expected_aabb.min.z, point.z)};
+            expected_aabb.max = {std::max(expected_aabb.max.x, point.x), std::max(expected_aabb.max.y, point.y), std::max(expected_aabb.max.z, point.z)};
+        }
+
+        const auto center = xar_engine::math::Vector3f{1.0f, -2.0f, 0.5f};
+        auto expected_distance_squared = 0.0f;
+        for (const auto& point: point_list)
+        {
+            expected_distance_squared = std::max(
+                expected_distance_squared,
+                xar_engine::math::dot_product(
+                    point - center,
+                    point - center));
+        }
+
+        for_each_batch_instruction_set(
+            [&]()
+            {
+                // Every prefix length, so each lane group size and tail length is covered.
+                for (auto count = std::size_t{1}; count <= point_list.size(); ++count)
+                {
+                    const auto prefix = std::span{point_list}.first(count);
+                    const auto aabb = xar_engine::math::compute_aabb(prefix);
+                    if (count == point_list.size())
+                    {
+                        EXPECT_EQ(aabb.min,
+                                  expected_aabb.min);
+                        EXPECT_EQ(aabb.max,
+                                  expected_aabb.max);
+                        EXPECT_NEAR(xar_engine::math::compute_max_distance_squared(prefix, center),
+                                    expected_distance_squared,
+                                    TOLERANCE * expected_distance_squared);
+                    }
+
+                    for (const auto& point: prefix)
+                    {
+                        ASSERT_TRUE(point.x >= aabb.min.x && point.x <= aabb.max.x);
+                        ASSERT_TRUE(point.y >= aabb.min.y && point.y <= aabb.max.y);
+                        ASSERT_TRUE(point.z >= aabb.min.z && point.z <= aabb.max.z);
+                    }
+                }
+            });
+
+        EXPECT_THROW(
+            std::ignore = xar_engine::math::compute_aabb({}),
+            xar_engine::error::XarException);
+        EXPECT_EQ(xar_engine::math::compute_max_distance_squared({}, center),
+                  0.0f);
+    }
+
+    TEST(batch,
+         soa_kernels__every_instruction_set__match_single_primitive_functions)
+    {
+        const auto point_list = make_random_vector_list(45);
+        const auto soa_point_list = SoaVectorList{point_list};
+        const auto soa_aabb_list = SoaAabbList{45};
+        const auto frustum = make_test_frustum();
+        const auto matrix = make_test_matrix();
+
+        auto expected_point_list = std::vector<xar_engine::math::Vector3f>{};
+        for (const auto& point: point_list)
+        {
+            expected_point_list.push_back(
+                xar_engine::math::transform_point(
+                    matrix,
+                    point));
+        }
+
+        for_each_batch_instruction_set(
+            [&]()
+            {
+                auto result_point_list = SoaVectorList{point_list};
+                xar_engine::math::transform_points(
+                    soa_point_list.as_const_span(),
+                    matrix,
+                    result_point_list.as_span());
+                auto visible_list = std::vector<std::uint8_t>(45);
+                xar_engine::math::cull_aabbs(
+                    frustum,
+                    soa_aabb_list.as_span(),
+                    visible_list);
+
+                expect_soa_near(
+                    result_point_list,
+                    expected_point_list);
+                for (auto index = std::size_t{0}; index < visible_list.size(); ++index)
+                {
+                    EXPECT_EQ(visible_list[index] != 0,
+                              xar_engine::math::intersects(frustum, soa_aabb_list.aabb_list[index])) << index;
+                }
+            });
+    }
+
+    TEST(batch,
+         set_batch_instruction_set__compile_time_only_set__throws)
+    {
+        const auto instruction_set = xar_engine::math::get_batch_instruction_set();
+
+        EXPECT_FALSE(xar_engine::math::is_batch_instruction_set_supported(xar_engine::math::kernel::EInstructionSet::AVX));
+        EXPECT_THROW(
+            xar_engine::math::set_batch_instruction_set(xar_engine::math::kernel::EInstructionSet::AVX),
+            xar_engine::error::XarException);
+        EXPECT_EQ(xar_engine::math::get_batch_instruction_set(),
+                  instruction_set);
+    }
+
+    TEST(batch,
+         transform_points__result_size_differs__throws)
+    {
+        const auto point_list = make_random_vector_list(4);
+        auto result_list = std::vector<xar_engine::math::Vector3f>(3);
+
+        EXPECT_THROW(
+            xar_engine::math::transform_points(
+                point_list,
+                xar_engine::math::make_identity_matrix(),
+                result_list),
+            xar_engine::error::XarException);
+    }
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <xar_engine/math/geometry.hpp>
+
+
+namespace
+{
+    constexpr auto TOLERANCE = 1e-4f;
+
+    // Camera at the origin looking down -z, 90 degree vertical field of view, depth range [1, 100].
+    xar_engine::math::Frustum make_test_frustum()
+    {
+        const auto view = xar_engine::math::make_view_matrix(
+            {0.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, -1.0f},
+            {0.0f, 1.0f, 0.0f});
+        const auto projection = xar_engine::math::make_projection_matrix(
+            90.0f,
+            1.0f,
+            1.0f,
+            100.0f);
+
+        return xar_engine::math::make_frustum(projection * view);
+    }
+
+
+    TEST(geometry,
+         make_frustum__planes_bound_view_volume)
+    {
+        const auto frustum = make_test_frustum();
+
+        // Near and far planes, the far plane loses precision with the depth range.
+        EXPECT_NEAR(xar_engine::math::signed_distance(frustum.plane_list[4], {0.0f, 0.0f, -1.0f}),
+                    0.0f,
+                    TOLERANCE);
+        EXPECT_NEAR(xar_engine::math::signed_distance(frustum.plane_list[5], {0.0f, 0.0f, -100.0f}),
+                    0.0f,
+                    1e-2f);
+
+        // Side planes pass through the 45 degree edges.
+        EXPECT_NEAR(xar_engine::math::signed_distance(frustum.plane_list[0], {-10.0f, 0.0f, -10.0f}),
+                    0.0f,
+                    TOLERANCE);
+        EXPECT_NEAR(xar_engine::math::signed_distance(frustum.plane_list[1], {10.0f, 0.0f, -10.0f}),
+                    0.0f,
+                    TOLERANCE);
+
+        for (const auto& plane: frustum.plane_list)
+        {
+            EXPECT_GT(xar_engine::math::signed_distance(plane, {0.0f, 0.0f, -50.0f}),
+                      0.0f);
+        }
+    }
+
+    TEST(geometry,
+         intersects_frustum__inside_straddling_and_outside_volumes)
+    {
+        const auto frustum = make_test_frustum();
+
+        EXPECT_TRUE(xar_engine::math::intersects(frustum, xar_engine::math::Aabb{{-1.0f, -1.0f, -11.0f}, {1.0f, 1.0f, -9.0f}}));
+        EXPECT_TRUE(xar_engine::math::intersects(frustum, xar_engine::math::Aabb{{-1.0f, -1.0f, -2.0f}, {1.0f, 1.0f, 2.0f}}));
+        EXPECT_FALSE(xar_engine::math::intersects(frustum, xar_engine::math::Aabb{{-1.0f, -1.0f, 1.0f}, {1.0f, 1.0f, 3.0f}}));
+        EXPECT_FALSE(xar_engine::math::intersects(frustum, xar_engine::math::Aabb{{20.0f, -1.0f, -11.0f}, {22.0f, 1.0f, -9.0f}}));
+
+        EXPECT_TRUE(xar_engine::math::intersects(frustum, xar_engine::math::BoundingSphere{{11.0f, 0.0f, -10.0f}, 1.0f}));
+        EXPECT_FALSE(xar_engine::math::intersects(frustum, xar_engine::math::BoundingSphere{{13.0f, 0.0f, -10.0f}, 1.0f}));
+        EXPECT_FALSE(xar_engine::math::intersects(frustum, xar_engine::math::BoundingSphere{{0.0f, 0.0f, -102.0f}, 1.0f}));
+
+        // A thin box rotated 45 degrees reaches into the frustum only through its long axis.
+        const auto obb = xar_engine::math::Obb{
+            {12.0f, 0.0f, -10.0f},
+            {3.0f, 0.1f, 0.1f},
+            xar_engine::math::make_quaternion(
+                {0.0f, 1.0f, 0.0f},
+                0.0f),
+        };
+        EXPECT_TRUE(xar_engine::math::intersects(frustum, obb));
+        EXPECT_FALSE(xar_engine::math::intersects(
+            frustum,
+            xar_engine::math::Obb{
+                obb.center,
+                obb.half_extent,
+                xar_engine::math::make_quaternion(
+                    {0.0f, 0.0f, 1.0f},
+                    90.0f),
+            }));
+    }
+
+    TEST(geometry,
+         intersects__overlapping_and_separated_volumes)
+    {
+        const auto aabb = xar_engine::math::Aabb{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+
+        EXPECT_TRUE(xar_engine::math::intersects(aabb, xar_engine::math::Aabb{{1.0f, 0.5f, 0.5f}, {2.0f, 2.0f, 2.0f}}));
+        EXPECT_FALSE(xar_engine::math::intersects(aabb, xar_engine::math::Aabb{{1.1f, 0.5f, 0.5f}, {2.0f, 2.0f, 2.0f}}));
+
+        EXPECT_TRUE(xar_engine::math::intersects(aabb, xar_engine::math::BoundingSphere{{2.0f, 0.5f, 0.5f}, 1.0f}));
+        EXPECT_FALSE(xar_engine::math::intersects(aabb, xar_engine::math::BoundingSphere{{2.0f, 2.0f, 2.0f}, 1.0f}));
+
+        EXPECT_TRUE(xar_engine::math::intersects(
+            xar_engine::math::BoundingSphere{{0.0f, 0.0f, 0.0f}, 1.0f},
+            xar_engine::math::BoundingSphere{{1.5f, 0.0f, 0.0f}, 0.5f}));
+        EXPECT_FALSE(xar_engine::math::intersects(
+            xar_engine::math::BoundingSphere{{0.0f, 0.0f, 0.0f}, 1.0f},
+            xar_engine::math::BoundingSphere{{1.6f, 0.0f, 0.0f}, 0.5f}));
+
+        // Two unit cubes 2.5 apart only touch once one is turned 45 degrees, corner first.
+        const auto left = xar_engine::math::Obb{
+            {0.0f, 0.0f, 0.0f},
+            {1.0f, 1.0f, 1.0f},
+            xar_engine::math::make_identity_quaternion(),
+        };
+        auto right = xar_engine::math::Obb{
+            {2.3f, 0.0f, 0.0f},
+            {1.0f, 1.0f, 1.0f},
+            xar_engine::math::make_identity_quaternion(),
+        };
+        EXPECT_FALSE(xar_engine::math::intersects(left, right));
+
+        right.rotation = xar_engine::math::make_quaternion(
+            {0.0f, 0.0f, 1.0f},
+            45.0f);
+        EXPECT_TRUE(xar_engine::math::intersects(left, right));
+
+        const auto enclosing_aabb = xar_engine::math::make_aabb_from_obb(right);
+        EXPECT_NEAR(enclosing_aabb.min.x, 2.3f - std::sqrt(2.0f), TOLERANCE);
+        EXPECT_NEAR(enclosing_aabb.max.y, std::sqrt(2.0f), TOLERANCE);
+        EXPECT_NEAR(enclosing_aabb.max.z, 1.0f, TOLERANCE);
+    }
+
+    TEST(geometry,
+         intersect_ray__returns_entry_distance)
+    {
+        const auto aabb = xar_engine::math::Aabb{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}};
+
+        const auto hit = xar_engine::math::intersect_ray(
+            xar_engine::math::Ray{{-5.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}},
+            aabb);
+        ASSERT_TRUE(hit.has_value());
+        EXPECT_NEAR(*hit, 4.0f, TOLERANCE);
+
+        const auto inside_hit = xar_engine::math::intersect_ray(
+            xar_engine::math::Ray{{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}},
+            aabb);
+        ASSERT_TRUE(inside_hit.has_value());
+        EXPECT_EQ(*inside_hit, 0.0f);
+
+        EXPECT_FALSE(xar_engine::math::intersect_ray(
+            xar_engine::math::Ray{{-5.0f, 2.0f, 0.0f}, {1.0f, 0.0f, 0.0f}},
+            aabb).has_value());
+        EXPECT_FALSE(xar_engine::math::intersect_ray(
+            xar_engine::math::Ray{{5.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}},
+            aabb).has_value());
+
+        const auto triangle_hit = xar_engine::math::intersect_ray(
+            xar_engine::math::Ray{{0.25f, 0.25f, 3.0f}, {0.0f, 0.0f, -2.0f}},
+            {0.0f, 0.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f});
+        ASSERT_TRUE(triangle_hit.has_value());
+        EXPECT_NEAR(*triangle_hit, 1.5f, TOLERANCE);
+
+        EXPECT_FALSE(xar_engine::math::intersect_ray(
+            xar_engine::math::Ray{{0.75f, 0.75f, 3.0f}, {0.0f, 0.0f, -1.0f}},
+            {0.0f, 0.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f}).has_value());
+    }
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include <xar_engine/math/half_float.hpp>
+
+
+namespace
+{
+    using xar_engine::math::to_half_float;
+
+
+    TEST(half_float,
+         to_half_float__exact_values__encoded)
+    {
+        EXPECT_EQ(to_half_float(0.0f), 0x0000);
+        EXPECT_EQ(to_half_float(-0.0f), 0x8000);
+        EXPECT_EQ(to_half_float(1.0f), 0x3c00);
+        EXPECT_EQ(to_half_float(-2.0f), 0xc000);
+        EXPECT_EQ(to_half_float(0.5f), 0x3800);
+        EXPECT_EQ(to_half_float(65504.0f), 0x7bff);
+        EXPECT_EQ(to_half_float(std::ldexp(1.0f, -14)), 0x0400);
+        EXPECT_EQ(to_half_float(std::ldexp(1.0f, -24)), 0x0001);
+    }
+
+    TEST(half_float,
+         to_half_float__between_halves__rounded_to_nearest_even)
+    {
+        EXPECT_EQ(to_half_float(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+        EXPECT_EQ(to_half_float(1.0f + 3.0f * std::ldexp(1.0f, -11)), 0x3c02);
+        EXPECT_EQ(to_half_float(std::ldexp(1.0f, -25)), 0x0000);
+        EXPECT_EQ(to_half_float(std::ldexp(1.5f, -25)), 0x0001);
+        EXPECT_EQ(to_half_float(std::ldexp(1.0f, -14) - std::ldexp(1.0f, -25)), 0x0400);
+    }
+
+    TEST(half_float,
+         to_half_float__out_of_range_and_nan__special_values)
+    {
+        EXPECT_EQ(to_half_float(65519.0f), 0x7bff);
+        EXPECT_EQ(to_half_float(65520.0f), 0x7c00);
+        EXPECT_EQ(to_half_float(-1.0e10f), 0xfc00);
+        EXPECT_EQ(to_half_float(std::numeric_limits<float>::infinity()), 0x7c00);
+        EXPECT_EQ(to_half_float(std::numeric_limits<float>::quiet_NaN()) & 0x7e00, 0x7e00);
+        EXPECT_EQ(to_half_float(std::ldexp(1.0f, -30)), 0x0000);
+    }
+}
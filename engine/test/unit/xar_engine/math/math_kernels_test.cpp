@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/math/matrix.hpp>
+
+
+namespace
+{
+    constexpr auto TOLERANCE = 1e-4f;
+
+    xar_engine::math::Matrix4x4f make_random_matrix(std::mt19937& random_engine)
+    {
+        auto distribution = std::uniform_real_distribution<float>{-2.0f, 2.0f};
+
+        auto matrix = xar_engine::math::Matrix4x4f{};
+        for (auto& value: matrix.as_scalar_list)
+        {
+            value = distribution(random_engine);
+        }
+
+        // Diagonal dominance keeps the matrix well conditioned for the inverse tests.
+        for (auto index = 0; index < 4; ++index)
+        {
+            matrix.as_scalar_list[index * 5] += 10.0f;
+        }
+
+        return matrix;
+    }
+
+    void expect_matrix_near(
+        const xar_engine::math::Matrix4x4f& left,
+        const xar_engine::math::Matrix4x4f& right)
+    {
+        for (auto index = 0; index < 16; ++index)
+        {
+            EXPECT_NEAR(left.as_scalar_list[index],
+                        right.as_scalar_list[index],
+                        TOLERANCE);
+        }
+    }
+
+
+    TEST(math_kernels,
+         simd_matrix_kernels__match_scalar_kernels)
+    {
+        auto random_engine = std::mt19937{42};
+
+        for (auto iteration = 0; iteration < 100; ++iteration)
+        {
+            const auto left = make_random_matrix(random_engine);
+            const auto right = make_random_matrix(random_engine);
+            const auto vector = xar_engine::math::Vector4f{1.0f, -2.0f, 3.0f, 0.5f};
+
+            expect_matrix_near(
+                xar_engine::math::kernel::simd::multiply_matrix(left, right),
+                xar_engine::math::kernel::scalar::multiply_matrix(left, right));
+            expect_matrix_near(
+                xar_engine::math::kernel::simd::transpose_matrix(left),
+                xar_engine::math::kernel::scalar::transpose_matrix(left));
+
+            auto simd_inverse = xar_engine::math::Matrix4x4f{};
+            auto scalar_inverse = xar_engine::math::Matrix4x4f{};
+            ASSERT_TRUE(xar_engine::math::kernel::simd::inverse_matrix(left, simd_inverse));
+            ASSERT_TRUE(xar_engine::math::kernel::scalar::inverse_matrix(left, scalar_inverse));
+            expect_matrix_near(
+                simd_inverse,
+                scalar_inverse);
+
+            const auto simd_vector = xar_engine::math::kernel::simd::transform_vector(left, vector);
+            const auto scalar_vector = xar_engine::math::kernel::scalar::transform_vector(left, vector);
+            EXPECT_NEAR(simd_vector.x, scalar_vector.x, TOLERANCE);
+            EXPECT_NEAR(simd_vector.y, scalar_vector.y, TOLERANCE);
+            EXPECT_NEAR(simd_vector.z, scalar_vector.z, TOLERANCE);
+            EXPECT_NEAR(simd_vector.w, scalar_vector.w, TOLERANCE);
+        }
+    }
+
+    TEST(math_kernels,
+         inverse_matrix__product_with_matrix_is_identity)
+    {
+        auto random_engine = std::mt19937{7};
+        const auto matrix = make_random_matrix(random_engine);
+
+        expect_matrix_near(
+            matrix * xar_engine::math::inverse_matrix(matrix),
+            xar_engine::math::make_identity_matrix());
+    }
+
+    TEST(math_kernels,
+         inverse_matrix__singular_matrix__throws)
+    {
+        auto matrix = xar_engine::math::make_identity_matrix();
+        matrix.as_column_list[2] = matrix.as_column_list[1];
+
+        EXPECT_THROW(
+            std::ignore = xar_engine::math::inverse_matrix(matrix),
+            xar_engine::error::XarException);
+    }
+
+    TEST(math_kernels,
+         rotate_and_scale_matrix__transform_point)
+    {
+        auto matrix = xar_engine::math::make_identity_matrix();
+        matrix = xar_engine::math::rotate_matrix(
+            matrix,
+            90.0f,
+            {0.0f, 0.0f, 2.0f});
+        matrix = xar_engine::math::scale_matrix(
+            matrix,
+            {2.0f, 2.0f, 2.0f});
+
+        const auto point = xar_engine::math::transform_point(
+            matrix,
+            {1.0f, 0.0f, 0.0f});
+        EXPECT_NEAR(point.x, 0.0f, TOLERANCE);
+        EXPECT_NEAR(point.y, 2.0f, TOLERANCE);
+        EXPECT_NEAR(point.z, 0.0f, TOLERANCE);
+    }
+
+    TEST(math_kernels,
+         view_and_projection_matrix__map_depth_range_to_zero_one)
+    {
+        const auto view_matrix = xar_engine::math::make_view_matrix(
+            {0.0f, 0.0f, 5.0f},
+            {0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f});
+        const auto projection_matrix = xar_engine::math::make_projection_matrix(
+            90.0f,
+            1.0f,
+            1.0f,
+            10.0f);
+        const auto matrix = projection_matrix * view_matrix;
+
+        const auto near_point = matrix * xar_engine::math::Vector4f{1.0f, 0.0f, 4.0f, 1.0f};
+        const auto far_point = matrix * xar_engine::math::Vector4f{0.0f, 0.0f, -5.0f, 1.0f};
+        EXPECT_NEAR(near_point.x / near_point.w, 1.0f, TOLERANCE);
+        EXPECT_NEAR(near_point.z / near_point.w, 0.0f, TOLERANCE);
+        EXPECT_NEAR(far_point.z / far_point.w, 1.0f, TOLERANCE);
+    }
+
+    TEST(math_kernels,
+         vector_kernels__match_scalar_kernels)
+    {
+        const auto left = xar_engine::math::Vector4f{1.0f, 2.0f, 3.0f, 4.0f};
+        const auto right = xar_engine::math::Vector4f{-2.0f, 0.5f, 1.0f, 3.0f};
+
+        EXPECT_EQ(xar_engine::math::kernel::simd::add_vector(left, right),
+                  xar_engine::math::kernel::scalar::add_vector(left, right));
+        EXPECT_EQ(xar_engine::math::kernel::simd::subtract_vector(left, right),
+                  xar_engine::math::kernel::scalar::subtract_vector(left, right));
+        EXPECT_EQ(xar_engine::math::kernel::simd::scale_vector(left, 3.0f),
+                  xar_engine::math::kernel::scalar::scale_vector(left, 3.0f));
+        EXPECT_FLOAT_EQ(xar_engine::math::kernel::simd::dot_product(left, right),
+                        xar_engine::math::kernel::scalar::dot_product(left, right));
+        EXPECT_EQ(xar_engine::math::kernel::simd::cross_product(left, right),
+                  xar_engine::math::kernel::scalar::cross_product(left, right));
+        EXPECT_EQ(xar_engine::math::kernel::simd::normalize_vector(left),
+                  xar_engine::math::kernel::scalar::normalize_vector(left));
+    }
+
+    TEST(math_kernels,
+         normalize_vector__zero_vector__is_unchanged)
+    {
+        EXPECT_EQ(xar_engine::math::normalize_vector(xar_engine::math::Vector4f{0.0f, 0.0f, 0.0f, 0.0f}),
+                  (xar_engine::math::Vector4f{0.0f, 0.0f, 0.0f, 0.0f}));
+        EXPECT_EQ(xar_engine::math::normalize_vector(xar_engine::math::Vector3f{0.0f, 3.0f, 4.0f}),
+                  (xar_engine::math::Vector3f{0.0f, 0.6f, 0.8f}));
+    }
+
+    TEST(math_kernels,
+         matrix_operations__are_constant_evaluated)
+    {
+        constexpr auto matrix = xar_engine::math::scale_matrix(
+            xar_engine::math::make_identity_matrix(),
+            {2.0f, 4.0f, 8.0f});
+        constexpr auto inverse = xar_engine::math::inverse_matrix(matrix);
+        constexpr auto point = xar_engine::math::transform_point(
+            xar_engine::math::transpose_matrix(matrix * inverse),
+            {1.0f, 2.0f, 3.0f});
+
+        static_assert(matrix.as_column_list[1].y == 4.0f);
+        static_assert(inverse.as_column_list[2].z == 0.125f);
+        static_assert(point == xar_engine::math::Vector3f{1.0f, 2.0f, 3.0f});
+    }
+}
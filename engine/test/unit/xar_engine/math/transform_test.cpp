@@ -0,0 +1,297 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/math/transform.hpp>
+
+
+namespace
+{
+    constexpr auto TOLERANCE = 1e-4f;
+
+    void expect_matrix_near(
+        const xar_engine::math::Matrix4x4f& left,
+        const xar_engine::math::Matrix4x4f& right)
+    {
+        for (auto index = 0; index < 16; ++index)
+        {
+            EXPECT_NEAR(left.as_scalar_list[index],
+                        right.as_scalar_list[index],
+                        TOLERANCE);
+        }
+    }
+
+    void expect_affine_near(
+        const xar_engine::math::Affine3x4f& left,
+        const xar_engine::math::Affine3x4f& right)
+    {
+        expect_matrix_near(
+            xar_engine::math::make_matrix_from_affine(left),
+            xar_engine::math::make_matrix_from_affine(right));
+    }
+
+    void expect_vector_near(
+        const xar_engine::math::Vector3f& left,
+        const xar_engine::math::Vector3f& right)
+    {
+        EXPECT_NEAR(left.x, right.x, TOLERANCE);
+        EXPECT_NEAR(left.y, right.y, TOLERANCE);
+        EXPECT_NEAR(left.z, right.z, TOLERANCE);
+    }
+
+    // q and -q are the same rotation.
+    void expect_same_rotation(
+        const xar_engine::math::Quaternionf& left,
+        const xar_engine::math::Quaternionf& right)
+    {
+        const auto sign = (left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w) < 0.0f ? -1.0f : 1.0f;
+
+        EXPECT_NEAR(left.x, sign * right.x, TOLERANCE);
+        EXPECT_NEAR(left.y, sign * right.y, TOLERANCE);
+        EXPECT_NEAR(left.z, sign * right.z, TOLERANCE);
+        EXPECT_NEAR(left.w, sign * right.w, TOLERANCE);
+    }
+
+    xar_engine::math::Transform make_test_transform()
+    {
+        return {
+            {1.0f, -2.0f, 3.0f},
+            xar_engine::math::make_quaternion(
+                {1.0f, 2.0f, 3.0f},
+                40.0f),
+            {2.0f, 2.0f, 2.0f},
+        };
+    }
+
+
+    TEST(quaternion,
+         make_rotation_matrix__matches_rotate_matrix)
+    {
+        const auto axis = xar_engine::math::Vector3f{1.0f, -1.0f, 2.0f};
+        const auto quaternion = xar_engine::math::make_quaternion(
+            axis,
+            75.0f);
+
+        expect_matrix_near(
+            xar_engine::math::make_rotation_matrix(quaternion),
+            xar_engine::math::rotate_matrix(
+                xar_engine::math::make_identity_matrix(),
+                75.0f,
+                axis));
+        expect_vector_near(
+            xar_engine::math::rotate_vector(
+                quaternion,
+                {3.0f, 4.0f, 5.0f}),
+            xar_engine::math::transform_vector(
+                xar_engine::math::make_rotation_matrix(quaternion),
+                {3.0f, 4.0f, 5.0f}));
+    }
+
+    TEST(quaternion,
+         multiply__matches_scalar_kernel_and_matrix_product)
+    {
+        const auto left = xar_engine::math::make_quaternion(
+            {0.0f, 1.0f, 0.0f},
+            30.0f);
+        const auto right = xar_engine::math::make_quaternion(
+            {1.0f, 0.0f, 1.0f},
+            -110.0f);
+
+        const auto product = left * right;
+        EXPECT_EQ(product,
+                  xar_engine::math::kernel::scalar::multiply_quaternion(
+                      left,
+                      right));
+        expect_matrix_near(
+            xar_engine::math::make_rotation_matrix(product),
+            xar_engine::math::make_rotation_matrix(left) * xar_engine::math::make_rotation_matrix(right));
+
+        expect_same_rotation(
+            xar_engine::math::inverse_quaternion(product) * product,
+            xar_engine::math::make_identity_quaternion());
+    }
+
+    TEST(quaternion,
+         make_quaternion_from_matrix__every_branch__round_trips)
+    {
+        const xar_engine::math::Vector3f axis_list[] = {
+            {1.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f},
+            {1.0f, 2.0f, -3.0f},
+        };
+
+        for (const auto& axis: axis_list)
+        {
+            for (const auto angle: {10.0f, 120.0f, 180.0f})
+            {
+                const auto quaternion = xar_engine::math::make_quaternion(
+                    axis,
+                    angle);
+
+                expect_same_rotation(
+                    xar_engine::math::make_quaternion_from_matrix(xar_engine::math::make_rotation_matrix(quaternion)),
+                    quaternion);
+            }
+        }
+    }
+
+    TEST(quaternion,
+         slerp__halfway__halves_angle_along_shorter_arc)
+    {
+        const auto axis = xar_engine::math::Vector3f{0.0f, 0.0f, 1.0f};
+        const auto from = xar_engine::math::make_quaternion(
+            axis,
+            10.0f);
+        const auto to = xar_engine::math::make_quaternion(
+            axis,
+            100.0f);
+
+        expect_same_rotation(
+            xar_engine::math::slerp_quaternion(
+                from,
+                to,
+                0.5f),
+            xar_engine::math::make_quaternion(
+                axis,
+                55.0f));
+        expect_same_rotation(
+            xar_engine::math::slerp_quaternion(
+                from,
+                xar_engine::math::Quaternionf{-to.x, -to.y, -to.z, -to.w},
+                1.0f),
+            to);
+        expect_same_rotation(
+            xar_engine::math::slerp_quaternion(
+                from,
+                from,
+                0.3f),
+            from);
+    }
+
+    TEST(affine,
+         multiply_and_inverse__match_matrix_operations)
+    {
+        const auto left_matrix = xar_engine::math::make_matrix_from_transform(make_test_transform());
+        auto right_matrix = xar_engine::math::scale_matrix(
+            xar_engine::math::rotate_matrix(
+                xar_engine::math::make_identity_matrix(),
+                -65.0f,
+                {0.0f, 1.0f, 1.0f}),
+            {1.0f, 3.0f, 0.5f});
+        right_matrix.as_column_list[3] = {-4.0f, 0.5f, 7.0f, 1.0f};
+
+        const auto left = xar_engine::math::make_affine_from_matrix(left_matrix);
+        const auto right = xar_engine::math::make_affine_from_matrix(right_matrix);
+
+        expect_matrix_near(
+            xar_engine::math::make_matrix_from_affine(left * right),
+            left_matrix * right_matrix);
+        expect_affine_near(
+            left * right,
+            xar_engine::math::kernel::scalar::multiply_affine(
+                left,
+                right));
+        expect_matrix_near(
+            xar_engine::math::make_matrix_from_affine(xar_engine::math::inverse_affine(right)),
+            xar_engine::math::inverse_matrix(right_matrix));
+        expect_affine_near(
+            xar_engine::math::inverse_affine(right) * right,
+            xar_engine::math::make_identity_affine());
+        expect_vector_near(
+            xar_engine::math::transform_point(
+                right,
+                {1.0f, 2.0f, 3.0f}),
+            xar_engine::math::transform_point(
+                right_matrix,
+                {1.0f, 2.0f, 3.0f}));
+    }
+
+    TEST(affine,
+         inverse__singular__throws)
+    {
+        auto affine = xar_engine::math::make_identity_affine();
+        affine.as_row_list[2] = {0.0f, 0.0f, 0.0f, 1.0f};
+
+        EXPECT_THROW(
+            std::ignore = xar_engine::math::inverse_affine(affine),
+            xar_engine::error::XarException);
+    }
+
+    TEST(transform,
+         make_affine_from_transform__matches_translate_rotate_scale_matrices)
+    {
+        const auto transform = xar_engine::math::Transform{
+            {1.0f, 2.0f, 3.0f},
+            xar_engine::math::make_quaternion(
+                {0.0f, 1.0f, 0.0f},
+                30.0f),
+            {1.0f, 2.0f, 3.0f},
+        };
+
+        auto expected_matrix = xar_engine::math::make_identity_matrix();
+        expected_matrix.as_column_list[3] = {1.0f, 2.0f, 3.0f, 1.0f};
+        expected_matrix = xar_engine::math::rotate_matrix(
+            expected_matrix,
+            30.0f,
+            {0.0f, 1.0f, 0.0f});
+        expected_matrix = xar_engine::math::scale_matrix(
+            expected_matrix,
+            {1.0f, 2.0f, 3.0f});
+
+        expect_matrix_near(
+            xar_engine::math::make_matrix_from_transform(transform),
+            expected_matrix);
+    }
+
+    TEST(transform,
+         compose_and_inverse__uniform_scale__match_affine)
+    {
+        const auto parent = make_test_transform();
+        const auto child = xar_engine::math::Transform{
+            {0.0f, 5.0f, -1.0f},
+            xar_engine::math::make_quaternion(
+                {1.0f, 0.0f, 0.0f},
+                -20.0f),
+            {1.0f, 0.5f, 4.0f},
+        };
+
+        expect_affine_near(
+            xar_engine::math::make_affine_from_transform(parent * child),
+            xar_engine::math::make_affine_from_transform(parent) * xar_engine::math::make_affine_from_transform(child));
+        expect_affine_near(
+            xar_engine::math::make_affine_from_transform(xar_engine::math::inverse_transform(parent)),
+            xar_engine::math::inverse_affine(xar_engine::math::make_affine_from_transform(parent)));
+
+        const auto halfway = xar_engine::math::interpolate_transform(
+            xar_engine::math::make_identity_transform(),
+            parent,
+            0.5f);
+        expect_vector_near(
+            halfway.translation,
+            {0.5f, -1.0f, 1.5f});
+        expect_vector_near(
+            halfway.scale,
+            {1.5f, 1.5f, 1.5f});
+    }
+
+    TEST(transform,
+         compose__constant_evaluated__matches_runtime)
+    {
+        constexpr auto transform = xar_engine::math::Transform{
+            {1.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 0.0f, 1.0f},
+            {2.0f, 2.0f, 2.0f},
+        };
+        constexpr auto composed = transform * transform;
+        static_assert(composed.translation.x == 3.0f);
+        static_assert(xar_engine::math::make_affine_from_transform(composed).as_row_list[0].x == 4.0f);
+
+        const auto runtime_transform = transform;
+        expect_vector_near(
+            (runtime_transform * runtime_transform).translation,
+            composed.translation);
+    }
+}
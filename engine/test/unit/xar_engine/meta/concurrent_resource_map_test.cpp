@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/meta/concurrent_resource_map.hpp>
+
+
+namespace
+{
+    enum class TestTag;
+    using ResourceMap = xar_engine::meta::TConcurrentResourceMap<TestTag, std::shared_ptr<int>>;
+    using ResourceReference = xar_engine::meta::TResourceReference<TestTag>;
+
+
+    TEST(concurrent_resource_map,
+         add__copies_released__object_destroyed_with_last_reference)
+    {
+        auto resource_map = ResourceMap{};
+        auto object = std::make_shared<int>(1);
+        const auto weak_object = std::weak_ptr<int>{object};
+
+        auto reference = resource_map.add(std::move(object));
+        const auto handle = reference.get_handle();
+        auto copy = reference;
+
+        reference = {};
+        EXPECT_EQ(*resource_map.get(copy), 1);
+
+        copy = {};
+        EXPECT_TRUE(weak_object.expired());
+        EXPECT_EQ(resource_map.size(), 0);
+        EXPECT_THROW(
+            resource_map.get(handle),
+            xar_engine::error::XarException);
+    }
+
+    TEST(concurrent_resource_map,
+         copy_reference__several_threads__object_destroyed_once_after_all)
+    {
+        constexpr auto THREAD_COUNT = 4;
+        constexpr auto COPY_COUNT = 10000;
+
+        auto resource_map = ResourceMap{};
+        auto object = std::make_shared<int>(7);
+        const auto weak_object = std::weak_ptr<int>{object};
+        auto reference = resource_map.add(std::move(object));
+
+        {
+            auto thread_list = std::vector<std::jthread>{};
+            for (auto thread_index = 0; thread_index < THREAD_COUNT; ++thread_index)
+            {
+                thread_list.emplace_back(
+                    [&resource_map, reference]()
+                    {
+                        for (auto copy_index = 0; copy_index < COPY_COUNT; ++copy_index)
+                        {
+                            const auto copy = reference;
+                            EXPECT_EQ(*resource_map.get(copy), 7);
+
+                            const auto other_reference = resource_map.add(std::make_shared<int>(copy_index));
+                            EXPECT_EQ(*resource_map.get(other_reference), copy_index);
+                        }
+                    });
+            }
+        }
+
+        EXPECT_FALSE(weak_object.expired());
+        EXPECT_EQ(resource_map.size(), 1);
+
+        reference = {};
+        EXPECT_TRUE(weak_object.expired());
+    }
+
+    TEST(concurrent_resource_map,
+         release_resource__released_resource_id__ignored)
+    {
+        auto resource_map = ResourceMap{};
+        auto reference = resource_map.add(std::make_shared<int>(1));
+        const auto id = reference.get_id();
+
+        reference = {};
+        const auto other_reference = resource_map.add(std::make_shared<int>(2));
+
+        EXPECT_NO_THROW(resource_map.release_resource(id));
+        EXPECT_EQ(*resource_map.get(other_reference), 2);
+        EXPECT_EQ(resource_map.size(), 1);
+    }
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <type_traits>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/meta/resource_map.hpp>
+
+
+namespace
+{
+    enum class TestTag;
+    using ResourceMap = xar_engine::meta::TResourceMap<TestTag, std::shared_ptr<int>>;
+    using ResourceReference = xar_engine::meta::TResourceReference<TestTag>;
+
+
+    TEST(resource_map,
+         add__copies_released__object_destroyed_with_last_reference)
+    {
+        auto resource_map = ResourceMap{};
+        auto object = std::make_shared<int>(1);
+        const auto weak_object = std::weak_ptr<int>{object};
+
+        auto reference = resource_map.add(std::move(object));
+        auto copy = reference;
+        auto assigned_copy = ResourceReference{};
+        assigned_copy = copy;
+
+        reference = {};
+        copy = {};
+        EXPECT_FALSE(weak_object.expired());
+        EXPECT_EQ(*resource_map.get(assigned_copy), 1);
+
+        assigned_copy = {};
+        EXPECT_TRUE(weak_object.expired());
+        EXPECT_EQ(resource_map.size(), 0);
+    }
+
+    TEST(resource_map,
+         release_resource__released_resource_id__ignored)
+    {
+        auto resource_map = ResourceMap{};
+        auto reference = resource_map.add(std::make_shared<int>(1));
+        const auto id = reference.get_id();
+
+        reference = {};
+        const auto other_reference = resource_map.add(std::make_shared<int>(2));
+
+        EXPECT_NO_THROW(resource_map.release_resource(id));
+        EXPECT_EQ(*resource_map.get(other_reference), 2);
+        EXPECT_EQ(resource_map.size(), 1);
+    }
+
+    TEST(resource_map,
+         get__released_resource_handle__throws)
+    {
+        auto resource_map = ResourceMap{};
+        auto reference = resource_map.add(std::make_shared<int>(1));
+        const auto handle = reference.get_handle();
+
+        reference = {};
+        const auto other_reference = resource_map.add(std::make_shared<int>(2));
+
+        EXPECT_THROW(
+            resource_map.get(handle),
+            xar_engine::error::XarException);
+        EXPECT_EQ(*resource_map.get(other_reference), 2);
+    }
+
+    TEST(resource_map,
+         get__default_reference__throws)
+    {
+        auto resource_map = ResourceMap{};
+        const auto reference = resource_map.add(std::make_shared<int>(1));
+
+        EXPECT_THROW(
+            resource_map.get(ResourceReference{}),
+            xar_engine::error::XarException);
+    }
+
+    TEST(resource_reference,
+         handle__any_tag__trivially_copyable)
+    {
+        EXPECT_TRUE(std::is_trivially_copyable_v<ResourceReference::Handle>);
+        EXPECT_EQ(sizeof(ResourceReference::Handle), sizeof(ResourceReference::Id));
+    }
+}
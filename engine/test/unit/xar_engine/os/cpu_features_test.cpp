@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include <xar_engine/os/cpu_features.hpp>
+
+
+namespace
+{
+    TEST(cpu_features,
+         get_cpu_features__wider_extensions__imply_narrower_ones)
+    {
+        const auto& cpu_features = xar_engine::os::get_cpu_features();
+
+        if (cpu_features.has_avx512f)
+        {
+            EXPECT_TRUE(cpu_features.has_avx2);
+        }
+        if (cpu_features.has_avx2 || cpu_features.has_fma)
+        {
+            EXPECT_TRUE(cpu_features.has_avx);
+        }
+        if (cpu_features.has_neon)
+        {
+            EXPECT_FALSE(cpu_features.has_sse4_2 || cpu_features.has_avx);
+        }
+
+        EXPECT_EQ(&cpu_features,
+                  &xar_engine::os::get_cpu_features());
+    }
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <xar_engine/error/exception.hpp>
+
+#include <xar_engine/scene/transform_table.hpp>
+
+
+namespace
+{
+    xar_engine::math::Affine3x4f make_translation_matrix(const xar_engine::math::Vector3f& translation)
+    {
+        auto matrix = xar_engine::math::make_identity_affine();
+        matrix.as_row_list[0].w = translation.x;
+        matrix.as_row_list[1].w = translation.y;
+        matrix.as_row_list[2].w = translation.z;
+
+        return matrix;
+    }
+
+
+    TEST(transform_table,
+         update_world_matrices__child_composes_parent_transform)
+    {
+        const auto half_sqrt_2 = std::sqrt(0.5f);
+
+        // Root rotates 90 degrees around z and doubles the scale, child is moved along local x.
+        auto node_list = xar_engine::asset::ModelNodeList{};
+        node_list.parent_index_list = {xar_engine::asset::NO_PARENT_NODE_INDEX, 0};
+        node_list.translation_list = {{0.0f, 0.0f, 5.0f}, {1.0f, 0.0f, 0.0f}};
+        node_list.rotation_list = {{0.0f, 0.0f, half_sqrt_2, half_sqrt_2}, {0.0f, 0.0f, 0.0f, 1.0f}};
+        node_list.scale_list = {{2.0f, 2.0f, 2.0f}, {1.0f, 1.0f, 1.0f}};
+
+        auto transform_table = xar_engine::scene::make_transform_table(node_list);
+        xar_engine::scene::update_world_matrices(
+            transform_table,
+            make_translation_matrix({10.0f, 0.0f, 0.0f}));
+
+        ASSERT_EQ(transform_table.world_matrix_list.size(),
+                  2);
+        EXPECT_EQ(xar_engine::math::transform_point(transform_table.world_matrix_list[0], {1.0f, 0.0f, 0.0f}),
+                  (xar_engine::math::Vector3f{10.0f, 2.0f, 5.0f}));
+        EXPECT_EQ(xar_engine::math::transform_point(transform_table.world_matrix_list[1], {0.0f, 0.0f, 0.0f}),
+                  (xar_engine::math::Vector3f{10.0f, 2.0f, 5.0f}));
+        EXPECT_EQ(xar_engine::math::transform_point(transform_table.world_matrix_list[1], {0.0f, 1.0f, 0.0f}),
+                  (xar_engine::math::Vector3f{8.0f, 2.0f, 5.0f}));
+    }
+
+    TEST(transform_table,
+         update_world_matrices__child_before_parent__throws)
+    {
+        auto transform_table = xar_engine::scene::TransformTable{};
+        transform_table.parent_index_list = {1, xar_engine::asset::NO_PARENT_NODE_INDEX};
+        transform_table.local_translation_list = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+        transform_table.local_rotation_list = {{0.0f, 0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 0.0f, 1.0f}};
+        transform_table.local_scale_list = {{1.0f, 1.0f, 1.0f}, {1.0f, 1.0f, 1.0f}};
+
+        EXPECT_THROW(
+            xar_engine::scene::update_world_matrices(
+                transform_table,
+                make_translation_matrix({0.0f, 0.0f, 0.0f})),
+            xar_engine::error::XarException);
+    }
+}
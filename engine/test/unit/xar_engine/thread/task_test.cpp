@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <thread>
+
+#include <xar_engine/thread/task.hpp>
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace
+{
+    xar_engine::thread::TTask<std::thread::id> get_worker_thread_id(
+        xar_engine::thread::IExecutor& worker_executor,
+        xar_engine::thread::IExecutor& resume_executor)
+    {
+        co_await xar_engine::thread::resume_on(worker_executor);
+        const auto worker_thread_id = std::this_thread::get_id();
+        co_await xar_engine::thread::resume_on(resume_executor);
+
+        co_return worker_thread_id;
+    }
+
+    xar_engine::thread::TTask<int> add_one(xar_engine::thread::TTask<int> task)
+    {
+        co_return co_await std::move(task) + 1;
+    }
+
+    xar_engine::thread::TTask<int> get_value(int value)
+    {
+        co_return value;
+    }
+
+    xar_engine::thread::TTask<int> throw_error()
+    {
+        throw std::runtime_error{"error"};
+        co_return 0;
+    }
+
+
+    TEST(task,
+         start_task__nested_tasks__result_passed_to_callback)
+    {
+        auto result = std::expected<int, std::exception_ptr>{};
+
+        xar_engine::thread::start_task(
+            add_one(get_value(41)),
+            [&result](std::expected<int, std::exception_ptr> task_result)
+            {
+                result = std::move(task_result);
+            });
+
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(*result,
+                  42);
+    }
+
+    TEST(task,
+         start_task__task_throws__exception_passed_to_callback)
+    {
+        auto result = std::expected<int, std::exception_ptr>{};
+
+        xar_engine::thread::start_task(
+            add_one(throw_error()),
+            [&result](std::expected<int, std::exception_ptr> task_result)
+            {
+                result = std::move(task_result);
+            });
+
+        ASSERT_FALSE(result.has_value());
+        EXPECT_THROW(
+            std::rethrow_exception(result.error()),
+            std::runtime_error);
+    }
+
+    TEST(task,
+         resume_on__runs_on_worker_and_completes_on_queue_executor)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{1};
+        auto queue_executor = xar_engine::thread::QueueExecutor{};
+
+        auto completed = false;
+        auto worker_thread_id = std::thread::id{};
+        auto completion_thread_id = std::thread::id{};
+        xar_engine::thread::start_task(
+            get_worker_thread_id(
+                thread_pool,
+                queue_executor),
+            [&](std::expected<std::thread::id, std::exception_ptr> result)
+            {
+                completed = true;
+                worker_thread_id = *result;
+                completion_thread_id = std::this_thread::get_id();
+            });
+
+        while (!completed)
+        {
+            queue_executor.run_pending();
+            std::this_thread::yield();
+        }
+
+        EXPECT_NE(worker_thread_id,
+                  std::this_thread::get_id());
+        EXPECT_EQ(completion_thread_id,
+                  std::this_thread::get_id());
+    }
+}
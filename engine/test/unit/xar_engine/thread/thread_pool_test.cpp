@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <xar_engine/thread/thread_pool.hpp>
+
+
+namespace
+{
+    TEST(thread_pool,
+         submit__future_returns_result)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{2};
+
+        auto future = thread_pool.submit(
+            []()
+            {
+                return 42;
+            });
+
+        EXPECT_EQ(future.get(),
+                  42);
+    }
+
+    TEST(thread_pool,
+         parallel_for__every_index_visited_once)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{4};
+        auto visit_count_list = std::vector<std::atomic<std::uint32_t>>(1000);
+
+        thread_pool.parallel_for(
+            visit_count_list.size(),
+            [&visit_count_list](std::size_t index)
+            {
+                ++visit_count_list[index];
+            });
+
+        for (const auto& visit_count: visit_count_list)
+        {
+            EXPECT_EQ(visit_count.load(),
+                      1u);
+        }
+    }
+
+    TEST(thread_pool,
+         parallel_for__function_throws__exception_rethrown)
+    {
+        auto thread_pool = xar_engine::thread::ThreadPool{2};
+
+        EXPECT_THROW(
+            thread_pool.parallel_for(
+                16,
+                [](std::size_t index)
+                {
+                    if (index == 7)
+                    {
+                        throw std::runtime_error{"index 7"};
+                    }
+                }),
+            std::runtime_error);
+    }
+}